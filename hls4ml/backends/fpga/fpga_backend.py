@@ -22,6 +22,8 @@ from hls4ml.model.layers import (
     GarNetStack,
     GlobalPooling1D,
     GlobalPooling2D,
+    LayerNormalization,
+    MultiHeadAttention,
     Pooling1D,
     Pooling2D,
     SeparableConv1D,
@@ -38,6 +40,7 @@ from hls4ml.model.types import (
     SaturationMode,
     XnorPrecisionType,
 )
+from hls4ml.utils.library_cache import LibraryCache
 from hls4ml.writer import get_writer
 
 
@@ -63,6 +66,8 @@ class FPGABackend(Backend):
             LSTM,
             GRU,
             Dot,
+            LayerNormalization,
+            MultiHeadAttention,
         ]
 
         for layer in accum_layers:
@@ -99,6 +104,12 @@ class FPGABackend(Backend):
         )
         self.attribute_map[Softmax] = softmax_attrs
 
+        # Lookup table of the inverse square root, indexed by the normalized mantissa of the variance
+        layernorm_attrs = self.attribute_map.get(LayerNormalization, [])
+        layernorm_attrs.append(ConfigurableAttribute('table_size', default=1024))
+        layernorm_attrs.append(TypeAttribute('table', default=FixedPrecisionType(18, 2, rounding_mode=RoundingMode.RND)))
+        self.attribute_map[LayerNormalization] = layernorm_attrs
+
     def create_layer_class(self, layer_class):
         new_attrubutes = []
         for cls, attributes in self.attribute_map.items():
@@ -121,20 +132,30 @@ class FPGABackend(Backend):
         Returns:
             string: Returns the name of the compiled library.
         """
+        lib_name = '{}/firmware/{}-{}.so'.format(
+            model.config.get_output_dir(), model.config.get_project_name(), model.config.get_config_value('Stamp')
+        )
+
+        cache = None
+        if LibraryCache.is_enabled(model):
+            cache = LibraryCache()
+            cache_key = cache.compute_key(model)
+            if cache.fetch(cache_key, lib_name):
+                return lib_name
+
         curr_dir = os.getcwd()
         os.chdir(model.config.get_output_dir())
 
-        lib_name = None
         try:
             ret_val = os.system('bash build_lib.sh')
             if ret_val != 0:
                 raise Exception(f'Failed to compile project "{model.config.get_project_name()}"')
-            lib_name = '{}/firmware/{}-{}.so'.format(
-                model.config.get_output_dir(), model.config.get_project_name(), model.config.get_config_value('Stamp')
-            )
         finally:
             os.chdir(curr_dir)
 
+        if cache is not None:
+            cache.store(cache_key, lib_name)
+
         return lib_name
 
     def write(self, model):
@@ -668,7 +689,9 @@ class FPGABackend(Backend):
         im_matrix = im_matrix.reshape(out_w, -1)
         return im_matrix
 
-    def generate_conv1d_line_buffer_fn(self, layer_idx, n_partitions, in_W, in_C, kernel=3, stride=1, pad=0, dilation=1):
+    def generate_conv1d_line_buffer_fn(
+        self, layer_idx, n_partitions, in_W, in_C, kernel=3, stride=1, pad=0, dilation=1, implementation='Unrolled'
+    ):
         """Generate a C++ function that mimics the im2col algorithm. This function works for 1D convolution.
 
         The HLS compiler produces suboptimal designs for a im2col algorithm implementation, so a trick we use is
@@ -676,6 +699,9 @@ class FPGABackend(Backend):
         the result depends on the paraleters of the convolution layer (the input size, the kernel size, stride etc),
         we need to do this for every convolution layer.
 
+        With the ``'Table'`` implementation, the result is stored as a table of input indices instead, see
+        ``_generate_fill_buffer_table()``.
+
         Args:
             layer_idx (int): Index of layer ('index' attribute).
             n_partitions (int): Number of partitions to divide the input into.
@@ -687,6 +713,8 @@ class FPGABackend(Backend):
             pad (int or Iterable, optional): Padding to apply. Defaults to 0.
                 Specified as either a number or a list [left_pad, right_pad].
             dilation (int, optional): Dilation rate. Defaults to 1.
+            implementation (str, optional): Either ``'Unrolled'`` (one assignment per buffer element) or ``'Table'``.
+                Defaults to 'Unrolled'.
 
         Returns:
             str: Generated C++ function
@@ -700,6 +728,16 @@ class FPGABackend(Backend):
 
         im2col_matrix = self._compute_conv1d_im2col((in_W, in_C), kernel, stride, (pad_left, pad_right), dilation)
 
+        if implementation == 'Table':
+            return self._generate_fill_buffer_table(
+                layer_idx,
+                n_partitions,
+                im2col_matrix,
+                'FillConv1DBuffer',
+                'CONFIG_T::in_width * CONFIG_T::n_chan',
+                'CONFIG_T::filt_width * CONFIG_T::n_chan',
+            )
+
         generated_code = (
             "template<class data_T, typename CONFIG_T>\n"
             "class fill_buffer_{index} : public FillConv1DBuffer<data_T, CONFIG_T> {{\n"
@@ -764,7 +802,17 @@ class FPGABackend(Backend):
         return im_matrix
 
     def generate_conv2d_line_buffer_fn(
-        self, layer_idx, n_partitions, in_H, in_W, in_C, kernel=(3, 3), stride=(1, 1), pad=(0, 0, 0, 0), dilation=(1, 1)
+        self,
+        layer_idx,
+        n_partitions,
+        in_H,
+        in_W,
+        in_C,
+        kernel=(3, 3),
+        stride=(1, 1),
+        pad=(0, 0, 0, 0),
+        dilation=(1, 1),
+        implementation='Unrolled',
     ):
         """Generate a C++ function that mimics the im2col algorithm. This function works for 2D convolution.
 
@@ -773,6 +821,9 @@ class FPGABackend(Backend):
         the result depends on the paraleters of the convolution layer (the input size, the kernel size, stride etc),
         we need to do this for every convolution layer.
 
+        With the ``'Table'`` implementation, the result is stored as a table of input indices instead, see
+        ``_generate_fill_buffer_table()``.
+
         Args:
             layer_idx (int): Index of layer ('index' attribute).
             n_partitions (int): Number of partitions to divide the input into.
@@ -785,6 +836,8 @@ class FPGABackend(Backend):
             pad (int or Iterable, optional): Padding to apply. Defaults to 0.
                 Specified as either a number or a list [top_pad, bottom_pad, left_pad, right_pad].
             dilation (int or Iterable, optional): Dilation rate. Defaults to (1,1).
+            implementation (str, optional): Either ``'Unrolled'`` (one assignment per buffer element) or ``'Table'``.
+                Defaults to 'Unrolled'.
 
         Returns:
             str: Generated C++ function
@@ -830,6 +883,16 @@ class FPGABackend(Backend):
             (dilation_height, dilation_width),
         )
 
+        if implementation == 'Table':
+            return self._generate_fill_buffer_table(
+                layer_idx,
+                n_partitions,
+                im2col_matrix,
+                'FillConv2DBuffer',
+                'CONFIG_T::in_height * CONFIG_T::in_width * CONFIG_T::n_chan',
+                'CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan',
+            )
+
         generated_code = (
             "template<class data_T, typename CONFIG_T>\n"
             "class fill_buffer_{index} : public FillConv2DBuffer<data_T, CONFIG_T> {{\n"
@@ -860,6 +923,64 @@ class FPGABackend(Backend):
 
         return generated_code
 
+    def _generate_fill_buffer_table(self, layer_idx, n_partitions, im2col_matrix, base_class, n_data, n_taps):
+        """Generate a C++ function that fills the im2col buffer from a table of input indices.
+
+        The explicit assignments of the unrolled implementation grow with the number of pixels times the kernel size
+        and, for large inputs, dominate the size of the generated code and the compilation time. Here, the same im2col
+        result is stored as a constant table (partition x pixel x tap) of indices into the input, with -1 for padding,
+        which is read by the generic ``nnet::fill_buffer_from_table`` function. The output is identical. The function
+        selects the partition in an unrolled loop over the constant rows of the table, so the indices fold to constants in
+        HLS, as with the explicit assignments.
+
+        Args:
+            layer_idx (int): Index of layer ('index' attribute).
+            n_partitions (int): Number of partitions to divide the input into.
+            im2col_matrix (np.ndarray): Result of the im2col transformation of the (1-based) input indices.
+            base_class (str): Class the generated one derives from (``FillConv1DBuffer`` or ``FillConv2DBuffer``).
+            n_data (str): C++ expression of the size of the input.
+            n_taps (str): C++ expression of the number of elements of the buffer per pixel.
+
+        Returns:
+            str: Generated C++ function
+        """
+        n_pixels = im2col_matrix.shape[0] // n_partitions
+        table = im2col_matrix.astype(int).reshape(n_partitions, n_pixels, -1) - 1
+        indent = '    '
+
+        table_rows = []
+        for partition in table:
+            pixel_rows = [indent * 4 + '{' + ', '.join(str(v) for v in pixel) + '}' for pixel in partition]
+            table_rows.append(indent * 3 + '{\n' + ',\n'.join(pixel_rows) + '\n' + indent * 3 + '}')
+
+        generated_code = (
+            "template<class data_T, typename CONFIG_T>\n"
+            "class fill_buffer_{index} : public {base_class}<data_T, CONFIG_T> {{\n"
+            "    public:\n"
+            "    static void fill_buffer(\n"
+            "        data_T data[{n_data}],\n"
+            "        data_T buffer[CONFIG_T::n_pixels][{n_taps}],\n"
+            "        const unsigned partition\n"
+            "    ) {{\n"
+            "        static const int table[{n_partitions}][{n_pixels}][{n_taps}] = {{\n"
+            "{table}\n"
+            "        }};\n"
+            "        fill_buffer_from_table<data_T, {n_data}, {n_partitions}, {n_pixels}, {n_taps}>(\n"
+            "            data, buffer, table, partition);\n"
+            "    }}\n"
+            "}};\n"
+        ).format(
+            index=layer_idx,
+            base_class=base_class,
+            n_data=n_data,
+            n_taps=n_taps,
+            n_partitions=n_partitions,
+            n_pixels=n_pixels,
+            table=',\n'.join(table_rows),
+        )
+
+        return generated_code
+
     @model_optimizer()
     def write_hls(self, model):
         self.writer.write_hls(model)
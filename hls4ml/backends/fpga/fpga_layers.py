@@ -2,7 +2,13 @@ import numpy as np
 
 from hls4ml.model.attributes import Attribute, ConfigurableAttribute, TypeAttribute
 from hls4ml.model.layers import Conv1D, Conv2D, Layer
-from hls4ml.model.types import IntegerPrecisionType, XnorPrecisionType
+from hls4ml.model.types import (
+    FixedPrecisionType,
+    IntegerPrecisionType,
+    RoundingMode,
+    SaturationMode,
+    XnorPrecisionType,
+)
 
 
 class BatchNormalizationQuantizedTanh(Layer):
@@ -70,6 +76,108 @@ class BatchNormalizationQuantizedTanh(Layer):
             )
 
 
+class BatchNormalizationQuantizedThreshold(Layer):
+    '''Merged Batch Normalization and n-bit quantized activation (ReLU or linear) layer.
+    The scale and bias are folded into the 2^n - 1 thresholds of the input at which the quantized output changes level,
+    so the layer is a bank of comparators per channel. The output level is the number of thresholds the input reached,
+    or the number it did not reach if the scale of the channel is negative (direction 0).
+    '''
+
+    _expected_attributes = [
+        Attribute('n_in'),
+        Attribute('n_filt', default=0),
+        Attribute('n_thresholds'),
+        Attribute('code_lo'),
+        ConfigurableAttribute('reuse_factor', default=1),
+    ]
+
+    def initialize(self):
+        inp = self.get_input_variable()
+        self.add_output_variable(inp.shape, inp.dim_names, precision=self.get_attr('quantized_precision'))
+
+    @staticmethod
+    def get_code_range(precision, activation):
+        '''Returns the lowest and highest raw integer of the output precision reached by the activation'''
+        if precision.signed:
+            code_lo = -(2 ** (precision.width - 1))
+            code_hi = 2 ** (precision.width - 1) - 1
+            if precision.saturation_mode == SaturationMode.SAT_SYM:
+                code_lo += 1
+        else:
+            code_lo = 0
+            code_hi = 2**precision.width - 1
+        if activation == 'relu':
+            code_lo = max(code_lo, 0)
+        return code_lo, code_hi
+
+    def set_thresholds(self, scale, bias):
+        inp = self.get_input_variable()
+        in_precision = inp.type.precision
+        out_precision = self.get_attr('quantized_precision')
+        code_lo = self.get_attr('code_lo')
+        n_thresholds = self.get_attr('n_thresholds')
+
+        # The output reaches code c if the normalized value is above the boundary b[c], strictly if its tie is rounded down
+        step = 2.0**-out_precision.fractional
+        codes = np.arange(code_lo + 1, code_lo + n_thresholds + 1)
+        if out_precision.rounding_mode == RoundingMode.TRN:
+            boundary = codes * step
+            strict = np.zeros(n_thresholds, dtype=bool)
+        else:
+            boundary = (codes - 0.5) * step
+            strict = (codes % 2 == 1) if out_precision.rounding_mode == RoundingMode.RND_CONV else np.zeros_like(codes, bool)
+
+        # Thresholds on the grid of the input, compared with x >= threshold
+        ulp = 2.0**-in_precision.fractional
+        if in_precision.signed:
+            x_min = -(2.0 ** (in_precision.integer - 1))
+            x_max = 2.0 ** (in_precision.integer - 1) - ulp
+        else:
+            x_min = 0.0
+            x_max = 2.0**in_precision.integer - ulp
+
+        n_channels = len(scale)
+        threshold = np.zeros((n_channels, n_thresholds))
+        direction = np.ones(n_channels, dtype=int)
+        for i in range(n_channels):
+            if scale[i] == 0:
+                # Constant output, every threshold is either always or never reached
+                reached = np.where(strict, bias[i] > boundary, bias[i] >= boundary)
+                threshold[i] = np.where(reached, x_min, x_max + ulp)
+                continue
+            t = (boundary - bias[i]) / scale[i]
+            if scale[i] > 0:
+                # v >= b <=> x >= t, v > b <=> x > t
+                threshold[i] = np.where(strict, np.floor(t / ulp) * ulp + ulp, np.ceil(t / ulp) * ulp)
+            else:
+                # v >= b <=> x <= t <=> !(x > t), v > b <=> x < t <=> !(x >= t)
+                direction[i] = 0
+                threshold[i] = np.where(strict, np.ceil(t / ulp) * ulp, np.floor(t / ulp) * ulp + ulp)
+        threshold = np.clip(threshold, x_min, x_max + ulp)
+
+        # One more integer bit holds the thresholds never reached by the input
+        if isinstance(in_precision, IntegerPrecisionType):
+            threshold_precision = IntegerPrecisionType(width=in_precision.width + 1, signed=in_precision.signed)
+        else:
+            threshold_precision = FixedPrecisionType(
+                width=in_precision.width + 1, integer=in_precision.integer + 1, signed=in_precision.signed
+            )
+        self.add_weights_variable(
+            name='threshold',
+            var_name='t{index}',
+            data=threshold.reshape(-1),
+            type_name='threshold{index}_t',
+            precision=threshold_precision,
+        )
+        self.add_weights_variable(
+            name='direction',
+            var_name='d{index}',
+            data=direction,
+            type_name='direction{index}_t',
+            precision=IntegerPrecisionType(width=1, signed=False),
+        )
+
+
 class PointwiseConv1D(Conv1D):
     '''Optimized Conv1D implementation for 1x1 kernels.'''
 
@@ -382,7 +382,7 @@ class StreamVariableConverter:
             return tensor_var
 
         if depth == 0:
-            depth = np.prod(tensor_var.shape) // tensor_var.shape[-1]
+            depth = np.prod(tensor_var.shape) // (tensor_var.shape[-1] * max(n_pack, 1))
         tensor_var.pragma = ('stream', depth)
         tensor_var.type = self.type_converter.convert(
             PackedType(tensor_var.type.name, tensor_var.type.precision, tensor_var.shape[-1], n_pack)
@@ -1,10 +1,17 @@
 import numpy as np
 
-from hls4ml.backends.fpga.fpga_layers import BatchNormalizationQuantizedTanh
+from hls4ml.backends.fpga.fpga_layers import BatchNormalizationQuantizedTanh, BatchNormalizationQuantizedThreshold
 from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
 from hls4ml.model.layers import BatchNormalization, register_layer
 from hls4ml.model.optimizer import OptimizerPass
-from hls4ml.model.types import IntegerPrecisionType, NamedType, XnorPrecisionType
+from hls4ml.model.types import (
+    FixedPrecisionType,
+    IntegerPrecisionType,
+    NamedType,
+    RoundingMode,
+    SaturationMode,
+    XnorPrecisionType,
+)
 
 batchnorm_quantized_tanh_config_template = """struct config{index} : nnet::batchnorm_quantized_tanh_config {{
     static const unsigned n_in = {n_in};
@@ -18,6 +25,22 @@ batchnorm_quantized_tanh_function_template = (
     'nnet::normalize_{quantize}_tanh<{input_t}, {config}>({input}, {output}, {threshold});'
 )
 
+batchnorm_quantized_threshold_config_template = """struct config{index} : nnet::batchnorm_quantized_threshold_config {{
+    static const unsigned n_in = {n_in};
+    static const unsigned n_filt = {n_filt};
+    static const unsigned n_scale_bias = (n_filt == -1) ? n_in : n_filt;
+    static const unsigned n_thresholds = {n_thresholds};
+    static const int code_lo = {code_lo};
+    static const unsigned io_type = nnet::{iotype};
+    static const unsigned reuse_factor = {reuse};
+    typedef {threshold_t.name} threshold_t;
+    typedef {direction_t.name} direction_t;
+}};\n"""
+
+batchnorm_quantized_threshold_function_template = (
+    'nnet::normalize_quantized_threshold<{input_t}, {output_t}, {config}>({input}, {output}, {threshold}, {direction});'
+)
+
 bn_include_list = ['nnet_utils/nnet_batchnorm.h', 'nnet_utils/nnet_batchnorm_stream.h']
 
 
@@ -50,17 +73,48 @@ class BatchNormalizationQuantizedTanhFunctionTemplate(FunctionCallTemplate):
         return self.template.format(**params)
 
 
+class BatchNormalizationQuantizedThresholdConfigTemplate(LayerConfigTemplate):
+    def __init__(self):
+        super().__init__(BatchNormalizationQuantizedThreshold)
+        self.template = batchnorm_quantized_threshold_config_template
+
+    def format(self, node):
+        params = self._default_config_params(node)
+        params['n_in'] = node.get_input_variable().size_cpp()
+        params['threshold_t'] = node.get_weights('threshold').type
+        params['direction_t'] = node.get_weights('direction').type
+
+        return self.template.format(**params)
+
+
+class BatchNormalizationQuantizedThresholdFunctionTemplate(FunctionCallTemplate):
+    def __init__(self):
+        super().__init__(BatchNormalizationQuantizedThreshold, include_header=bn_include_list)
+        self.template = batchnorm_quantized_threshold_function_template
+
+    def format(self, node):
+        params = self._default_function_params(node)
+        params['threshold'] = node.get_weights('threshold').name
+        params['direction'] = node.get_weights('direction').name
+
+        return self.template.format(**params)
+
+
 def register_bn_quant(backend):
     # Register the layer types to the layer map
     register_layer('BatchNormalizationQuantizedTanh', BatchNormalizationQuantizedTanh)
+    register_layer('BatchNormalizationQuantizedThreshold', BatchNormalizationQuantizedThreshold)
 
     # Register the optimization passes
     backend.register_pass('merge_batch_norm_quantized_tanh', MergeBatchNormAndQuantizedTanh)
+    backend.register_pass('merge_batch_norm_quantized_activation', MergeBatchNormAndQuantizedActivation)
     backend.register_pass('quantize_dense_output', QuantizeDenseOutput)
 
     # Register template passes
     backend.register_template(BatchNormalizationQuantizedTanhConfigTemplate)
     backend.register_template(BatchNormalizationQuantizedTanhFunctionTemplate)
+    backend.register_template(BatchNormalizationQuantizedThresholdConfigTemplate)
+    backend.register_template(BatchNormalizationQuantizedThresholdFunctionTemplate)
 
 
 class MergeBatchNormAndQuantizedTanh(OptimizerPass):
@@ -103,6 +157,65 @@ class MergeBatchNormAndQuantizedTanh(OptimizerPass):
         return True
 
 
+class MergeBatchNormAndQuantizedActivation(OptimizerPass):
+    '''Folds a BatchNormalization followed by a low-bit quantized ReLU or linear activation (e.g. QKeras
+    ``quantized_relu`` or ``quantized_bits`` with up to ``max_bits`` bits) into per-channel thresholds, replacing the
+    multiply-add of the normalization with 2^n - 1 comparators.
+
+    The output precision must saturate, so that the output level is monotonic in the input, and round with TRN, RND or
+    RND_CONV. The thresholds are exact for the unrounded normalization of the fixed-point input.
+    '''
+
+    max_bits = 4
+
+    def match(self, node):
+        if node.class_name != 'Activation' or node.get_attr('activation') not in ['relu', 'linear']:
+            return False
+        bn_layer = node.get_input_node()
+        if not isinstance(bn_layer, BatchNormalization):
+            return False
+
+        # The normalized values must not be used elsewhere
+        bn_map = bn_layer.get_output_use_map()
+        if len(bn_map[bn_layer.outputs[0]]) > 1 or bn_layer.outputs[0] in node.model.outputs:
+            return False
+
+        in_precision = bn_layer.get_input_variable().type.precision
+        out_precision = node.get_output_variable().type.precision
+        return (
+            isinstance(in_precision, (FixedPrecisionType, IntegerPrecisionType))
+            and isinstance(out_precision, FixedPrecisionType)
+            and out_precision.width <= self.max_bits
+            and out_precision.saturation_mode in [SaturationMode.SAT, SaturationMode.SAT_SYM]
+            and out_precision.rounding_mode in [RoundingMode.TRN, RoundingMode.RND, RoundingMode.RND_CONV]
+        )
+
+    def transform(self, model, node):
+        bn_layer = node.get_input_node()
+        out_precision = node.get_output_variable().type.precision
+        code_lo, code_hi = BatchNormalizationQuantizedThreshold.get_code_range(out_precision, node.get_attr('activation'))
+        attrs = {
+            'name': bn_layer.get_attr('name'),
+            'original_name': bn_layer.get_attr('name'),
+            'class_name': 'BatchNormalizationQuantizedThreshold',
+            'n_in': bn_layer.get_attr('n_in'),
+            'n_out': bn_layer.get_attr('n_in'),
+            'n_filt': bn_layer.get_attr('n_filt'),
+            'n_thresholds': code_hi - code_lo,
+            'code_lo': code_lo,
+            'quantized_precision': out_precision,
+            'trace': bn_layer.get_attr('trace'),
+        }
+        bnqt_layer = model.make_node(BatchNormalizationQuantizedThreshold, 'bnqt_' + bn_layer.name, attrs, bn_layer.inputs)
+        bnqt_layer.set_thresholds(bn_layer.get_weights('scale').data, bn_layer.get_weights('bias').data)
+        # Remove the BatchNormalization layer
+        model.remove_node(bn_layer, rewire=True)
+        # Replace the old Activation layer with this one
+        model.replace_node(node, bnqt_layer)
+
+        return True
+
+
 class QuantizeDenseOutput(OptimizerPass):
     def match(self, node):
         is_dense = node.class_name == 'Dense'
@@ -6,13 +6,28 @@ from hls4ml.model.optimizer import OptimizerPass
 
 
 class Clone(Layer):
-    '''Inserted after the layer whose output is used more than once.'''
+    '''Inserted after the layer whose output is used more than once.
+
+    A single Clone layer feeds all consumers of the output. The depth of the FIFO of each branch can be set through the
+    ``FifoDepth`` option of the clone layer (named ``clone_<layer name>``), either as a single value for all branches or
+    as a dictionary mapping the names of the consuming layers to the depth of their branch.
+    '''
 
     def initialize(self):
         inp = self.get_input_variable()
         for i, out_name in enumerate(self.outputs):
             self.add_output_variable(inp.shape, inp.dim_names, out_name=out_name, var_name='layer{index}_cpy' + str(i + 1))
 
+        fifo_depth = self.get_attr('fifo_depth')
+        if fifo_depth is not None:
+            if not isinstance(fifo_depth, dict):
+                fifo_depth = {consumer: fifo_depth for consumer in self.get_attr('consumers')}
+            depth_hints = {}
+            for out_name, consumer in zip(self.outputs, self.get_attr('consumers')):
+                if consumer in fifo_depth:
+                    depth_hints[out_name] = int(fifo_depth[consumer])
+            self.set_attr('fifo_depth_hints', depth_hints)
+
 
 clone_include_list = ['nnet_utils/nnet_stream.h']
 
@@ -65,16 +80,9 @@ class CloneOutput(OptimizerPass):
         transformed = False
         for output in node.outputs:
             if len(output_map[output]) > 1:
-                if len(output_map[output]) > 3:
-                    print(
-                        'WARNING: Cloning output {} of {} ({}) more than 3 times not currently supported'.format(
-                            output, node.__class__.__name__, node.name
-                        )
-                    )
-                    return False
                 out_var = node.get_output_variable(output)
+                attrs = {'size': np.prod(out_var.shape), 'consumers': [layer.name for layer in output_map[output]]}
                 for i, layer in enumerate(output_map[output], 1):
-                    attrs = {'size': np.prod(out_var.shape)}
                     idx = layer.inputs.index(output)
                     layer.inputs[idx] = output + '_cpy' + str(i)
 
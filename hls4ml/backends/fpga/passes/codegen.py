@@ -27,6 +27,7 @@ class GenerateConvIm2col(OptimizerPass):
             kernel=node.get_attr('filt_width'),
             stride=node.get_attr('stride_width'),
             pad=(node.get_attr('pad_left'), node.get_attr('pad_right')),
+            implementation=node.get_attr('buffer_fill', 'Unrolled'),
         )
 
         node.set_attr('line_buffer_codegen', Source(code_str))
@@ -46,6 +47,7 @@ class GenerateConvIm2col(OptimizerPass):
                 node.get_attr('pad_left'),
                 node.get_attr('pad_right'),
             ),
+            implementation=node.get_attr('buffer_fill', 'Unrolled'),
         )
 
         node.set_attr('line_buffer_codegen', Source(code_str))
@@ -1,6 +1,14 @@
 from hls4ml.backends.backend import get_backend
 from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
-from hls4ml.model.layers import Conv1D, Conv2D, Conv2DBatchnorm
+from hls4ml.model.layers import (
+    Conv1D,
+    Conv2D,
+    Conv2DBatchnorm,
+    DepthwiseConv1D,
+    DepthwiseConv2D,
+    SeparableConv1D,
+    SeparableConv2D,
+)
 
 # TODO - Dilation rate ?
 
@@ -181,3 +189,201 @@ class Conv2DFunctionTemplate(FunctionCallTemplate):
         params['b'] = node.get_weights('bias').name
 
         return self.template.format(**params)
+
+
+''' Depthwise Conv '''
+depthconv1d_function_template = (
+    'nnet::depthwise_conv_1d_{data_format}<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
+)
+depthconv2d_function_template = (
+    'nnet::depthwise_conv_2d_{data_format}<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
+)
+
+sepconv1d_include_list = ['nnet_utils/nnet_sepconv1d.h', 'nnet_utils/nnet_sepconv1d_stream.h']
+sepconv2d_include_list = ['nnet_utils/nnet_sepconv2d.h', 'nnet_utils/nnet_sepconv2d_stream.h']
+
+
+class DepthwiseConv1DConfigTemplate(Conv1DConfigTemplate):
+    def __init__(self):
+        super(Conv1DConfigTemplate, self).__init__(DepthwiseConv1D)
+        self.template = conv1d_config_template
+        self.mult_template = conv_mult_config_template
+
+    def format(self, node):
+        conv_params = self._default_config_params(node)
+        conv_params['dilation'] = node.get_attr('dilation', 1)
+        if conv_params['dilation'] != 1:
+            raise Exception('dilation != 1 not supported yet')
+        conv_params['config_t'] = f'config{node.index}_mult'
+        conv_config = self.template.format(**conv_params)
+
+        # Each channel is multiplied with its own kernel, the mult config only holds the types and the multiplier count
+        mult_params = self._default_config_params(node)
+        mult_params['n_in'] = node.get_attr('filt_width')
+        mult_params['n_out'] = node.get_attr('n_chan')
+        mult_params['product_type'] = get_backend('quartus').product_type(
+            node.get_input_variable().type.precision, node.get_weights('weight').type.precision
+        )
+        mult_config = self.mult_template.format(**mult_params)
+
+        return mult_config + '\n' + conv_config
+
+
+class DepthwiseConv1DFunctionTemplate(Conv1DFunctionTemplate):
+    def __init__(self):
+        super(Conv1DFunctionTemplate, self).__init__(DepthwiseConv1D, include_header=sepconv1d_include_list)
+        self.template = depthconv1d_function_template
+
+
+class DepthwiseConv2DConfigTemplate(Conv2DConfigTemplate):
+    def __init__(self):
+        super(Conv2DConfigTemplate, self).__init__(DepthwiseConv2D)
+        self.template = conv2d_config_template
+        self.mult_template = conv_mult_config_template
+
+    def format(self, node):
+        conv_params = self._default_config_params(node)
+        conv_params['dilation'] = node.get_attr('dilation', 1)
+        if conv_params['dilation'] != 1:
+            raise Exception('dilation != 1 not supported yet')
+        conv_params['config_t'] = f'config{node.index}_mult'
+        conv_config = self.template.format(**conv_params)
+
+        # Each channel is multiplied with its own kernel, the mult config only holds the types and the multiplier count
+        mult_params = self._default_config_params(node)
+        mult_params['n_in'] = node.get_attr('filt_height') * node.get_attr('filt_width')
+        mult_params['n_out'] = node.get_attr('n_chan')
+        mult_params['product_type'] = get_backend('quartus').product_type(
+            node.get_input_variable().type.precision, node.get_weights('weight').type.precision
+        )
+        mult_config = self.mult_template.format(**mult_params)
+
+        return mult_config + '\n' + conv_config
+
+
+class DepthwiseConv2DFunctionTemplate(Conv2DFunctionTemplate):
+    def __init__(self):
+        super(Conv2DFunctionTemplate, self).__init__(DepthwiseConv2D, include_header=sepconv2d_include_list)
+        self.template = depthconv2d_function_template
+
+
+''' Separable Conv '''
+sepconv_config_template = """struct config{index} {{
+    typedef {depthwise_config} depthwise_config;
+    typedef {pointwise_config} pointwise_config;
+}};\n"""
+
+sepconv1d_function_template = (
+    'nnet::separable_conv_1d_{data_format}<{input_t}, {dw_output_t}, {output_t}, {config}>('
+    '{input}, {output}, {d}, {p}, {z}, {b});'
+)
+sepconv2d_function_template = (
+    'nnet::separable_conv_2d_{data_format}<{input_t}, {dw_output_t}, {output_t}, {config}>('
+    '{input}, {output}, {d}, {p}, {z}, {b});'
+)
+
+
+class SeparableConv1DConfigTemplate(LayerConfigTemplate):
+    '''
+    The depthwise step is configured as a depthwise convolution with the (zero) bias of the layer, and the pointwise step
+    as a 1x1 convolution of the depthwise output. Both steps are computed in the same loop over the output pixels.
+    '''
+
+    def __init__(self):
+        super().__init__(SeparableConv1D)
+        self.template = sepconv_config_template
+        self.conv_template = conv1d_config_template
+        self.mult_template = conv_mult_config_template
+        self.filt_dims = ['width']
+
+    def format(self, node):
+        dilation = node.get_attr('dilation', 1)
+        if dilation != 1:
+            raise Exception('dilation != 1 not supported yet')
+
+        kernel_size = 1
+        for dim in self.filt_dims:
+            kernel_size *= node.get_attr(f'filt_{dim}')
+
+        # Depthwise config
+        params = self._default_config_params(node)
+        params['index'] = f'{node.index}_depthwise'
+        params['n_filt'] = params['n_chan']
+        params['dilation'] = dilation
+        params['reuse'] = node.get_attr('depthwise_reuse_factor')
+        params['weight_t'] = node.get_weights('depthwise').type
+        params['bias_t'] = node.get_weights('zero_bias').type
+        params['config_t'] = f'config{node.index}_depthwise_mult'
+        depthwise_config = self.conv_template.format(**params)
+
+        params['n_in'] = kernel_size
+        params['n_out'] = node.get_attr('n_chan')
+        params['product_type'] = get_backend('quartus').product_type(
+            node.get_input_variable().type.precision, node.get_weights('depthwise').type.precision
+        )
+        depthwise_mult_config = self.mult_template.format(**params)
+
+        # Pointwise config, the input is the depthwise output
+        params = self._default_config_params(node)
+        params['index'] = f'{node.index}_pointwise'
+        params['dilation'] = dilation
+        for dim in self.filt_dims:
+            params[f'in_{dim}'] = node.get_attr(f'out_{dim}')
+            params[f'filt_{dim}'] = 1
+            params[f'impl_filt_{dim}'] = 1
+            params[f'stride_{dim}'] = 1
+        for pad in ('pad_top', 'pad_bottom', 'pad_left', 'pad_right'):
+            params[pad] = 0
+        params['weight_t'] = node.get_weights('pointwise').type
+        params['config_t'] = f'config{node.index}_pointwise_mult'
+        pointwise_config = self.conv_template.format(**params)
+
+        params['n_in'] = node.get_attr('n_chan')
+        params['n_out'] = node.get_attr('n_filt')
+        params['product_type'] = get_backend('quartus').product_type(
+            node.get_attr('dw_output_t').precision, node.get_weights('pointwise').type.precision
+        )
+        pointwise_mult_config = self.mult_template.format(**params)
+
+        sep_params = {
+            'index': node.index,
+            'depthwise_config': f'config{node.index}_depthwise',
+            'pointwise_config': f'config{node.index}_pointwise',
+        }
+        sep_config = self.template.format(**sep_params)
+
+        return '\n'.join([depthwise_mult_config, depthwise_config, pointwise_mult_config, pointwise_config, sep_config])
+
+
+class SeparableConv2DConfigTemplate(SeparableConv1DConfigTemplate):
+    def __init__(self):
+        super(SeparableConv1DConfigTemplate, self).__init__(SeparableConv2D)
+        self.template = sepconv_config_template
+        self.conv_template = conv2d_config_template
+        self.mult_template = conv_mult_config_template
+        self.filt_dims = ['height', 'width']
+
+
+class SeparableConv1DFunctionTemplate(FunctionCallTemplate):
+    def __init__(self):
+        super().__init__(SeparableConv1D, include_header=sepconv1d_include_list)
+        self.template = sepconv1d_function_template
+
+    def format(self, node):
+        params = self._default_function_params(node)
+        if node.get_attr('data_format') == 'channels_first':
+            raise Exception('channels_first not supported on Quartus')
+        params['data_format'] = 'cl'
+        params['dw_output_t'] = node.get_attr('dw_output_t').name
+        params['d'] = node.get_weights('depthwise').name
+        params['p'] = node.get_weights('pointwise').name
+        params['z'] = node.get_weights('zero_bias').name
+        params['b'] = node.get_weights('bias').name
+
+        return self.template.format(**params)
+
+
+class SeparableConv2DFunctionTemplate(SeparableConv1DFunctionTemplate):
+    def __init__(self):
+        super(SeparableConv1DFunctionTemplate, self).__init__(SeparableConv2D, include_header=sepconv2d_include_list)
+        self.template = sepconv2d_function_template
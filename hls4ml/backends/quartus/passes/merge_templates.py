@@ -33,6 +33,9 @@ class MergeFunctionTemplate(FunctionCallTemplate):
         self.template = merge_function_template
 
     def format(self, node):
+        if len(node.inputs) > 2:
+            raise Exception(f'ERROR: Merging more than two tensors ({node.name}) is not supported in Quartus.')
+
         params = {}
         params['merge'] = node.get_attr('op').lower()
         params['config'] = f'config{node.index}'
@@ -1,6 +1,6 @@
 import numpy as np
 
-from hls4ml.model.layers import GRU, LSTM, Conv1D, Conv2D, Dense, SimpleRNN
+from hls4ml.model.layers import GRU, LSTM, Conv1D, Conv2D, Dense, SeparableConv1D, SeparableConv2D, SimpleRNN
 from hls4ml.model.optimizer import OptimizerPass
 
 
@@ -8,7 +8,7 @@ class ApplyResourceStrategy(OptimizerPass):
     '''Transposes the weights to use the dense_resource matrix multiply routine'''
 
     def match(self, node):
-        node_matches = isinstance(node, (Dense, Conv1D, Conv2D, GRU, LSTM, SimpleRNN))
+        node_matches = isinstance(node, (Dense, Conv1D, Conv2D, SeparableConv1D, SeparableConv2D, GRU, LSTM, SimpleRNN))
         is_resource_strategy = (
             True  # node.get_attr('strategy', '').lower() == 'resource' -> Quartus only supportr Resource strategy
         )
@@ -53,6 +53,18 @@ class ApplyResourceStrategy(OptimizerPass):
             #                 useful for Winograd's minimal filtering algorithm
             node.weights['weight'].data = np.transpose(node.weights['weight'].data, axes=[3, 0, 1, 2])
 
+        elif isinstance(node, SeparableConv1D):
+            # Depthwise (W,C,1) => (1,W,C), the [kernel][channel] order of the depthwise product
+            # Pointwise (1,C,F) => (F,1,C)
+            for weights in ('depthwise', 'pointwise'):
+                node.weights[weights].data = np.transpose(node.weights[weights].data, axes=[2, 0, 1])
+
+        elif isinstance(node, SeparableConv2D):
+            # Depthwise (H,W,C,1) => (1,H,W,C), the [kernel][channel] order of the depthwise product
+            # Pointwise (1,1,C,F) => (F,1,1,C)
+            for weights in ('depthwise', 'pointwise'):
+                node.weights[weights].data = np.transpose(node.weights[weights].data, axes=[3, 0, 1, 2])
+
         elif isinstance(node, GRU):
             node.weights['weight'].data = np.transpose(node.weights['weight'].data)
             node.weights['recurrent_weight'].data = np.transpose(node.weights['recurrent_weight'].data)
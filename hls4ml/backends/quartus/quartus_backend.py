@@ -6,7 +6,22 @@ import numpy as np
 from hls4ml.backends import FPGABackend
 from hls4ml.model.attributes import ConfigurableAttribute, TypeAttribute
 from hls4ml.model.flow import register_flow
-from hls4ml.model.layers import GRU, LSTM, Activation, Conv1D, Conv2D, Dense, Embedding, Layer, SimpleRNN, Softmax
+from hls4ml.model.layers import (
+    GRU,
+    LSTM,
+    Activation,
+    Conv1D,
+    Conv2D,
+    Dense,
+    DepthwiseConv1D,
+    DepthwiseConv2D,
+    Embedding,
+    Layer,
+    SeparableConv1D,
+    SeparableConv2D,
+    SimpleRNN,
+    Softmax,
+)
 from hls4ml.model.optimizer import get_backend_passes, layer_optimizer
 from hls4ml.model.types import FixedPrecisionType, IntegerPrecisionType, NamedType
 from hls4ml.report import parse_quartus_report
@@ -60,6 +75,7 @@ class QuartusBackend(FPGABackend):
 
         quantization_passes = [
             'quartus:merge_batch_norm_quantized_tanh',
+            'quartus:merge_batch_norm_quantized_activation',
             'quartus:quantize_dense_output',
             'fuse_consecutive_batch_normalization',
             'quartus:xnor_pooling',
@@ -310,6 +326,63 @@ class QuartusBackend(FPGABackend):
             'n_partitions', 1
         )  # TODO Not used yet as there is no codegen implementation of CNNs for Quartus backend
 
+    def get_depthwise_reuse_factor(self, kernel_size, reuse_factor):
+        """The depthwise product computes whole kernel positions in each step, so its reuse factor is the largest divisor
+        of the kernel size not above the chosen reuse factor."""
+        return max(rf for rf in range(1, kernel_size + 1) if kernel_size % rf == 0 and rf <= max(reuse_factor, 1))
+
+    def _init_depthwise_conv(self, layer, kernel_size):
+        # Runs after init_conv1d/init_conv2d, the reuse factor is chosen for the depthwise product instead of dense_resource
+        chosen_rf = layer.model.config.get_reuse_factor(layer)
+        reuse_factor = self.get_depthwise_reuse_factor(kernel_size, chosen_rf)
+        if reuse_factor != chosen_rf:
+            print(
+                f'WARNING: Invalid ReuseFactor={chosen_rf} in layer "{layer.name}".'
+                f'Using ReuseFactor={reuse_factor} instead. The ReuseFactor must divide the kernel size ({kernel_size}).'
+            )
+        layer.set_attr('reuse_factor', reuse_factor)
+
+        # No Winograd kernel for depthwise convolutions
+        layer.set_attr('implementation', 'im2col')
+
+    @layer_optimizer(DepthwiseConv1D)
+    def init_depthwise_conv1d(self, layer):
+        self._init_depthwise_conv(layer, layer.get_attr('filt_width'))
+
+    @layer_optimizer(DepthwiseConv2D)
+    def init_depthwise_conv2d(self, layer):
+        self._init_depthwise_conv(layer, layer.get_attr('filt_height') * layer.get_attr('filt_width'))
+
+    def _init_sepconv(self, layer, kernel_size):
+        # Dense matrix multiply properties of the pointwise step
+        layer.set_attr('rfpad', 0)
+        layer.set_attr('bfpad', 0)
+
+        # The reuse factor of the layer is the one of the pointwise step, the depthwise step may be faster
+        layer.set_attr('strategy', 'resource')
+        self.set_target_reuse_factor(layer)
+        self.set_closest_reuse_factor(layer, layer.get_attr('n_chan'), layer.get_attr('n_filt'))
+        layer.set_attr(
+            'depthwise_reuse_factor', self.get_depthwise_reuse_factor(kernel_size, layer.get_attr('reuse_factor'))
+        )
+        layer.set_attr('parallelization', layer.model.config.get_layer_config_value(layer, 'ParallelizationFactor', 1))
+        layer.set_attr('implementation', 'im2col')
+
+        # Type of the depthwise output, passed directly to the pointwise step
+        dw_out_precision, _ = layer.model.config.get_precision(layer, 'dw_output')
+        layer.set_attr('dw_output_t', NamedType(layer.name + '_dw_out_t', dw_out_precision))
+
+    @layer_optimizer(SeparableConv1D)
+    def init_sepconv1d(self, layer):
+        layer.set_attr('impl_filt_width', layer.get_attr('filt_width'))
+        self._init_sepconv(layer, layer.get_attr('filt_width'))
+
+    @layer_optimizer(SeparableConv2D)
+    def init_sepconv2d(self, layer):
+        layer.set_attr('impl_filt_height', layer.get_attr('filt_height'))
+        layer.set_attr('impl_filt_width', layer.get_attr('filt_width'))
+        self._init_sepconv(layer, layer.get_attr('filt_height') * layer.get_attr('filt_width'))
+
     @layer_optimizer(LSTM)
     def init_lstm(self, layer):
         reuse_factor = layer.model.config.get_reuse_factor(layer)
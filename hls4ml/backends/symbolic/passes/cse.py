@@ -0,0 +1,120 @@
+import math
+
+import sympy
+
+from hls4ml.model.layers import SymbolicExpression
+from hls4ml.model.optimizer import OptimizerPass
+from hls4ml.model.optimizer.passes.bit_growth import _fixed_params, _integer_bits, _type_range
+from hls4ml.model.types import FixedPrecisionType, NamedType
+
+# Functions with a known output range, for the ranges of the temporaries
+bounded_functions = {'sin': (-1.0, 1.0), 'cos': (-1.0, 1.0), 'tanh': (-1.0, 1.0), 'sinpi': (-1.0, 1.0), 'cospi': (-1.0, 1.0)}
+increasing_functions = {'exp': sympy.exp, 'atan': sympy.atan, 'asinh': sympy.asinh}
+
+
+def count_operations(exprs):
+    """Returns the number of operations of each kind (``ADD``, ``MUL``, ``SIN``, ``FUNC_COS_LUT``...) in ``exprs``."""
+    counts = {}
+    for term in sympy.Add.make_args(sympy.count_ops(exprs, visual=True)):
+        if term == 0:
+            continue
+        n, op = term.as_coeff_Mul()
+        counts[str(op)] = counts.get(str(op), 0) + int(n)
+    return counts
+
+
+def _expression_range(expr, ranges, lut_math_funcs):
+    """The interval of values of ``expr`` for the symbols in the given ranges, None if it cannot be bounded."""
+    if expr.is_Number:
+        return float(expr), float(expr)
+    if expr.is_Symbol:
+        return ranges.get(expr.name)
+
+    arg_ranges = [_expression_range(arg, ranges, lut_math_funcs) for arg in expr.args]
+    if expr.is_Add or expr.is_Mul:
+        if any(r is None for r in arg_ranges):
+            return None
+        low, high = arg_ranges[0]
+        for arg_low, arg_high in arg_ranges[1:]:
+            if expr.is_Add:
+                low, high = low + arg_low, high + arg_high
+            else:
+                products = [low * arg_low, low * arg_high, high * arg_low, high * arg_high]
+                low, high = min(products), max(products)
+        return low, high
+    if expr.is_Pow:
+        base_range = arg_ranges[0]
+        if base_range is None or not expr.exp.is_Integer or expr.exp < 0:
+            return None
+        low, high = base_range
+        n = int(expr.exp)
+        if n % 2 == 1:
+            return low**n, high**n
+        if low <= 0 <= high:
+            return 0.0, max(-low, high) ** n
+        return min(low**n, high**n), max(low**n, high**n)
+
+    name = expr.func.__name__
+    name = lut_math_funcs.get(name, name)
+    if name in bounded_functions:
+        return bounded_functions[name]
+    if name in increasing_functions and len(arg_ranges) == 1 and arg_ranges[0] is not None:
+        low, high = arg_ranges[0]
+        func = increasing_functions[name]
+        return float(func(low)), float(func(high))
+    return None
+
+
+class EliminateCommonSubexpressions(OptimizerPass):
+    '''
+    Extracts the subexpressions that appear more than once in the expressions of a SymbolicExpression layer (including
+    identical LUT calls) into temporaries that are computed once. Each temporary gets its own fixed-point type, with the
+    fractional bits of the result type and the integer bits needed for its range given the range of the input type. If
+    the range cannot be bounded, the result type is used. Since the temporaries are rounded to the fractional bits of the
+    result, the outputs can differ slightly from the ones of the expressions computed without elimination. The number of
+    operations of each kind before and after are stored in the 'ops_before' and 'ops_after' attributes.
+
+    The elimination is only applied to a layer with the 'cse' attribute set to True.
+    '''
+
+    def match(self, node):
+        return isinstance(node, SymbolicExpression) and node.get_attr('cse', False) and node.get_attr('cse_temps') is None
+
+    def transform(self, model, node):
+        exprs = [sympy.sympify(expr) for expr in node.get_attr('expression')]
+        temps, reduced = sympy.cse(exprs, symbols=sympy.numbered_symbols('cse_'))
+
+        ops_before = count_operations(exprs)
+        ops_after = count_operations([temp_expr for _, temp_expr in temps] + reduced)
+        node.set_attr('ops_before', ops_before)
+        node.set_attr('ops_after', ops_after)
+
+        result_precision = node.types['result_t'].precision
+        result_params = _fixed_params(result_precision)
+        input_params = _fixed_params(node.get_input_variable().type.precision)
+        ranges = {}
+        if input_params is not None:
+            input_range = _type_range(*input_params)
+            ranges = {f'x{i}': input_range for i in range(node.get_attr('n_symbols'))}
+        lut_math_funcs = {lut_fun.name: lut_fun.math_func for lut_fun in node.get_attr('lut_functions')}
+
+        cse_temps = []
+        for symbol, temp_expr in temps:
+            temp_range = _expression_range(temp_expr, ranges, lut_math_funcs) if result_params is not None else None
+            if temp_range is None or not all(math.isfinite(v) for v in temp_range):
+                precision = result_precision
+            else:
+                low, high = temp_range
+                ranges[symbol.name] = temp_range
+                signed = low < 0
+                fractional = result_params[2]
+                integer = max(_integer_bits(low, high, signed, fractional), 1 - fractional)
+                precision = FixedPrecisionType(integer + fractional, integer, signed)
+            type_name = f'{node.name}_{symbol.name}_t'
+            node.set_attr(type_name, NamedType(type_name, precision))
+            cse_temps.append((symbol.name, str(temp_expr), type_name))
+
+        node.set_attr('cse_temps', cse_temps)
+        node.set_attr('cse_expression', [str(expr) for expr in reduced])
+
+        return False
@@ -135,10 +135,26 @@ class ExpressionFunctionTemplate(FunctionCallTemplate):
         printer = HLSCodePrinter(node, lut_functions=lut_functions, use_built_in_luts=node.attributes['use_built_in_luts'])
 
         fn_templates = []
-        for i, expr in enumerate(node.attributes['expression']):
+        # The operators are shared over the reuse factor, see ScheduleExpressions (the function units are not constrained)
+        if node.get_attr('reuse_factor', 1) > 1:
+            for op, limit in [('mul', 'multiplier_limit'), ('add', 'adder_limit'), ('sub', 'subtractor_limit')]:
+                fn_templates.append(f'#pragma HLS ALLOCATION operation instances={op} limit={max(node.get_attr(limit), 1)}')
+
+        # Temporaries of the common subexpressions, see EliminateCommonSubexpressions
+        temp_templates = []
+        for name, temp_expr, type_name in node.get_attr('cse_temps', []):
+            temp_templates.append(f'{type_name} {name} = {printer.doprint(temp_expr)};')
+
+        expr_templates = []
+        for i, expr in enumerate(node.get_attr('cse_expression', node.attributes['expression'])):
             params['expr_str'] = printer.doprint(expr)
             params['y_index'] = str(i)
-            fn_templates.append(self.template.format(**params))
+            expr_templates.append(self.template.format(**params))
+
+        default_order = [('temp', i) for i in range(len(temp_templates))]
+        default_order += [('output', i) for i in range(len(expr_templates))]
+        for kind, i in node.get_attr('statement_order', default_order):
+            fn_templates.append(temp_templates[i] if kind == 'temp' else expr_templates[i])
 
         return fn_templates
 
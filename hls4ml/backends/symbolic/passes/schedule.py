@@ -0,0 +1,163 @@
+import math
+
+import sympy
+
+from hls4ml.model.layers import SymbolicExpression
+from hls4ml.model.optimizer import ConfigurableOptimizerPass
+
+
+def expression_operations(exprs, temps=()):
+    """Decomposes the expressions into a DAG of two-input operations of the kinds 'mul', 'add', 'sub' and 'lut'
+    (evaluation of a math or LUT function). The numbers of additions and subtractions are those of the generated code:
+    every negative term of a sum is a subtraction (or a negation if it comes first).
+
+    Args:
+        exprs (list): The (sympy) output expressions.
+        temps (list, optional): The ``(symbol, expression)`` temporaries used by the expressions, in order.
+
+    Returns:
+        tuple: The list of ``(kind, dependencies)`` of the operations, in topological order, and for every temporary and
+            every expression the index of the operation computing it (None for inputs and constants).
+    """
+    ops = []
+    temp_ops = {}
+
+    def add_op(kind, deps):
+        ops.append((kind, [d for d in deps if d is not None]))
+        return len(ops) - 1
+
+    def reduce_tree(kind, operands):
+        # Balanced tree, the operands are the op indices (None for inputs and constants)
+        while len(operands) > 1:
+            pairs = [operands[i : i + 2] for i in range(0, len(operands), 2)]
+            operands = [add_op(kind, pair) if len(pair) == 2 else pair[0] for pair in pairs]
+        return operands[0]
+
+    def visit(expr, in_sum=False):
+        if expr.is_Symbol:
+            return temp_ops.get(expr.name)
+        if expr.is_Number:
+            return None
+        if expr.is_Add:
+            terms = expr.as_ordered_terms()
+            n_sub = sum(1 for term in terms if term.could_extract_minus_sign())
+            op = reduce_tree('add', [visit(term, in_sum=True) for term in terms])
+            # The last combinations of the tree are the subtractions, a leading negative term is a negation
+            n_combined = len(terms) - 1
+            for i in range(len(ops) - min(n_sub, n_combined), len(ops)):
+                ops[i] = ('sub', ops[i][1])
+            if n_sub > n_combined:
+                op = add_op('sub', [op])
+            return op
+        if expr.is_Mul:
+            args = [arg for arg in expr.args if arg != -1]
+            op = reduce_tree('mul', [visit(arg) for arg in args])
+            # The negation is a subtraction of the enclosing sum
+            if not in_sum and any(arg == -1 for arg in expr.args):
+                op = add_op('sub', [op])
+            return op
+        if expr.is_Pow and expr.exp.is_Integer and expr.exp > 1:
+            base = visit(expr.base)
+            op = base
+            for _ in range(int(expr.exp) - 1):
+                op = add_op('mul', [op, base])
+            return op
+        # Functions, and the remaining powers (hls::recip, hls::sqrt...)
+        return add_op('lut', [visit(arg) for arg in expr.args])
+
+    for symbol, temp_expr in temps:
+        temp_ops[symbol.name] = visit(temp_expr)
+    roots = [visit(expr) for expr in exprs]
+
+    return ops, [temp_ops[symbol.name] for symbol, _ in temps], roots
+
+
+def list_schedule(ops, reuse_factor, latencies):
+    """Modulo list scheduling of the operations on pools of units that start one operation per cycle, for a new input
+    every ``reuse_factor`` cycles. Each pool has the smallest number of units that can process all operations of its kind
+    in ``reuse_factor`` cycles. The ready operations are scheduled by decreasing length of their path to the outputs.
+
+    Returns:
+        tuple: The start cycle of every operation, the number of units of each kind and the latency in cycles.
+    """
+    n_ops = {}
+    for kind, _ in ops:
+        n_ops[kind] = n_ops.get(kind, 0) + 1
+    units = {kind: math.ceil(n / reuse_factor) for kind, n in n_ops.items()}
+
+    users = [[] for _ in ops]
+    for i, (_, deps) in enumerate(ops):
+        for d in deps:
+            users[d].append(i)
+    priority = [0] * len(ops)
+    for i in reversed(range(len(ops))):
+        priority[i] = latencies[ops[i][0]] + max((priority[u] for u in users[i]), default=0)
+
+    start = [None] * len(ops)
+    usage = {}
+    remaining = list(range(len(ops)))
+    cycle = 0
+    while remaining:
+        ready = [
+            i for i in remaining if all(start[d] is not None and start[d] + latencies[ops[d][0]] <= cycle for d in ops[i][1])
+        ]
+        for i in sorted(ready, key=lambda i: -priority[i]):
+            slot = (ops[i][0], cycle % reuse_factor)
+            if usage.get(slot, 0) < units[ops[i][0]]:
+                usage[slot] = usage.get(slot, 0) + 1
+                start[i] = cycle
+                remaining.remove(i)
+        cycle += 1
+
+    latency = max((start[i] + latencies[kind] for i, (kind, _) in enumerate(ops)), default=0)
+
+    return start, units, latency
+
+
+class ScheduleExpressions(ConfigurableOptimizerPass):
+    '''
+    Shares the operators of a SymbolicExpression layer over 'reuse_factor' cycles. The expressions (with the temporaries
+    of the common subexpressions) are decomposed into multiplications, additions and function (LUT) evaluations that are
+    list-scheduled on the smallest pools of units able to accept a new input every 'reuse_factor' cycles. The pool sizes
+    are set as allocation limits of the pipelined kernel, and the statements are emitted in the order of the schedule.
+
+    The estimate is stored in the 'multiplier_limit', 'adder_limit', 'subtractor_limit', 'lut_limit' and
+    'latency_estimate' attributes. The function units are not constrained, 'lut_limit' is only an estimate. The latencies
+    (in cycles) of the units can be configured:
+    hls4ml.model.optimizer.get_optimizer('symbolicexpression:schedule_expressions').configure(mul_latency=4)
+    '''
+
+    def __init__(self):
+        self.mul_latency = 3
+        self.add_latency = 1
+        self.lut_latency = 2
+
+    def match(self, node):
+        return isinstance(node, SymbolicExpression) and node.get_attr('latency_estimate') is None
+
+    def transform(self, model, node):
+        reuse_factor = model.config.get_reuse_factor(node)
+        node.set_attr('reuse_factor', reuse_factor)
+
+        temps = [(sympy.Symbol(name), sympy.sympify(expr)) for name, expr, _ in node.get_attr('cse_temps', [])]
+        exprs = [sympy.sympify(expr) for expr in node.get_attr('cse_expression', node.get_attr('expression'))]
+        ops, temp_roots, roots = expression_operations(exprs, temps)
+
+        latencies = {'mul': self.mul_latency, 'add': self.add_latency, 'sub': self.add_latency, 'lut': self.lut_latency}
+        start, units, latency = list_schedule(ops, reuse_factor, latencies)
+
+        node.set_attr('multiplier_limit', units.get('mul', 0))
+        node.set_attr('adder_limit', units.get('add', 0))
+        node.set_attr('subtractor_limit', units.get('sub', 0))
+        node.set_attr('lut_limit', units.get('lut', 0))
+        node.set_attr('latency_estimate', latency)
+
+        # The temporaries and outputs are emitted in the order their values are ready
+        def ready(op):
+            return 0 if op is None else start[op] + latencies[ops[op][0]]
+
+        statements = [('temp', i, ready(op)) for i, op in enumerate(temp_roots)]
+        statements += [('output', i, ready(op)) for i, op in enumerate(roots)]
+        node.set_attr('statement_order', [(kind, i) for kind, i, _ in sorted(statements, key=lambda s: s[2])])
+
+        return False
@@ -12,6 +12,12 @@ class SymbolicExpressionBackend(FPGABackend):
         self._register_flows()
 
     def _register_flows(self):
+        optimization_passes = [
+            'symbolicexpression:eliminate_common_subexpressions',
+            'symbolicexpression:schedule_expressions',
+        ]
+        optimization_flow = register_flow('optimize', optimization_passes, requires=None, backend=self.name)
+
         vivado_types = [
             'vivado:transform_types',
         ]
@@ -27,7 +33,7 @@ class SymbolicExpressionBackend(FPGABackend):
         writer_passes = ['make_stamp', 'symbolicexpression:write_hls']
         self._writer_flow = register_flow('write', writer_passes, requires=['vivado:ip'], backend=self.name)
 
-        ip_flow_requirements = [vivado_types_flow, validation_flow, template_flow]
+        ip_flow_requirements = [optimization_flow, vivado_types_flow, validation_flow, template_flow]
         ip_flow_requirements = list(filter(None, ip_flow_requirements))
 
         self._default_flow = register_flow('ip', None, requires=ip_flow_requirements, backend=self.name)
@@ -0,0 +1,153 @@
+import numpy as np
+
+from hls4ml.backends.backend import get_backend
+from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
+from hls4ml.backends.vivado.passes.core_templates import softmax_config_template
+from hls4ml.model.layers import MultiHeadAttention
+
+# Projection templates, one dense config per projection, shared by all heads
+
+mha_mult_config_template = """struct config{index} : nnet::dense_config {{
+    static const unsigned n_in = {n_in};
+    static const unsigned n_out = {n_out};
+    static const unsigned strategy = nnet::{strategy};
+    static const unsigned reuse_factor = {reuse};
+    static const unsigned n_zeros = {nzeros};
+    static const unsigned n_nonzeros = {nonzeros};
+    static const unsigned multiplier_limit = DIV_ROUNDUP(n_in * n_out, reuse_factor) - n_zeros / reuse_factor;
+    static const bool store_weights_in_bram = false;
+    typedef {accum_t.name} accum_t;
+    typedef {bias_t.name} bias_t;
+    typedef {weight_t.name} weight_t;
+    typedef {index_t.name} index_t;
+    template<class x_T, class y_T>
+    using product = nnet::product::{product_type}<x_T, y_T>;
+}};\n"""
+
+# MultiHeadAttention templates
+
+mha_config_template = """struct config{index} : nnet::multiheadattention_config {{
+    typedef {accum_t.name} accum_t;
+    typedef {query_t.name} query_t;
+    typedef {key_t.name} key_t;
+    typedef {value_t.name} value_t;
+    typedef {score_t.name} score_t;
+    typedef {attn_weight_t.name} attn_weight_t;
+    typedef {head_output_t.name} head_output_t;
+    typedef config{index}_query config_query;
+    typedef config{index}_key config_key;
+    typedef config{index}_value config_value;
+    typedef config{index}_attention_output config_attention_output;
+    typedef softmax_config{index} config_softmax;
+    static const unsigned num_heads = {num_heads};
+    static const unsigned head_dim_key = {head_dim_key};
+    static const unsigned head_dim_value = {head_dim_value};
+    static const unsigned feature_dim = {feature_dim};
+    static const unsigned feature_dim_kv = {feature_dim_kv};
+    static const unsigned output_dim = {output_dim};
+    static const unsigned seq_len = {seq_len};
+    static const unsigned seq_len_kv = {seq_len_kv};
+    static const unsigned io_type = nnet::{iotype};
+    static const unsigned reuse_factor = {reuse};
+    static const bool store_weights_in_bram = false;
+    template<class x_T, class y_T>
+    using product = nnet::product::mult<x_T, y_T>;
+}};\n"""
+
+mha_function_template = (
+    'nnet::multiheadattention<{input_t}, {output_t}, {config}>'
+    '({input}, {output}, {wq}, {bq}, {wk}, {bk}, {wv}, {bv}, {wo}, {bo});'
+)
+mha_kv_function_template = (
+    'nnet::multiheadattention<{input_t}, {input_kv_t}, {output_t}, {config}>'
+    '({input}, {input_kv}, {output}, {wq}, {bq}, {wk}, {bk}, {wv}, {bv}, {wo}, {bo});'
+)
+
+mha_include_list = ['nnet_utils/nnet_multiheadattention.h', 'nnet_utils/nnet_multiheadattention_stream.h']
+
+
+class MultiHeadAttentionConfigTemplate(LayerConfigTemplate):
+    def __init__(self):
+        super().__init__(MultiHeadAttention)
+        self.template = mha_config_template
+        self.mult_template = mha_mult_config_template
+        self.softmax_template = softmax_config_template
+
+    def _format_mult_config(self, node, proj, n_in, n_out, input_precision):
+        weight = node.get_weights(proj + '_weight')
+        # The heads share the config, so only the zeros that every head has can be skipped
+        per_head = weight.data.reshape(-1, n_in * n_out) if proj != 'attention_output' else weight.data.reshape(1, -1)
+        nzeros = int(np.min(np.sum(per_head == 0, axis=1)))
+
+        params = self._default_config_params(node)
+        params['index'] = f'{node.index}_{proj}'
+        params['n_in'] = n_in
+        params['n_out'] = n_out
+        params['reuse'] = node.get_attr(proj + '_reuse_factor')
+        params['nzeros'] = nzeros
+        params['nonzeros'] = n_in * n_out - nzeros
+        params['weight_t'] = weight.type
+        params['bias_t'] = node.get_weights(proj + '_bias').type
+        params['product_type'] = get_backend('vivado').product_type(input_precision, weight.type.precision)
+
+        return self.mult_template.format(**params)
+
+    def format(self, node):
+        params = self._default_config_params(node)
+        mha_config = self.template.format(**params)
+
+        in_precision = node.get_input_variable(node.inputs[0]).type.precision
+        kv_precision = node.get_input_variable(node.inputs[-1]).type.precision
+        num_heads = node.get_attr('num_heads')
+        head_dim_key = node.get_attr('head_dim_key')
+        head_dim_value = node.get_attr('head_dim_value')
+        feature_dim = node.get_attr('feature_dim')
+        feature_dim_kv = node.get_attr('feature_dim_kv')
+
+        mult_configs = [
+            self._format_mult_config(node, 'query', feature_dim, head_dim_key, in_precision),
+            self._format_mult_config(node, 'key', feature_dim_kv, head_dim_key, kv_precision),
+            self._format_mult_config(node, 'value', feature_dim_kv, head_dim_value, kv_precision),
+            self._format_mult_config(
+                node,
+                'attention_output',
+                num_heads * head_dim_value,
+                node.get_attr('output_dim'),
+                node.get_attr('head_output_t').precision,
+            ),
+        ]
+
+        softmax_params = self._default_config_params(node)
+        softmax_params['type'] = 'softmax'
+        softmax_params['n_in'] = node.get_attr('seq_len_kv')
+        softmax_params['iotype'] = 'io_parallel'
+        softmax_params['axis'] = -1
+        softmax_params['implementation'] = 'stable'
+        softmax_config = self.softmax_template.format(**softmax_params)
+
+        return '\n'.join(mult_configs) + '\n' + softmax_config + '\n' + mha_config
+
+
+class MultiHeadAttentionFunctionTemplate(FunctionCallTemplate):
+    def __init__(self):
+        super().__init__(MultiHeadAttention, include_header=mha_include_list)
+        self.template = mha_function_template
+        self.kv_template = mha_kv_function_template
+
+    def format(self, node):
+        params = self._default_function_params(node)
+        params['wq'] = node.get_weights('query_weight').name
+        params['bq'] = node.get_weights('query_bias').name
+        params['wk'] = node.get_weights('key_weight').name
+        params['bk'] = node.get_weights('key_bias').name
+        params['wv'] = node.get_weights('value_weight').name
+        params['bv'] = node.get_weights('value_bias').name
+        params['wo'] = node.get_weights('attention_output_weight').name
+        params['bo'] = node.get_weights('attention_output_bias').name
+
+        if len(node.inputs) == 1:
+            return self.template.format(**params)
+
+        params['input_kv_t'] = node.get_input_variable(node.inputs[1]).type.name
+        params['input_kv'] = node.get_input_variable(node.inputs[1]).name
+        return self.kv_template.format(**params)
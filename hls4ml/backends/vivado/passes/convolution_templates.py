@@ -1,5 +1,7 @@
 from hls4ml.backends.backend import get_backend
 from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
+from hls4ml.backends.vivado.passes.core_templates import format_fused_activation
+from hls4ml.backends.vivado.passes.pooling_templates import pooling2d_config_template
 from hls4ml.model.layers import (
     Conv1D,
     Conv2D,
@@ -91,7 +93,7 @@ class Conv1DConfigTemplate(LayerConfigTemplate):
         else:
             params['fill_fn'] = 'FillConv1DBuffer'
 
-        conv_config = self.template.format(**params)
+        conv_config = format_fused_activation(node, self.template.format(**params))
 
         mult_params = self._default_config_params(node)
         mult_params['n_in'] = node.get_attr('n_chan') * node.get_attr('filt_width')
@@ -169,11 +171,46 @@ conv2d_config_template = """struct config{index} : nnet::conv2d_config {{
 const ap_uint<config{index}::filt_height * config{index}::filt_width> config{index}::pixels[] = {{{instructions}}};\n"""
 
 conv2d_function_template = 'nnet::conv_2d_{data_format}<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
+conv2d_pool_function_template = (
+    'nnet::conv_2d_pool_{data_format}<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
+)
 depthconv2d_function_template = (
     'nnet::depthwise_conv_2d_{data_format}<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
 )
 
-conv2d_include_list = ['nnet_utils/nnet_conv2d.h', 'nnet_utils/nnet_conv2d_stream.h']
+conv2d_include_list = ['nnet_utils/nnet_conv2d.h', 'nnet_utils/nnet_conv2d_stream.h', 'nnet_utils/nnet_conv2d_pool_stream.h']
+
+fused_pool_template = """
+    typedef config{index}_pool pool_config;
+    typedef {conv_out_t.name} conv_out_t;"""
+
+
+def format_fused_pool(node, layer_config):
+    if not node.get_attr('fused_pool', False):
+        return layer_config
+
+    params = {key: val for key, val in node.attributes.items()}
+    params['index'] = f'{node.index}_pool'
+    params['in_height'] = node.get_attr('out_height')
+    params['in_width'] = node.get_attr('out_width')
+    params['out_height'] = node.get_attr('pool_out_height')
+    params['out_width'] = node.get_attr('pool_out_width')
+    params['stride_height'] = node.get_attr('pool_height')
+    params['stride_width'] = node.get_attr('pool_width')
+    for pad in ['pad_top', 'pad_bottom', 'pad_left', 'pad_right']:
+        params[pad] = 0
+    params['count_pad'] = 'false'
+    params['implementation'] = 'linebuffer'
+    params['reuse'] = node.get_attr('reuse_factor')
+    params['accum_t'] = node.get_attr('pool_accum_t')
+    pool_config = pooling2d_config_template.format(**params)
+
+    # Add the pooling config to the end of the layer config struct, which follows the config of a fused activation
+    head, _, tail = layer_config.rpartition('\n};')
+    fused_pool = fused_pool_template.format(index=node.index, conv_out_t=node.get_attr('conv_out_t'))
+    layer_config = head + fused_pool + '\n};' + tail
+
+    return pool_config + '\n' + layer_config
 
 
 class Conv2DConfigTemplate(LayerConfigTemplate):
@@ -204,7 +241,8 @@ class Conv2DConfigTemplate(LayerConfigTemplate):
         else:
             params['fill_fn'] = 'FillConv2DBuffer'
 
-        conv_config = self.template.format(**params)
+        conv_config = format_fused_activation(node, self.template.format(**params))
+        conv_config = format_fused_pool(node, conv_config)
 
         mult_params = self._default_config_params(node)
         mult_params['n_in'] = node.get_attr('n_chan') * node.get_attr('filt_height') * node.get_attr('filt_width')
@@ -229,6 +267,9 @@ class Conv2DFunctionTemplate(FunctionCallTemplate):
         params['w'] = node.get_weights('weight').name
         params['b'] = node.get_weights('bias').name
 
+        if node.get_attr('fused_pool', False):
+            return conv2d_pool_function_template.format(**params)
+
         return self.template.format(**params)
 
 
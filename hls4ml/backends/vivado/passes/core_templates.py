@@ -1,6 +1,15 @@
 from hls4ml.backends.backend import get_backend
 from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
-from hls4ml.model.layers import Activation, BatchNormalization, Dense, HardActivation, ParametrizedActivation, PReLU, Softmax
+from hls4ml.model.layers import (
+    Activation,
+    BatchNormalization,
+    Dense,
+    HardActivation,
+    LayerNormalization,
+    ParametrizedActivation,
+    PReLU,
+    Softmax,
+)
 
 # Dense templates
 
@@ -22,9 +31,38 @@ dense_config_template = """struct config{index} : nnet::dense_config {{
     using product = nnet::product::{product_type}<x_T, y_T>;
 }};\n"""
 
+dense_block_sparse_config_template = """struct config{index} : nnet::dense_block_sparse_config {{
+    static const unsigned n_in = {n_in};
+    static const unsigned n_out = {n_out};
+    static const unsigned io_type = nnet::{iotype};
+    static const unsigned strategy = nnet::resource;
+    static const unsigned reuse_factor = {reuse};
+    static const unsigned block_in = {block_in};
+    static const unsigned block_out = {block_out};
+    static const unsigned n_blocks = {n_blocks};
+    static const unsigned n_zeros = {nzeros};
+    static const unsigned n_nonzeros = {nonzeros};
+    static const unsigned multiplier_limit = n_blocks / reuse_factor * block_in * block_out;
+    static const bool store_weights_in_bram = false;
+    typedef {accum_t.name} accum_t;
+    typedef {bias_t.name} bias_t;
+    typedef {weight_t.name} weight_t;
+    typedef {block_index_t} index_t;
+    template<class x_T, class y_T>
+    using product = nnet::product::{product_type}<x_T, y_T>;
+}};\n"""
+
 dense_function_template = 'nnet::dense<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b});'
+dense_block_sparse_function_template = (
+    'nnet::dense_block_sparse<{input_t}, {output_t}, {config}>({input}, {output}, {w}, {b}, {bi}, {bo});'
+)
 
-dense_include_list = ['nnet_utils/nnet_dense.h', 'nnet_utils/nnet_dense_compressed.h', 'nnet_utils/nnet_dense_stream.h']
+dense_include_list = [
+    'nnet_utils/nnet_dense.h',
+    'nnet_utils/nnet_dense_block_sparse.h',
+    'nnet_utils/nnet_dense_compressed.h',
+    'nnet_utils/nnet_dense_stream.h',
+]
 
 
 class DenseConfigTemplate(LayerConfigTemplate):
@@ -40,7 +78,11 @@ class DenseConfigTemplate(LayerConfigTemplate):
             node.get_input_variable().type.precision, node.get_weights('weight').type.precision
         )
 
-        return self.template.format(**params)
+        if node.get_attr('strategy') == 'block_sparse':
+            params['block_index_t'] = node.get_weights('block_in_index').type.name
+            return format_fused_activation(node, dense_block_sparse_config_template.format(**params))
+
+        return format_fused_activation(node, self.template.format(**params))
 
 
 class DenseFunctionTemplate(FunctionCallTemplate):
@@ -53,6 +95,11 @@ class DenseFunctionTemplate(FunctionCallTemplate):
         params['w'] = node.get_weights('weight').name
         params['b'] = node.get_weights('bias').name
 
+        if node.get_attr('strategy') == 'block_sparse':
+            params['bi'] = node.get_weights('block_in_index').name
+            params['bo'] = node.get_weights('block_out_index').name
+            return dense_block_sparse_function_template.format(**params)
+
         return self.template.format(**params)
 
 
@@ -105,6 +152,63 @@ class BatchNormalizationFunctionTemplate(FunctionCallTemplate):
         return self.template.format(**params)
 
 
+# LayerNormalization templates
+
+layernorm_config_template = """struct config{index} : nnet::layernorm_config {{
+    static const unsigned n_in = {n_in};
+    static const unsigned seq_len = {seq_len};
+    static const unsigned table_size = {table_size};
+    static const unsigned io_type = nnet::{iotype};
+    static const unsigned reuse_factor = {reuse};
+    static const unsigned multiplier_limit = DIV_ROUNDUP({n_mult}, reuse_factor);
+    static const bool store_weights_in_bram = false;
+    static const double epsilon;
+    typedef {accum_t.name} accum_t;
+    typedef {bias_t.name} bias_t;
+    typedef {scale_t.name} scale_t;
+    typedef {table_t.name} table_t;
+    template<class x_T, class y_T>
+    using product = nnet::product::{product_type}<x_T, y_T>;
+}};
+const double config{index}::epsilon = {epsilon};\n"""
+
+layernorm_function_template = 'nnet::layernormalize<{input_t}, {output_t}, {config}>({input}, {output}, {scale}, {bias});'
+
+layernorm_include_list = ['nnet_utils/nnet_layernorm.h', 'nnet_utils/nnet_layernorm_stream.h']
+
+
+class LayerNormalizationConfigTemplate(LayerConfigTemplate):
+    def __init__(self):
+        super().__init__(LayerNormalization)
+        self.template = layernorm_config_template
+
+    def format(self, node):
+        params = self._default_config_params(node)
+        # io_parallel normalizes all rows at once, io_stream one row at a time
+        if node.model.config.get_config_value('IOType') == 'io_parallel':
+            params['n_mult'] = node.get_attr('n_in') * node.get_attr('seq_len')
+        else:
+            params['n_mult'] = node.get_attr('n_in')
+        params['product_type'] = get_backend('vivado').product_type(
+            node.get_attr('accum_t').precision, node.get_weights('scale').type.precision
+        )
+
+        return self.template.format(**params)
+
+
+class LayerNormalizationFunctionTemplate(FunctionCallTemplate):
+    def __init__(self):
+        super().__init__(LayerNormalization, include_header=layernorm_include_list)
+        self.template = layernorm_function_template
+
+    def format(self, node):
+        params = self._default_function_params(node)
+        params['scale'] = node.get_weights('scale').name
+        params['bias'] = node.get_weights('bias').name
+
+        return self.template.format(**params)
+
+
 # Activation templates
 
 activ_config_template = """struct {type}_config{index} : nnet::activ_config {{
@@ -141,6 +245,45 @@ param_activ_function_template = 'nnet::{activation}<{input_t}, {output_t}, {conf
 
 activ_include_list = ['nnet_utils/nnet_activation.h', 'nnet_utils/nnet_activation_stream.h']
 
+# Activations fused into the output of Dense and convolution layers by the fuse_stream_activation pass
+
+param_activ_config_template = """struct {type}_config{index} : nnet::activ_config {{
+    static const unsigned n_in = {n_in};
+    static const unsigned io_type = nnet::{iotype};
+    static const unsigned reuse_factor = {reuse};
+    static const double alpha;
+}};
+const double {type}_config{index}::alpha = {activ_param};\n"""
+
+fused_activ_template = """
+    typedef {preact_t.name} preact_t;
+    template<class x_T, class y_T>
+    using activation = nnet::fused_activation::{type}<x_T, y_T, {type}_config{index}>;"""
+
+
+def format_fused_activation(node, layer_config):
+    activation = node.get_attr('fused_activation')
+    if activation is None:
+        return layer_config
+
+    params = {key: val for key, val in node.attributes.items()}
+    params['type'] = activation
+    params['n_in'] = node.get_output_variable().shape[-1]
+    params['iotype'] = node.model.config.get_config_value('IOType')
+    params['reuse'] = node.get_attr('reuse_factor')
+
+    if activation in ['hard_sigmoid', 'hard_tanh']:
+        activ_config = hard_activ_config_template.format(**params)
+    elif activation == 'leaky_relu':
+        activ_config = param_activ_config_template.format(**params)
+    else:
+        activ_config = activ_config_template.format(**params)
+
+    # Add the activation to the end of the layer config struct
+    layer_config = layer_config.replace('\n};', fused_activ_template.format(**params) + '\n};', 1)
+
+    return activ_config + '\n' + layer_config
+
 
 class ActivationConfigTemplate(LayerConfigTemplate):
     def __init__(self):
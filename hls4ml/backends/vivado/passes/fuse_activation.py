@@ -0,0 +1,78 @@
+from hls4ml.model.layers import (
+    Activation,
+    Conv1D,
+    Conv2D,
+    Dense,
+    DepthwiseConv1D,
+    DepthwiseConv2D,
+    ParametrizedActivation,
+)
+from hls4ml.model.optimizer import OptimizerPass
+
+# Activations with an element-wise implementation in nnet_activation_fused.h
+fusable_activations = [
+    'linear',
+    'relu',
+    'relu6',
+    'relu1',
+    'leaky_relu',
+    'sigmoid',
+    'tanh',
+    'hard_sigmoid',
+    'hard_tanh',
+]
+
+# Attributes of the activation layer used by its config, moved to the parent layer
+fused_activation_attrs = ['table_size', 'table_t', 'activ_param', 'slope', 'shift', 'slope_t', 'shift_t']
+
+
+def get_activation_function(node):
+    if isinstance(node, ParametrizedActivation):
+        return node._get_act_function_name()
+    else:
+        return node.get_attr('activation').lower()
+
+
+class FuseStreamActivation(OptimizerPass):
+    '''Fuses an element-wise activation into the output stage of the preceding Dense or convolution layer in io_stream.
+
+    The parent layer computes its result in its own precision (stored as ``preact_t``), applies the activation while
+    packing the output and writes it directly in the precision of the activation layer. This removes the activation
+    layer and the FIFO between the two layers.
+
+    The fused activation no longer exists as a separate layer (e.g. for tracing, profiling or its own precision), so
+    the fusion is only done if enabled with ``FuseActivation: True`` in the configuration of the parent layer.
+    '''
+
+    def match(self, node):
+        if node.model.config.get_config_value('IOType') != 'io_stream':
+            return False
+        if not isinstance(node, Activation) or get_activation_function(node) not in fusable_activations:
+            return False
+
+        parent = node.get_input_node()
+        if not isinstance(parent, (Dense, Conv1D, Conv2D)) or isinstance(parent, (DepthwiseConv1D, DepthwiseConv2D)):
+            return False
+        if not parent.get_attr('fuse_activation', False) or parent.get_attr('fused_activation') is not None:
+            return False
+
+        # The intermediate result must not be used anywhere else
+        parent_map = parent.get_output_use_map()
+        return len(parent_map[parent.outputs[0]]) == 1 and parent.outputs[0] not in node.model.outputs
+
+    def transform(self, model, node):
+        parent = node.get_input_node()
+        parent_var = parent.get_output_variable()
+
+        parent.set_attr('preact_t', parent_var.type)
+        parent_var.type = node.get_output_variable().type
+        parent.set_attr('result_t', parent_var.type)
+
+        parent.set_attr('fused_activation', get_activation_function(node))
+        for attr in fused_activation_attrs:
+            if attr in node.attributes:
+                parent.set_attr(attr, node.get_attr(attr))
+
+        model.remove_node(node, rewire=True)
+
+        return True
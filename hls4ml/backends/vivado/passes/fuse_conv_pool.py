@@ -0,0 +1,65 @@
+from hls4ml.model.layers import Conv2D, DepthwiseConv2D, Pooling2D
+from hls4ml.model.optimizer import OptimizerPass
+from hls4ml.model.types import NamedType
+
+
+class FuseStreamConvPool(OptimizerPass):
+    '''Fuses a non-overlapping Pooling2D layer into the preceding line buffer Conv2D layer in io_stream.
+
+    The convolution reduces its outputs into the pooling windows as they are produced and only writes the pooled pixels
+    (see nnet_conv2d_pool_stream.h). The output of the convolution is kept in its own precision (stored as
+    ``conv_out_t``) before pooling. This removes the pooling layer, its line buffers and the FIFO between the two layers.
+
+    The pooling layer no longer exists as a separate layer (e.g. for tracing, profiling or its own precision), so the
+    fusion is only done if enabled with ``FusePool: True`` in the configuration of the convolution.
+    '''
+
+    def match(self, node):
+        if node.model.config.get_config_value('IOType') != 'io_stream':
+            return False
+        if not isinstance(node, Pooling2D) or node.get_attr('data_format') != 'channels_last':
+            return False
+        if any(node.get_attr(pad) != 0 for pad in ['pad_top', 'pad_bottom', 'pad_left', 'pad_right']):
+            return False
+        if node.get_attr('pool_height') != node.get_attr('stride_height'):
+            return False
+        if node.get_attr('pool_width') != node.get_attr('stride_width'):
+            return False
+
+        parent = node.get_input_node()
+        if not isinstance(parent, Conv2D) or isinstance(parent, DepthwiseConv2D):
+            return False
+        if not parent.get_attr('fuse_pool', False) or parent.get_attr('fused_pool', False):
+            return False
+        if parent.get_attr('data_format') != 'channels_last':
+            return False
+        if parent.get_attr('conv_implementation', 'LineBuffer').lower() != 'linebuffer':
+            return False
+        # Pointwise convolutions and 1xN kernels don't use the line buffer
+        if parent.get_attr('filt_height') < 2:
+            return False
+
+        # The intermediate result must not be used anywhere else
+        parent_map = parent.get_output_use_map()
+        return len(parent_map[parent.outputs[0]]) == 1 and parent.outputs[0] not in node.model.outputs
+
+    def transform(self, model, node):
+        parent = node.get_input_node()
+
+        parent.set_attr('conv_out_t', parent.get_output_variable().type)
+        parent.set_attr('fused_pool', True)
+        parent.set_attr('pool_op', node.get_attr('pool_op'))
+        parent.set_attr('pool_height', node.get_attr('pool_height'))
+        parent.set_attr('pool_width', node.get_attr('pool_width'))
+        parent.set_attr('pool_out_height', node.get_attr('out_height'))
+        parent.set_attr('pool_out_width', node.get_attr('out_width'))
+        # The pooling accumulator is widened by the backend, it must not share its name with the accumulator of the conv
+        pool_accum_t = NamedType(f'layer{parent.index}_pool_accum_t', node.get_attr('accum_t').precision)
+        parent.set_attr('pool_accum_t', pool_accum_t)
+
+        pool_var = node.get_output_variable()
+        model.remove_node(node, rewire=True)
+        model.register_output_variable(parent.outputs[0], pool_var)
+        parent.set_attr(parent.outputs[0], pool_var)
+
+        return True
@@ -62,7 +62,7 @@ garnet_function_template = (
     'nnet::garnet{impl}<{input_t}, {integer_input_t}, {output_t}, {config}>({input}, {nvtx}, {output});'
 )
 
-garnet_include_list = ['nnet_utils/nnet_garnet.h']
+garnet_include_list = ['nnet_utils/nnet_garnet.h', 'nnet_utils/nnet_garnet_stream.h']
 
 
 class GarNetConfigTemplate(LayerConfigTemplate):
@@ -116,7 +116,11 @@ class GarNetConfigTemplate(LayerConfigTemplate):
                 params[f'{vname}_t'] = precision_converter.convert(default_precision).definition_cpp()
             else:
                 params[f'{vname}_t'] = precision_converter.convert(params[f'{vname}_t']).definition_cpp()
-        params['output_t'] = node.get_output_variable().type.name
+        if node.model.config.get_config_value('IOType') == 'io_stream':
+            # The stream type packs the features of a vertex, the internal output type is the type of one feature
+            params['output_t'] = node.get_output_variable().type.precision.definition_cpp()
+        else:
+            params['output_t'] = node.get_output_variable().type.name
 
         if node.attributes['collapse'] in ['mean', 'max']:
             params['collapse_type'] = 'collapse_{}'.format(node.attributes['collapse'])
@@ -1,3 +1,5 @@
+import numpy as np
+
 from hls4ml.backends.backend import get_backend
 from hls4ml.backends.template import FunctionCallTemplate, LayerConfigTemplate
 from hls4ml.model.layers import Concatenate, Dot, Merge
@@ -8,11 +10,47 @@ merge_config_template = """struct config{index} : nnet::merge_config {{
     static const unsigned n_elem = {n_elem};
 }};\n"""
 
+merge_nary_config_template = """struct config{index} : nnet::merge_config {{
+    static const unsigned n_elem = {n_elem};
+    static const unsigned n_inputs = {n_inputs};
+    typedef {accum_t} accum_t;
+}};\n"""
+
 merge_function_template = 'nnet::{merge}<{input1_t}, {input2_t}, {output_t}, {config}>({input1}, {input2}, {output});'
+merge_nary_function_template = 'nnet::{merge}_n<{output_t}, {config}>({output}, {inputs});'
 
 merge_include_list = ['nnet_utils/nnet_merge.h', 'nnet_utils/nnet_merge_stream.h']
 
 
+def check_output_pack(node):
+    '''Checks the OutputPack of a merge, the number of input packs (pixels) written in a single output pack.'''
+    output_pack = node.get_attr('output_pack', 1)
+    if output_pack == 1:
+        return
+
+    if node.model.config.get_config_value('IOType') != 'io_stream':
+        raise Exception(f'OutputPack of layer {node.name} is only supported in io_stream')
+    if isinstance(node, (Concatenate, Dot)) or len(node.inputs) <= 2:
+        raise Exception(f'OutputPack of layer {node.name} is only supported by element-wise merges of more than two inputs')
+    shape = node.get_output_variable().shape
+    if (np.prod(shape) // shape[-1]) % output_pack != 0:
+        raise Exception(f'OutputPack of layer {node.name} must divide the number of input packs ({shape[:-1]})')
+
+    # The consumers read the packs in lockstep, all their inputs must have the same packing
+    for layer in node.model.get_layers():
+        if node.outputs[0] not in layer.inputs:
+            continue
+        is_nary_merge = isinstance(layer, Merge) and not isinstance(layer, (Concatenate, Dot)) and len(layer.inputs) > 2
+        same_packing = is_nary_merge and all(
+            layer.get_input_node(inp).get_attr('output_pack', 1) == output_pack for inp in layer.inputs
+        )
+        if not same_packing or layer.get_attr('output_pack', 1) % output_pack != 0:
+            raise Exception(
+                f'Output of layer {node.name} with OutputPack {output_pack} can only be used by N-ary merges of inputs '
+                f'with the same OutputPack, and a multiple of it as their own OutputPack, not by {layer.name}'
+            )
+
+
 class MergeConfigTemplate(LayerConfigTemplate):
     def __init__(self):
         super().__init__(Merge)
@@ -22,6 +60,14 @@ class MergeConfigTemplate(LayerConfigTemplate):
         params = self._default_config_params(node)
         params['n_elem'] = node.get_input_variable(node.inputs[0]).size_cpp()
 
+        check_output_pack(node)
+
+        if len(node.inputs) > 2:
+            params['n_inputs'] = len(node.inputs)
+            accum_t = node.get_attr('accum_t')
+            params['accum_t'] = accum_t.name if accum_t is not None else node.get_output_variable().type.name
+            return merge_nary_config_template.format(**params)
+
         return self.template.format(**params)
 
 
@@ -34,6 +80,16 @@ class MergeFunctionTemplate(FunctionCallTemplate):
         params = {}
         params['merge'] = node.get_attr('op').lower()
         params['config'] = f'config{node.index}'
+
+        if len(node.inputs) > 2:
+            # Concatenation of any rank is handled by the same N-ary function
+            if isinstance(node, Concatenate):
+                params['merge'] = 'concatenate'
+            params['output_t'] = node.get_output_variable().type.name
+            params['output'] = node.get_output_variable().name
+            params['inputs'] = ', '.join(node.get_input_variable(inp).name for inp in node.inputs)
+            return merge_nary_function_template.format(**params)
+
         params['input1_t'] = node.get_input_variable(node.inputs[0]).type.name
         params['input2_t'] = node.get_input_variable(node.inputs[1]).type.name
         params['output_t'] = node.get_output_variable().type.name
@@ -86,6 +142,13 @@ concat_config_template = """struct config{index} : nnet::concat_config {{
     static const int axis = {axis};
 }};\n"""
 
+concat_nary_config_template = """struct config{index} : nnet::concat_n_config {{
+    static const unsigned n_outer = {n_outer};
+    static const unsigned n_inner = {n_inner};
+    static const unsigned n_axis = {n_axis};
+    typedef nnet::concat_sizes<{axis_sizes}> axis_sizes;
+}};\n"""
+
 
 class ConcatenateConfigTemplate(LayerConfigTemplate):
     def __init__(self):
@@ -94,6 +157,10 @@ class ConcatenateConfigTemplate(LayerConfigTemplate):
 
     def format(self, node):
         params = self._default_config_params(node)
+
+        if len(node.inputs) > 2:
+            return self._format_nary(node, params)
+
         for i in range(3):
             params.setdefault(f'n_elem1_{i}', 0)
             params.setdefault(f'n_elem2_{i}', 0)
@@ -104,3 +171,15 @@ class ConcatenateConfigTemplate(LayerConfigTemplate):
             params[f'n_elem2_{i}'] = s2
 
         return self.template.format(**params)
+
+    def _format_nary(self, node, params):
+        inps = [node.get_input_variable(inp) for inp in node.inputs]
+        shape = node.get_output_variable().shape
+        axis = node.get_attr('axis')
+        axis = axis - 1 if axis > 0 else len(shape) + axis
+        params['n_outer'] = int(np.prod(shape[:axis]))
+        params['n_inner'] = int(np.prod(shape[axis + 1 :]))
+        params['n_axis'] = shape[axis]
+        params['axis_sizes'] = ', '.join(str(inp.shape[axis]) for inp in inps)
+
+        return concat_nary_config_template.format(**params)
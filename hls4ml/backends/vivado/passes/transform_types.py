@@ -28,7 +28,9 @@ class TransformTypes(GlobalOptimizerPass):
                 if isinstance(var, InplaceTensorVariable):
                     new_var = self.inplace_stream_var_converter.convert(var)
                 else:
-                    new_var = self.stream_var_converter.convert(var)
+                    depth = node.get_attr('fifo_depth_hints', {}).get(out_name, 0)
+                    n_pack = node.get_attr('output_pack', 1) if out_name in node.outputs else 1
+                    new_var = self.stream_var_converter.convert(var, n_pack=n_pack, depth=depth)
             elif io_type == 'io_serial':
                 new_var = self.array_var_converter.convert(var, pragma='stream')
             elif io_type == 'io_parallel':
@@ -20,6 +20,8 @@ from hls4ml.model.layers import (
     GlobalPooling1D,
     GlobalPooling2D,
     Layer,
+    Merge,
+    MultiHeadAttention,
     Pooling1D,
     Pooling2D,
     SeparableConv1D,
@@ -28,7 +30,14 @@ from hls4ml.model.layers import (
     Softmax,
 )
 from hls4ml.model.optimizer import get_backend_passes, layer_optimizer
-from hls4ml.model.types import FixedPrecisionType, IntegerPrecisionType, NamedType, PackedType
+from hls4ml.model.types import (
+    FixedPrecisionType,
+    IntegerPrecisionType,
+    NamedType,
+    PackedType,
+    RoundingMode,
+    SaturationMode,
+)
 from hls4ml.report import parse_vivado_report
 from hls4ml.utils.fixed_point_utils import ceil_log2
 
@@ -64,8 +73,26 @@ class VivadoBackend(FPGABackend):
         for layer in pf_layers:
             attrs = self.attribute_map.get(layer, [])
             attrs.append(ConfigurableAttribute('parallelization_factor', default=1))
+            # io_parallel im2col buffer, explicit assignments or a table of input indices (smaller code for large inputs)
+            attrs.append(ChoiceAttribute('buffer_fill', choices=['Unrolled', 'Table'], default='Unrolled'))
             self.attribute_map[layer] = attrs
 
+        # Opt-in fusion of the following activation into the output stage of the layer (io_stream)
+        for layer in [Dense, Conv1D, Conv2D]:
+            attrs = self.attribute_map.get(layer, [])
+            attrs.append(ConfigurableAttribute('fuse_activation', value_type=bool, default=False))
+            self.attribute_map[layer] = attrs
+
+        # Opt-in fusion of the following non-overlapping pooling into the line buffer of the convolution (io_stream)
+        conv2d_attrs = self.attribute_map.get(Conv2D, [])
+        conv2d_attrs.append(ConfigurableAttribute('fuse_pool', value_type=bool, default=False))
+        self.attribute_map[Conv2D] = conv2d_attrs
+
+        # Number of input packs written in one output pack by the streaming N-ary merges
+        merge_attrs = self.attribute_map.get(Merge, [])
+        merge_attrs.append(ConfigurableAttribute('output_pack', default=1))
+        self.attribute_map[Merge] = merge_attrs
+
         # Add ConvImplementation to Convolution+Pooling layers
         cnn_layers = [Conv1D, Conv2D, SeparableConv1D, SeparableConv2D, DepthwiseConv2D, Pooling1D, Pooling2D]
 
@@ -81,6 +108,23 @@ class VivadoBackend(FPGABackend):
             attrs.append(TypeAttribute('dw_output', default=FixedPrecisionType(18, 8)))
             self.attribute_map[layer] = attrs
 
+        # Lookup tables of the softmax over the attention scores
+        mha_attrs = self.attribute_map.get(MultiHeadAttention, [])
+        mha_attrs.append(ConfigurableAttribute('table_size', default=1024))
+        mha_attrs.append(
+            TypeAttribute(
+                'exp_table',
+                default=FixedPrecisionType(18, 8, rounding_mode=RoundingMode.RND, saturation_mode=SaturationMode.SAT),
+            )
+        )
+        mha_attrs.append(
+            TypeAttribute(
+                'inv_table',
+                default=FixedPrecisionType(18, 8, rounding_mode=RoundingMode.RND, saturation_mode=SaturationMode.SAT),
+            )
+        )
+        self.attribute_map[MultiHeadAttention] = mha_attrs
+
     def _register_flows(self):
         initializers = self._get_layer_initializers()
         init_flow = register_flow('init_layers', initializers, requires=['optimize'], backend=self.name)
@@ -96,6 +140,7 @@ class VivadoBackend(FPGABackend):
 
         quantization_passes = [
             'vivado:merge_batch_norm_quantized_tanh',
+            'vivado:merge_batch_norm_quantized_activation',
             'vivado:quantize_dense_output',
             'fuse_consecutive_batch_normalization',
             'vivado:xnor_pooling',
@@ -105,6 +150,8 @@ class VivadoBackend(FPGABackend):
         optimization_passes = [
             'vivado:remove_final_reshape',
             'vivado:optimize_pointwise_conv',
+            'vivado:fuse_stream_activation',
+            'vivado:fuse_stream_conv_pool',
             'vivado:inplace_parallel_reshape',
             'vivado:inplace_stream_flatten',
             'vivado:skip_softmax',
@@ -236,7 +283,12 @@ class VivadoBackend(FPGABackend):
     def init_dense(self, layer):
         index_t = IntegerPrecisionType(width=1, signed=False)
         compression = layer.model.config.get_compression(layer)
-        if layer.model.config.is_resource_strategy(layer):
+        block_shape = layer.model.config.get_layer_config_value(layer, 'BlockShape')
+        if layer.model.config.is_resource_strategy(layer) and block_shape is not None:
+            self.set_target_reuse_factor(layer)
+            layer.set_attr('strategy', 'block_sparse')
+            index_t = self._init_block_sparse_weights(layer, block_shape)
+        elif layer.model.config.is_resource_strategy(layer):
             n_in, n_out = self.get_layer_mult_size(layer)
             self.set_target_reuse_factor(layer)
             self.set_closest_reuse_factor(layer, n_in, n_out)
@@ -249,6 +301,57 @@ class VivadoBackend(FPGABackend):
             layer.set_attr('strategy', 'latency')
         layer.set_attr('index_t', NamedType(f'layer{layer.index}_index', index_t))
 
+    def _init_block_sparse_weights(self, layer, block_shape):
+        """Removes the zero blocks of the weights of a Dense layer and orders the remaining blocks for
+        nnet::dense_block_sparse, in which every word of the reshaped weights holds the blocks of one reuse cycle.
+        Returns the precision of the block indices."""
+        block_in, block_out = block_shape
+        n_in = layer.get_attr('n_in')
+        n_out = layer.get_attr('n_out')
+        if n_in % block_in != 0 or n_out % block_out != 0:
+            raise Exception(
+                f'The BlockShape {tuple(block_shape)} of layer {layer.name} does not divide its weights ({n_in}, {n_out})'
+            )
+
+        weights = layer.get_weights('weight')
+        data = weights.data.reshape(n_in // block_in, block_in, n_out // block_out, block_out).transpose(0, 2, 1, 3)
+        nonzero = np.argwhere(np.any(data != 0, axis=(2, 3)))
+        n_nonzero = max(len(nonzero), 1)
+
+        # The stored blocks are padded with zero blocks to a multiple of the reuse factor
+        reuse_factor = min(int(layer.get_attr('reuse_factor')), n_nonzero)
+        layer.set_attr('reuse_factor', reuse_factor)
+        n_blocks = int(np.ceil(n_nonzero / reuse_factor)) * reuse_factor
+        block_size = block_in * block_out
+        blocks = np.zeros((n_blocks, block_size), dtype=weights.data.dtype)
+        block_in_index = np.zeros(n_blocks, dtype=int)
+        block_out_index = np.zeros(n_blocks, dtype=int)
+        blocks[: len(nonzero)] = data[nonzero[:, 0], nonzero[:, 1]].reshape(-1, block_size)
+        block_in_index[: len(nonzero)] = nonzero[:, 0]
+        block_out_index[: len(nonzero)] = nonzero[:, 1]
+
+        # Element e of block ib * RF + ir is stored at (ib * block_size + e) * RF + ir
+        ordered = blocks.reshape(n_blocks // reuse_factor, reuse_factor, block_size).transpose(0, 2, 1).reshape(-1)
+        weights.data = ordered
+        weights.shape = [len(ordered)]
+        weights.data_length = len(ordered)
+        weights.nonzeros = np.count_nonzero(ordered)
+        weights.nzeros = weights.data_length - weights.nonzeros
+
+        n_index = max(n_in // block_in, n_out // block_out)
+        index_t = IntegerPrecisionType(width=max((n_index - 1).bit_length(), 1), signed=False)
+        layer.add_weights_variable(name='block_in_index', var_name='bi{index}', precision=index_t, data=block_in_index)
+        layer.add_weights_variable(name='block_out_index', var_name='bo{index}', precision=index_t, data=block_out_index)
+        layer.set_attr('block_in', block_in)
+        layer.set_attr('block_out', block_out)
+        layer.set_attr('n_blocks', n_blocks)
+        print(
+            f'Layer {layer.name}: {len(nonzero)} of {data.shape[0] * data.shape[1]} weight blocks of shape '
+            f'{tuple(block_shape)} are non-zero'
+        )
+
+        return index_t
+
     # TODO consolidate these functions into a single `init_conv`
     @layer_optimizer(Conv1D)
     def init_conv1d(self, layer):
@@ -447,8 +550,40 @@ class VivadoBackend(FPGABackend):
 
         layer.set_attr('index_t', NamedType(f'layer{layer.index}_index', IntegerPrecisionType(width=1, signed=False)))
 
+    @layer_optimizer(MultiHeadAttention)
+    def init_mha(self, layer):
+        n_heads = layer.get_attr('num_heads')
+        mult_sizes = {
+            'query_reuse_factor': (layer.get_attr('feature_dim'), layer.get_attr('head_dim_key')),
+            'key_reuse_factor': (layer.get_attr('feature_dim_kv'), layer.get_attr('head_dim_key')),
+            'value_reuse_factor': (layer.get_attr('feature_dim_kv'), layer.get_attr('head_dim_value')),
+            'attention_output_reuse_factor': (n_heads * layer.get_attr('head_dim_value'), layer.get_attr('output_dim')),
+        }
+
+        if layer.model.config.is_resource_strategy(layer):
+            for attribute, (n_in, n_out) in mult_sizes.items():
+                self.set_closest_reuse_factor(layer, n_in, n_out, attribute=attribute)
+            layer.set_attr('strategy', 'resource')
+        else:
+            layer.set_attr('strategy', 'latency')
+
+        layer.set_attr('index_t', NamedType(f'layer{layer.index}_index', IntegerPrecisionType(width=1, signed=False)))
+
+        # The softmax tables are addressed by the top bits of the scores and of the sum of exponentials
+        table_bw = min(layer.get_attr('score_t').precision.width, layer.get_attr('exp_table_t').precision.width)
+        if 2**table_bw < int(layer.get_attr('table_size')):
+            print(
+                f'WARNING: Table size of layer "{layer.name}" is too large for the score or exp_table width. '
+                f'Using table size {2**table_bw} instead.'
+            )
+            layer.set_attr('table_size', 2**table_bw)
+
     @layer_optimizer(GarNet)
     def init_garnet(self, layer):
+        if layer.model.config.get_config_value('IOType') == 'io_stream':
+            # The vertices are streamed, the edge weights are partitioned by the kernel
+            return
+
         reuse_factor = layer.attributes['reuse_factor']
 
         var_converter = VivadoArrayVariableConverter(type_converter=HLSTypeConverter(precision_converter=APTypeConverter()))
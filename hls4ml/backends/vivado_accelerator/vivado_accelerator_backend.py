@@ -106,6 +106,8 @@ class VivadoAcceleratorBackend(VivadoBackend):
         input_type='float',
         output_type='float',
         platform='xilinx_u250_xdma_201830_2',
+        batched=False,
+        word_width=64,
     ):
         '''
         Create initial accelerator config with default parameters
@@ -125,6 +127,10 @@ class VivadoAcceleratorBackend(VivadoBackend):
             output_type: the wrapper output precision. Can be `float` or an `ap_type`. Note:
                               VivadoAcceleratorBackend will round the number of bits used to the next power-of-2 value.
             platform: development target platform
+            batched: generate a wrapper that processes a runtime number of samples per call, with the fixed-point
+                     input and output values packed into words of `word_width` bits. Requires `axi_stream` or
+                     `axi_master` and `ap_type` input and output types.
+            word_width: the width of the words of the batched wrapper, 32, 64 or 512 bits.
 
         Returns:
             populated config
@@ -142,6 +148,9 @@ class VivadoAcceleratorBackend(VivadoBackend):
         config['AcceleratorConfig']['Precision']['Output'] = output_type  # float, double or ap_fixed<a,b>
         if board.startswith('alveo'):
             config['AcceleratorConfig']['Platform'] = platform
+        if batched:
+            config['AcceleratorConfig']['Batched'] = True
+            config['AcceleratorConfig']['WordWidth'] = word_width
 
         return config
 
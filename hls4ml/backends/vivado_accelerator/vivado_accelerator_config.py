@@ -51,6 +51,8 @@ class VivadoAcceleratorConfig:
         self.platform = self.config['AcceleratorConfig'].get(
             'Platform', 'xilinx_u250_xdma_201830_2'
         )  # Get platform folder name
+        self.batched = self.config['AcceleratorConfig'].get('Batched', False)
+        self.word_width = self.config['AcceleratorConfig'].get('WordWidth', 64)  # 32, 64 or 512
 
         assert (
             len(model_inputs) == 1
@@ -82,6 +84,20 @@ class VivadoAcceleratorConfig:
         else:
             self.output_bitwidth = config.backend.convert_precision_string(out_axi_t).width
 
+        if self.batched:
+            self._check_batched()
+
+    def _check_batched(self):
+        if self.interface not in ['axi_stream', 'axi_master']:
+            raise Exception('The batched wrapper requires the axi_stream or axi_master interface')
+        if self.word_width not in [32, 64, 512]:
+            raise Exception(f'Unsupported WordWidth {self.word_width}, must be 32, 64 or 512')
+        for name, p in [('Input', self.input_type), ('Output', self.output_type)]:
+            if not isinstance(p, (FixedPrecisionType, IntegerPrecisionType)):
+                raise Exception(f'The batched wrapper requires a fixed-point or integer {name} precision')
+            if p.width > self.word_width:
+                raise Exception(f'The {name} precision {p} is wider than the words ({self.word_width} bits)')
+
     def _next_factor8_type(self, p):
         '''Return a new type with the width rounded to the next factor of 8 up to p's width
         Args:
@@ -98,11 +114,23 @@ class VivadoAcceleratorConfig:
             return IntegerPrecisionType(newW, p.signed)
 
     def get_io_bitwidth(self):
+        if self.batched:
+            return self.word_width, self.word_width
         return self.input_bitwidth, self.output_bitwidth
 
     def get_corrected_types(self):
         return self.input_type, self.output_type, self.inp, self.out
 
+    def get_batched(self):
+        return self.batched
+
+    def get_word_width(self):
+        return self.word_width
+
+    def get_packing(self):
+        '''Return the number of input and output values packed into one word of the batched wrapper'''
+        return self.word_width // self.input_type.width, self.word_width // self.output_type.width
+
     def get_interface(self):
         return self.interface
 
@@ -371,11 +371,13 @@ def convert_from_symbolic_expression(
     n_symbols=None,
     lut_functions=None,
     use_built_in_lut_functions=False,
+    cse=False,
     output_dir='my-hls-test',
     project_name='myproject',
     input_data_tb=None,
     output_data_tb=None,
     precision='ap_fixed<16,6>',
+    reuse_factor=1,
     **kwargs,
 ):
     """Converts a given (SymPy or string) expression to hls4ml model.
@@ -403,6 +405,10 @@ def convert_from_symbolic_expression(
             ``<end>`` are the ranges in which the function will be approximated. It is **strongly** recommended to use a
             power-of-two as a range.
         use_built_in_lut_functions (bool, optional): Use built-in sin/cos LUT functions. Defaults to False.
+        cse (bool, optional): Compute the subexpressions shared by the expressions (and identical LUT calls) only once,
+            in temporaries with their own fixed-point types. The temporaries keep the fractional bits of the result type,
+            so the outputs may differ slightly. The operation counts before and after are stored in the ``ops_before``
+            and ``ops_after`` attributes of the layer. Defaults to False.
         output_dir (str, optional): Output directory of the generated HLS
             project. Defaults to 'my-hls-test'.
         project_name (str, optional): Name of the HLS project.
@@ -412,6 +418,8 @@ def convert_from_symbolic_expression(
         output_data_tb (str, optional): String representing the path of output data in .npy or .dat format that will be
             used during csim and cosim.
         precision (str, optional): Precision to use. Defaults to 'ap_fixed<16,6>'.
+        reuse_factor (int, optional): Number of cycles over which the multipliers, adders and function units are shared,
+            the expressions accept a new input every ``reuse_factor`` cycles. Defaults to 1.
         part (str, optional): The FPGA part. If set to `None` a default part of a backend will be used.
         clock_period (int, optional): Clock period of the design.
             Defaults to 5.
@@ -465,6 +473,7 @@ def convert_from_symbolic_expression(
     expr_layer['n_symbols'] = n_symbols
     expr_layer['lut_functions'] = lut_functions
     expr_layer['use_built_in_luts'] = use_built_in_lut_functions
+    expr_layer['cse'] = cse
     layer_list.append(expr_layer)
 
     config = create_config(output_dir=output_dir, project_name=project_name, backend='SymbolicExpression', **kwargs)
@@ -474,7 +483,7 @@ def convert_from_symbolic_expression(
     config['InputData'] = input_data_tb
     config['OutputPredictions'] = output_data_tb
 
-    config['HLSConfig'] = {'Model': {'Precision': precision, 'ReuseFactor': 1}}
+    config['HLSConfig'] = {'Model': {'Precision': precision, 'ReuseFactor': reuse_factor}}
 
     hls_model = ModelGraph(config, layer_list)
 
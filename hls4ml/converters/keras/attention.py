@@ -0,0 +1,49 @@
+import numpy as np
+
+from hls4ml.converters.keras_to_hls import get_weights_data, keras_handler, parse_default_keras_layer
+
+
+@keras_handler('MultiHeadAttention')
+def parse_mha_layer(keras_layer, input_names, input_shapes, data_reader):
+    assert 'MultiHeadAttention' in keras_layer['class_name']
+
+    layer = parse_default_keras_layer(keras_layer, input_names)
+
+    config = keras_layer['config']
+    if config.get('attention_axes') is not None:
+        raise Exception('MultiHeadAttention is only supported with attention over the sequence axis')
+
+    # The value (and key) tensors are passed as keyword arguments of the call, the query is the only positional input
+    inbound = keras_layer['inbound_nodes'][0]
+    call_kwargs = inbound[0][3] if len(inbound[0]) > 3 else {}
+    query_name = input_names[0]
+    if len(inbound) > 1:
+        value_name = input_names[1]
+    elif 'value' in call_kwargs:
+        value_name = call_kwargs['value'][0]
+    else:
+        raise Exception(f'Cannot find the value input of MultiHeadAttention layer {layer["name"]}')
+    key = call_kwargs.get('key')
+    if key is not None and key[0] != value_name:
+        raise Exception('MultiHeadAttention with a key different from the value is not supported')
+    layer['inputs'] = [query_name] if value_name == query_name else [query_name, value_name]
+
+    num_heads = config['num_heads']
+    head_dim_key = config['key_dim']
+    head_dim_value = config['value_dim'] if config.get('value_dim') is not None else head_dim_key
+    layer['num_heads'] = num_heads
+    layer['head_dim_key'] = head_dim_key
+    layer['head_dim_value'] = head_dim_value
+
+    # Keras kernels are (n_in, num_heads, head_dim), hls4ml stores them head-major
+    for proj in ['query', 'key', 'value']:
+        kernel, bias = get_weights_data(data_reader, layer['name'], [f'{proj}/kernel', f'{proj}/bias'])
+        layer[f'{proj}_weight_data'] = np.transpose(kernel, axes=[1, 0, 2])
+        layer[f'{proj}_bias_data'] = bias if bias is not None else np.zeros(kernel.shape[1:])
+
+    kernel, bias = get_weights_data(data_reader, layer['name'], ['attention_output/kernel', 'attention_output/bias'])
+    output_dim = kernel.shape[-1]
+    layer['attention_output_weight_data'] = kernel
+    layer['attention_output_bias_data'] = bias if bias is not None else np.zeros(output_dim)
+
+    return layer, [input_shapes[0][0], input_shapes[0][1], output_dim]
@@ -120,6 +120,34 @@ def parse_batchnorm_layer(keras_layer, input_names, input_shapes, data_reader):
     return layer, [shape for shape in input_shapes[0]]
 
 
+@keras_handler('LayerNormalization')
+def parse_layernorm_layer(keras_layer, input_names, input_shapes, data_reader):
+    assert 'LayerNormalization' in keras_layer['class_name']
+
+    layer = parse_default_keras_layer(keras_layer, input_names)
+
+    rank = len(input_shapes[0])
+    axis = keras_layer['config']['axis']
+    if isinstance(axis, (list, tuple)):
+        if len(axis) != 1:
+            raise Exception('LayerNormalization is only supported over a single axis')
+        axis = axis[0]
+    if axis not in [-1, rank - 1]:
+        raise Exception('LayerNormalization is only supported over the last axis')
+
+    layer['n_in'] = input_shapes[0][-1]
+    layer['seq_len'] = 1
+    for dim in input_shapes[0][1:-1]:
+        layer['seq_len'] *= dim
+
+    if keras_layer['config']['scale']:
+        layer['gamma_data'] = get_weights_data(data_reader, layer['name'], 'gamma')
+    if keras_layer['config']['center']:
+        layer['beta_data'] = get_weights_data(data_reader, layer['name'], 'beta')
+
+    return layer, [shape for shape in input_shapes[0]]
+
+
 @keras_handler('Embedding')
 def parse_embedding_layer(keras_layer, input_names, input_shapes, data_reader):
     assert 'Embedding' in keras_layer['class_name']
@@ -1,4 +1,5 @@
 from hls4ml.converters.keras_to_hls import keras_handler, parse_default_keras_layer
+from hls4ml.model.layers import Merge
 
 merge_layers = ['Add', 'Subtract', 'Multiply', 'Average', 'Maximum', 'Minimum', 'Concatenate', 'Dot']
 
@@ -18,7 +19,7 @@ def parse_merge_layer(keras_layer, input_names, input_shapes, data_reader):
             raise Exception('ERROR: Concatenation of tensors with rank > 3 is not yet supported.')
         layer['op'] = layer['class_name'].lower() + f'{rank}d'
         layer['axis'] = keras_layer['config']['axis']
-        output_shape[layer['axis']] += input_shapes[1][layer['axis']]
+        output_shape[layer['axis']] = sum(shape[layer['axis']] for shape in input_shapes)
     elif layer['class_name'] == 'Dot':
         rank = len(input_shapes[0][1:])
         if rank > 1:
@@ -26,7 +27,7 @@ def parse_merge_layer(keras_layer, input_names, input_shapes, data_reader):
         layer['op'] = layer['class_name'].lower() + f'{rank}d'
     else:
         layer['class_name'] = 'Merge'
-    if len(layer['inputs']) > 2:
-        raise Exception('ERROR: Merging more than two tensors is not yet supported.')
+    if len(layer['inputs']) > 2 and layer['class_name'] == 'Merge' and layer['op'] not in Merge.nary_ops:
+        raise Exception(f'ERROR: Merging more than two tensors is not supported for {keras_layer["class_name"]}.')
 
     return layer, output_shape
@@ -1,6 +1,19 @@
 from hls4ml.converters.onnx_to_hls import get_onnx_attribute, get_onnx_input_name, onnx_handler
+from hls4ml.model.layers import Merge
 
-merge_layers = ['Add', 'Sub', 'Mul', 'Average', 'Max', 'Min', 'Concat', 'Sum']
+merge_layers = ['Add', 'Sub', 'Mul', 'Average', 'Max', 'Min', 'Concat', 'Sum', 'Mean']
+
+# Names of the element-wise operations in hls4ml
+merge_ops = {
+    'Add': 'add',
+    'Sum': 'add',
+    'Sub': 'subtract',
+    'Mul': 'multiply',
+    'Average': 'average',
+    'Mean': 'average',
+    'Max': 'maximum',
+    'Min': 'minimum',
+}
 
 
 @onnx_handler(*merge_layers)
@@ -27,16 +40,14 @@ def parse_merge_layer(reader, node, inputs_map, input_shapes, graph, config):
         )
         output_shape[layer['axis']] = new_dim
 
-    elif layer['class_name'] == 'Add':
-        # Check if the layer is an AddBias
-        for input in node.input:
-            if "bias" in input:
-                layer['class_name'] = 'BiasAdd'
-                reader.add_input(layer['name'], node.input)
+    elif layer['class_name'] == 'Add' and any('bias' in input for input in node.input):
+        # The layer is an AddBias
+        layer['class_name'] = 'BiasAdd'
+        reader.add_input(layer['name'], node.input)
     else:
         layer['class_name'] = 'Merge'
-
-    if len(layer['inputs']) > 2:
-        raise Exception('ERROR: Merging more than two tensors is not yet supported.')
+        layer['op'] = merge_ops[node.op_type]
+        if len(layer['inputs']) > 2 and layer['op'] not in Merge.nary_ops:
+            raise Exception(f'ERROR: Merging more than two tensors is not supported for {node.op_type}.')
 
     return layer, output_shape
@@ -131,3 +131,32 @@ def parse_batchnorm_layer(operation, layer_name, input_names, input_shapes, node
         layer['n_filt'] = input_shapes[0][1]  # Always channel first for Pytorch
 
     return layer, [shape for shape in input_shapes[0]]
+
+
+@pytorch_handler('LayerNorm')
+def parse_layernorm_layer(operation, layer_name, input_names, input_shapes, node, class_object, data_reader, config):
+    assert 'LayerNorm' in operation
+
+    layer = {}
+
+    layer['class_name'] = 'LayerNormalization'
+    layer['name'] = layer_name
+    layer['inputs'] = input_names
+
+    # Only normalization over the last dimension, which is the same in PyTorch and hls4ml, is supported
+    normalized_shape = tuple(class_object.normalized_shape)
+    if len(normalized_shape) != 1 or normalized_shape[0] != input_shapes[0][-1]:
+        raise Exception('LayerNorm is only supported over the last dimension')
+
+    layer['epsilon'] = class_object.eps
+    if class_object.elementwise_affine:
+        layer['gamma_data'] = class_object.weight.data.numpy()
+        if class_object.bias is not None:
+            layer['beta_data'] = class_object.bias.data.numpy()
+
+    layer['n_in'] = input_shapes[0][-1]
+    layer['seq_len'] = 1
+    for dim in input_shapes[0][1:-1]:
+        layer['seq_len'] *= dim
+
+    return layer, [shape for shape in input_shapes[0]]
@@ -13,9 +13,6 @@ def parse_concat_layer(operation, layer_name, input_names, input_shapes, node, c
     layer['op'] = 'concatenate'
     layer['inputs'] = input_names
 
-    if len(layer['inputs']) > 2:
-        raise Exception('ERROR: Merging more than two tensors is not yet supported.')
-
     rank = len(input_shapes[0][1:])
     if rank > 3:
         raise Exception('ERROR: Concatenation of tensors with rank > 3 is not yet supported.')
@@ -23,7 +20,7 @@ def parse_concat_layer(operation, layer_name, input_names, input_shapes, node, c
     layer['axis'] = node.kwargs.get('dim', 0)
 
     output_shape = input_shapes[0][:]
-    output_shape[layer['axis']] += input_shapes[1][layer['axis']]
+    output_shape[layer['axis']] = sum(shape[layer['axis']] for shape in input_shapes)
 
     return layer, output_shape
 
@@ -1,3 +1,4 @@
+from hls4ml.model import precision_search  # noqa: F401
 from hls4ml.model.graph import HLSConfig, ModelGraph  # noqa: F401
 
 try:
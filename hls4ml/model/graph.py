@@ -10,6 +10,8 @@ from hls4ml.backends import get_backend
 from hls4ml.model.flow import get_flow
 from hls4ml.model.layers import layer_map
 from hls4ml.model.optimizer import get_available_passes, optimize_model
+from hls4ml.model.types import FixedPrecisionType
+from hls4ml.utils.fixed_point_utils import raw_int_type
 
 
 class HLSConfig:
@@ -48,6 +50,8 @@ class HLSConfig:
         self.layer_name_compression = {}
 
         self.trace_output = self.get_config_value('TraceOutput', False)
+        self.layer_profiling = self.get_config_value('LayerProfiling', False)
+        self.overflow_counters = self.get_config_value('OverflowCounters', False)
 
         self.pipeline_style = 'pipeline'
 
@@ -695,25 +699,45 @@ class ModelGraph:
             if not xi.flags['C_CONTIGUOUS']:
                 raise Exception('Array must be c_contiguous, try using numpy.ascontiguousarray(x)')
 
-        x0 = xlist[0]
-        if x0.dtype in [np.single, np.float32]:
+        return self._get_top_function_for_dtype(xlist[0].dtype, len(xlist) + n_outputs)
+
+    def _get_top_function_for_dtype(self, dtype, n_args):
+        if self._top_function_lib is None:
+            raise Exception('Model not compiled')
+
+        if dtype in [np.single, np.float32]:
             top_function = getattr(self._top_function_lib, self.config.get_project_name() + '_float')
             ctype = ctypes.c_float
-        elif x0.dtype in [np.double, np.float64, np.float_]:
+        elif dtype in [np.double, np.float64, np.float_]:
             top_function = getattr(self._top_function_lib, self.config.get_project_name() + '_double')
             ctype = ctypes.c_double
+        elif dtype in [np.int8, np.int16, np.int32, np.int64]:
+            # Raw mode, integers are interpreted as the bits of the input/output fixed-point types
+            ctype = np.dtype(dtype)
+            try:
+                top_function = getattr(self._top_function_lib, self.config.get_project_name() + '_' + ctype.name)
+            except AttributeError:
+                raise Exception('Integer I/O requires fixed-point or integer input/output types of up to 64 bits') from None
         else:
             raise Exception(
-                'Invalid type ({}) of numpy array. Supported types are: single, float32, double, float64, float_.'.format(
-                    x0.dtype
-                )
+                'Invalid type ({}) of numpy array. Supported types are: single, float32, double, float64, float_, '
+                'int8, int16, int32, int64.'.format(dtype)
             )
 
+        n_outputs = len(self.get_output_variables())
+        arg_types = [ctype] * (n_args - n_outputs) + self._get_output_dtypes(ctype)
         top_function.restype = None
-        top_function.argtypes = [npc.ndpointer(ctype, flags="C_CONTIGUOUS") for i in range(len(xlist) + n_outputs)]
+        top_function.argtypes = [npc.ndpointer(arg_type, flags="C_CONTIGUOUS") for arg_type in arg_types]
 
         return top_function, ctype
 
+    def _get_output_dtypes(self, ctype):
+        if isinstance(ctype, np.dtype) and ctype.kind == 'i':
+            # In raw mode, outputs use the smallest integer type that fits their precision
+            return [np.dtype(raw_int_type(var.type.precision)) for var in self.get_output_variables()]
+        else:
+            return [np.dtype(ctype)] * len(self.get_output_variables())
+
     def _compute_n_samples(self, x):
         if len(self.get_input_variables()) == 1:
             xlist = [x]
@@ -739,6 +763,9 @@ class ModelGraph:
         n_inputs = len(self.get_input_variables())
         n_outputs = len(self.get_output_variables())
 
+        self._reset_layer_profile()
+        self._reset_overflow_counters()
+
         curr_dir = os.getcwd()
         os.chdir(self.config.get_output_dir() + '/firmware')
 
@@ -746,9 +773,11 @@ class ModelGraph:
         if n_samples == 1 and n_inputs == 1:
             x = [x]
 
+        output_dtypes = self._get_output_dtypes(ctype)
+
         try:
             for i in range(n_samples):
-                predictions = [np.zeros(yj.size(), dtype=ctype) for yj in self.get_output_variables()]
+                predictions = [np.zeros(yj.size(), dtype=dt) for yj, dt in zip(self.get_output_variables(), output_dtypes)]
                 if n_inputs == 1:
                     inp = [np.asarray(x[i])]
                 else:
@@ -775,12 +804,366 @@ class ModelGraph:
         else:
             return output
 
+    def predict_stream(self, source, output=None, n_samples=None, chunk_size=1024, dtype=None, progress_callback=None):
+        """Run out-of-core prediction, processing the input in fixed-size chunks.
+
+        Unlike `predict`, the input doesn't have to be an in-memory array and the results are written incrementally
+        into the output, so the memory footprint is bounded by the chunk size.
+
+        Args:
+            source (ndarray, list, iterable or callable): The input data. Can be an array (including ``np.memmap``) or a
+                list of arrays for models with multiple inputs, an iterable yielding chunks (arrays, or lists of arrays
+                for multiple inputs), or a callable ``source(start, stop)`` returning the chunk of samples in the range
+                ``[start, stop)``. The first dimension of every array/chunk is the sample dimension.
+            output (ndarray, str or list, optional): Where to write the predictions. Can be a preallocated array of shape
+                ``(n_samples, ...)``, or a path to a ``.npy`` file that will be created as a memory-mapped array. For
+                models with multiple outputs, a list of those is expected. If ``None``, the output arrays are allocated
+                in memory. Defaults to ``None``.
+            n_samples (int, optional): Total number of samples. Required if ``source`` is a callable, or if ``source``
+                is an iterable and ``output`` is a path. Inferred from the data otherwise. Defaults to ``None``.
+            chunk_size (int, optional): Number of samples processed per chunk. Defaults to 1024.
+            dtype (optional): The type of the inputs passed to the compiled library. Either a floating-point type
+                (``np.float32`` or ``np.float64``, also used for the outputs), or an integer type (``np.int8`` to
+                ``np.int64``) for raw fixed-point I/O, in which case the outputs are the smallest integer types that hold
+                the output precision. If ``None``, determined from the first chunk of input or the output arrays.
+                Defaults to ``None``.
+            progress_callback (callable, optional): Called as ``progress_callback(n_processed, n_samples)`` after each
+                chunk. ``n_samples`` is ``None`` if unknown. Defaults to ``None``.
+
+        Raises:
+            Exception: If the model is not compiled, or if the shapes of the input/output don't match the model.
+
+        Returns:
+            ndarray or list: The output array (or list of arrays for multiple outputs). If ``output`` was given as path,
+            the returned arrays are the memory-mapped ``.npy`` files.
+        """
+        if self._top_function_lib is None:
+            raise Exception('Model not compiled')
+        if chunk_size < 1:
+            raise Exception(f'Invalid chunk size ({chunk_size}), must be a positive integer')
+
+        input_vars = self.get_input_variables()
+        output_vars = self.get_output_variables()
+        n_inputs = len(input_vars)
+        n_outputs = len(output_vars)
+
+        def as_input_list(data):
+            if n_inputs == 1 and not isinstance(data, (list, tuple)):
+                return [data]
+            if len(data) != n_inputs:
+                raise Exception(f'Expected {n_inputs} inputs, but got {len(data)}')
+            return list(data)
+
+        def chunk_n_samples(xlist):
+            n_chunk = []
+            for xi, var in zip(xlist, input_vars):
+                n_sample, rem = divmod(int(np.prod(xi.shape)), var.size())
+                if rem != 0:
+                    raise Exception(f'Input size mismatch, got {xi.shape}, expected (N, {var.size()})')
+                n_chunk.append(n_sample)
+            if any(n != n_chunk[0] for n in n_chunk):
+                raise Exception('Input size mismatch, not all inputs match')
+            return n_chunk[0]
+
+        # Normalize all types of sources to an iterator over lists of arrays
+        if callable(source) and not isinstance(source, np.ndarray):
+            if n_samples is None:
+                raise Exception('Number of samples must be provided when the source is a callable')
+
+            def chunks():
+                for start in range(0, n_samples, chunk_size):
+                    yield as_input_list(source(start, min(start + chunk_size, n_samples)))
+
+        elif isinstance(source, np.ndarray) or (
+            n_inputs > 1 and isinstance(source, (list, tuple)) and all(isinstance(s, np.ndarray) for s in source)
+        ):
+            arrays = as_input_list(source)
+            n_total = chunk_n_samples(arrays)
+            if n_samples is None:
+                n_samples = n_total
+            elif n_samples > n_total:
+                raise Exception(f'Requested {n_samples} samples, but the input only has {n_total}')
+            # Only index the leading dimension, memmaps are read lazily this way
+            arrays = [np.reshape(xi, (n_total, var.size())) if xi.ndim < 2 else xi for xi, var in zip(arrays, input_vars)]
+
+            def chunks():
+                for start in range(0, n_samples, chunk_size):
+                    stop = min(start + chunk_size, n_samples)
+                    yield [xi[start:stop] for xi in arrays]
+
+        else:
+
+            def chunks():
+                for chunk in source:
+                    yield as_input_list(chunk)
+
+        # Prepare the outputs
+        if output is not None:
+            outputs = [output] if n_outputs == 1 and not isinstance(output, (list, tuple)) else list(output)
+            if len(outputs) != n_outputs:
+                raise Exception(f'Expected {n_outputs} outputs, but got {len(outputs)}')
+            for out in outputs:
+                if isinstance(out, np.ndarray) and n_samples is None:
+                    n_samples = out.shape[0]
+        else:
+            outputs = [None] * n_outputs
+
+        chunk_iter = chunks()
+        first_chunk = next(chunk_iter, None)
+        if first_chunk is None:
+            raise Exception('Input source is empty')
+        if dtype is None:
+            dtype = np.asarray(first_chunk[0]).dtype
+            if dtype not in [np.int8, np.int16, np.int32, np.int64]:
+                out_dtypes = [out.dtype for out in outputs if isinstance(out, np.ndarray) and out.dtype.kind == 'f']
+                dtype = out_dtypes[0] if len(out_dtypes) > 0 else dtype
+                dtype = np.float64 if dtype == np.float64 else np.float32
+        dtype = np.dtype(dtype)
+
+        top_function, ctype = self._get_top_function_for_dtype(dtype, n_inputs + n_outputs)
+        output_dtypes = self._get_output_dtypes(ctype)
+        self._reset_layer_profile()
+        self._reset_overflow_counters()
+
+        for i, (out, var, out_dtype) in enumerate(zip(outputs, output_vars, output_dtypes)):
+            if isinstance(out, str):
+                if n_samples is None:
+                    raise Exception('Number of samples must be provided when writing the output to a file')
+                outputs[i] = np.lib.format.open_memmap(out, mode='w+', dtype=out_dtype, shape=(n_samples, var.size()))
+            elif isinstance(out, np.ndarray):
+                if out.dtype != out_dtype:
+                    raise Exception(f'Invalid output array type ({out.dtype}), expected {out_dtype}')
+                if not out.flags['C_CONTIGUOUS']:
+                    raise Exception('Output array must be c_contiguous')
+                if out.size % var.size() != 0 or out.shape[0] * var.size() != out.size:
+                    raise Exception(f'Output size mismatch, got {out.shape}, expected (N, {var.size()})')
+            elif out is None and n_samples is not None:
+                outputs[i] = np.empty((n_samples, var.size()), dtype=out_dtype)
+
+        # Output size is not known in advance, chunks are collected and merged at the end
+        collect = [[] for _ in range(n_outputs)] if any(out is None for out in outputs) else None
+
+        curr_dir = os.getcwd()
+        os.chdir(self.config.get_output_dir() + '/firmware')
+
+        n_processed = 0
+        try:
+            chunk = first_chunk
+            while chunk is not None:
+                xlist = [np.ascontiguousarray(xi, dtype=dtype) for xi in chunk]
+                n_chunk = chunk_n_samples(xlist)
+                if n_samples is not None and n_processed + n_chunk > n_samples:
+                    raise Exception(f'Input source provided more than the expected {n_samples} samples')
+                xlist = [xi.reshape(n_chunk, var.size()) for xi, var in zip(xlist, input_vars)]
+
+                if collect is not None:
+                    ylist = [np.empty((n_chunk, var.size()), dtype=dt) for var, dt in zip(output_vars, output_dtypes)]
+                    offset = 0
+                else:
+                    ylist = [out.reshape(out.shape[0], -1) for out in outputs]
+                    offset = n_processed
+
+                for i in range(n_chunk):
+                    argtuple = [xi[i] for xi in xlist]
+                    argtuple += [yi[offset + i] for yi in ylist]
+                    top_function(*argtuple)
+
+                if collect is not None:
+                    for yi, collected in zip(ylist, collect):
+                        collected.append(yi)
+
+                n_processed += n_chunk
+                if progress_callback is not None:
+                    progress_callback(n_processed, n_samples)
+
+                chunk = next(chunk_iter, None)
+        finally:
+            os.chdir(curr_dir)
+
+        if n_samples is not None and n_processed != n_samples:
+            raise Exception(f'Expected {n_samples} samples, but the input source provided {n_processed}')
+
+        if collect is not None:
+            outputs = [np.concatenate(collected) for collected in collect]
+
+        for out in outputs:
+            if isinstance(out, np.memmap):
+                out.flush()
+
+        if n_outputs == 1:
+            return outputs[0]
+        else:
+            return outputs
+
+    def _reset_layer_profile(self):
+        if self.config.layer_profiling:
+            reset_func = self._top_function_lib.reset_layer_profile
+            reset_func.argtypes = None
+            reset_func.restype = None
+            reset_func()
+
+    def get_layer_profile(self):
+        """Returns the per-layer profile of the last call to `predict` (or `predict_stream`).
+
+        Requires the model to be compiled with ``LayerProfiling`` enabled in the configuration, which wraps each layer call
+        of the emulation library with timestamp counters. Bytes moved are estimated from the sizes and precisions of the
+        input and output activations and the weights of the layer.
+
+        Returns:
+            dict: Dictionary of ``{layer_name: {'time': seconds, 'samples': calls, 'bytes': bytes_moved}}``, in the order
+            the layers are executed.
+        """
+        if not self.config.layer_profiling:
+            raise Exception('Layer profiling is not enabled, set "LayerProfiling" to True in the config and recompile')
+        if self._top_function_lib is None:
+            raise Exception('Model must be compiled before retrieving the layer profile')
+
+        class LayerProfileData(ctypes.Structure):
+            _fields_ = [('name', ctypes.c_char_p), ('calls', ctypes.c_ulonglong), ('time_ns', ctypes.c_ulonglong)]
+
+        n_layers_func = self._top_function_lib.get_n_profiled_layers
+        n_layers_func.argtypes = None
+        n_layers_func.restype = ctypes.c_size_t
+
+        collect_func = self._top_function_lib.collect_layer_profile
+        collect_func.argtypes = [ctypes.POINTER(LayerProfileData)]
+        collect_func.restype = None
+
+        profile_data = (LayerProfileData * n_layers_func())()
+        collect_func(profile_data)
+
+        def var_bytes(var, size):
+            return size * getattr(var.type.precision, 'width', 32) / 8
+
+        profile = {}
+        for entry in profile_data:
+            layer = self.graph[str(entry.name, 'utf-8')]
+            bytes_per_call = sum(
+                var_bytes(layer.get_input_variable(i), layer.get_input_variable(i).size()) for i in layer.inputs
+            )
+            bytes_per_call += sum(var_bytes(var, var.size()) for var in layer.get_variables())
+            bytes_per_call += sum(var_bytes(w, w.data_length) for w in layer.get_weights())
+            profile[layer.name] = {
+                'time': entry.time_ns * 1e-9,
+                'samples': entry.calls,
+                'bytes': int(np.ceil(bytes_per_call)) * entry.calls,
+            }
+
+        return profile
+
+    def _reset_overflow_counters(self):
+        if self.config.overflow_counters:
+            reset_func = self._top_function_lib.reset_overflow_counters
+            reset_func.argtypes = None
+            reset_func.restype = None
+            reset_func()
+
+    def get_overflow_counters(self):
+        """Returns the overflow, saturation and rounding events of each layer in the last call to `predict` (or
+        `predict_stream`).
+
+        Requires the model to be compiled with ``OverflowCounters`` enabled in the configuration, which builds the
+        emulation library with every fixed-point conversion inside a layer instrumented, as well as the lookup-table
+        indices of the activations. Events are aggregated per layer and destination type. Types are identified by their
+        precision, so types of a layer with the same precision (e.g., ``accum_t`` and ``result_t``) share an entry.
+
+        Returns:
+            dict: Dictionary of ``{layer_name: {type_names: counters}}``, where ``type_names`` are the names of the layer
+            attributes with that type joined by '/' (``'table_index'`` for table indices), and ``counters`` is a
+            dictionary with the number of ``'assignments'``, ``'overflows'`` (wrapped), ``'saturations'`` and
+            ``'roundings'``, and the ``'min'`` and ``'max'`` of the assigned values. Only layers with events are listed.
+        """
+        if not self.config.overflow_counters:
+            raise Exception('Overflow counters are not enabled, set "OverflowCounters" to True in the config and recompile')
+        if self._top_function_lib is None:
+            raise Exception('Model must be compiled before retrieving the overflow counters')
+
+        class OverflowCounterData(ctypes.Structure):
+            _fields_ = [
+                ('layer', ctypes.c_uint),
+                ('width', ctypes.c_int),
+                ('integer', ctypes.c_int),
+                ('is_signed', ctypes.c_int),
+                ('rounding_mode', ctypes.c_int),
+                ('saturation_mode', ctypes.c_int),
+                ('assignments', ctypes.c_ulonglong),
+                ('overflows', ctypes.c_ulonglong),
+                ('saturations', ctypes.c_ulonglong),
+                ('roundings', ctypes.c_ulonglong),
+                ('min', ctypes.c_double),
+                ('max', ctypes.c_double),
+            ]
+
+        n_counters_func = self._top_function_lib.get_n_overflow_counters
+        n_counters_func.argtypes = None
+        n_counters_func.restype = ctypes.c_size_t
+
+        collect_func = self._top_function_lib.collect_overflow_counters
+        collect_func.argtypes = [ctypes.POINTER(OverflowCounterData)]
+        collect_func.restype = None
+
+        counter_data = (OverflowCounterData * n_counters_func())()
+        collect_func(counter_data)
+
+        # Order of the ap_q_mode and ap_o_mode enums
+        ap_rounding_modes = ['RND', 'RND_ZERO', 'RND_MIN_INF', 'RND_INF', 'RND_CONV', 'TRN', 'TRN_ZERO']
+        ap_saturation_modes = ['SAT', 'SAT_ZERO', 'SAT_SYM', 'WRAP', 'WRAP_SM']
+
+        def type_key(precision):
+            return (
+                precision.width,
+                precision.integer,
+                precision.signed,
+                precision.rounding_mode.name,
+                precision.saturation_mode.name,
+            )
+
+        layers = [layer for layer in self.get_layers() if layer.get_attr('function_cpp', None)]
+        counters = {}
+        for entry in counter_data:
+            layer = layers[entry.layer]
+            if entry.width == 0:
+                names = ['table_index']
+            else:
+                key = (
+                    entry.width,
+                    entry.integer,
+                    bool(entry.is_signed),
+                    ap_rounding_modes[entry.rounding_mode],
+                    ap_saturation_modes[entry.saturation_mode],
+                )
+                # Weights are not assigned at runtime
+                weight_types = [w.type for w in layer.get_weights()]
+                layer_types = {name: t for name, t in layer.types.items() if t not in weight_types}
+                for var in layer.get_variables():
+                    layer_types['result_t'] = var.type
+                names = [
+                    name
+                    for name, named_type in layer_types.items()
+                    if isinstance(named_type.precision, FixedPrecisionType) and type_key(named_type.precision) == key
+                ]
+                # Conversions into types of intermediate results are not reported
+                if len(names) == 0:
+                    continue
+            counters.setdefault(layer.name, {})['/'.join(sorted(names))] = {
+                'assignments': entry.assignments,
+                'overflows': entry.overflows,
+                'saturations': entry.saturations,
+                'roundings': entry.roundings,
+                'min': entry.min,
+                'max': entry.max,
+            }
+
+        return counters
+
     def trace(self, x):
         print(f'Recompiling {self.config.get_project_name()} with tracing')
         self.config.trace_output = True
         self.compile()
 
         top_function, ctype = self._get_top_function(x)
+        if isinstance(ctype, np.dtype):
+            raise Exception('Tracing is only supported with floating-point inputs')
         n_samples = self._compute_n_samples(x)
         n_inputs = len(self.get_input_variables())
         n_outputs = len(self.get_output_variables())
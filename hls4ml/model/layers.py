@@ -857,8 +857,58 @@ class BatchNormalization(Layer):
         self.add_weights_variable(name='bias', var_name='b{index}', data=bias)
 
 
+class LayerNormalization(Layer):
+    _expected_attributes = [
+        Attribute('n_in'),
+        Attribute('seq_len', default=1),
+        Attribute('epsilon', value_type=float, default=1e-3),
+        WeightAttribute('scale'),
+        WeightAttribute('bias'),
+        TypeAttribute('scale'),
+        TypeAttribute('bias'),
+    ]
+
+    def initialize(self):
+        inp = self.get_input_variable()
+        shape = inp.shape
+        dims = inp.dim_names
+        self.add_output_variable(shape, dims)
+
+        # Normalization is over the last axis, every other axis is treated as a sequence of independent rows
+        n_in = shape[-1]
+        self.set_attr('n_in', n_in)
+        self.set_attr('seq_len', int(np.prod(shape[:-1])))
+
+        gamma = self.get_attr('gamma_data')
+        beta = self.get_attr('beta_data')
+        scale = gamma if gamma is not None else np.ones(n_in)
+        bias = beta if beta is not None else np.zeros(n_in)
+
+        self.add_weights_variable(name='scale', var_name='s{index}', data=scale)
+        self.add_weights_variable(name='bias', var_name='b{index}', data=bias)
+
+        # Unless set for this layer, the accumulator holds n * sum(x^2) - sum(x)^2 exactly
+        _, accum_name = self.model.config.get_precision(self, 'accum')
+        in_precision = inp.type.precision
+        if accum_name.endswith('_default_t') and isinstance(in_precision, FixedPrecisionType):
+            extra_bits = int(np.ceil(np.log2(n_in))) + (0 if in_precision.signed else 1)
+            accum_precision = FixedPrecisionType(
+                width=2 * in_precision.width + 2 * extra_bits,
+                integer=2 * in_precision.integer + 2 * extra_bits,
+                signed=True,
+            )
+            self.set_attr('accum_t', NamedType(f'layer{self.index}_accum_t', accum_precision))
+
+
 class Merge(Layer):
+    # Operations that can merge more than two inputs in a single layer
+    nary_ops = ['add', 'multiply', 'average', 'maximum', 'minimum']
+
     def initialize(self):
+        if len(self.inputs) > 2:
+            self._initialize_nary()
+            return
+
         assert len(self.inputs) == 2
         inp1 = self.get_input_variable(self.inputs[0])
         inp2 = self.get_input_variable(self.inputs[1])
@@ -870,6 +920,17 @@ class Merge(Layer):
             dims = inp1.dim_names.copy()
         self.add_output_variable(shape, dims)
 
+    def _initialize_nary(self):
+        op = self.get_attr('op').lower()
+        if op not in self.nary_ops:
+            raise Exception(f'ERROR: Merge operation "{op}" of more than two tensors is not supported.')
+        inps = [self.get_input_variable(inp_name) for inp_name in self.inputs]
+        if any(inp.shape != inps[0].shape for inp in inps[1:]):
+            raise Exception('ERROR: Merging more than two tensors requires all of them to have the same shape.')
+        if op in ['add', 'multiply', 'average']:
+            self.set_attr('accum_t', NamedType(*reversed(self.model.config.get_precision(self, 'accum'))))
+        self.add_output_variable(inps[0].shape.copy(), inps[0].dim_names.copy())
+
 
 class Dot(Merge):
     def initialize(self):
@@ -885,14 +946,13 @@ class Dot(Merge):
 
 class Concatenate(Merge):
     def initialize(self):
-        assert len(self.inputs) == 2
-        inp1 = self.get_input_variable(self.inputs[0])
-        inp2 = self.get_input_variable(self.inputs[1])
+        assert len(self.inputs) >= 2
+        inps = [self.get_input_variable(inp_name) for inp_name in self.inputs]
         axis = self.attributes['axis']
         if axis > 0:
             axis -= 1
-        shape = inp1.shape[:]
-        shape[axis] += inp2.shape[axis]
+        shape = inps[0].shape[:]
+        shape[axis] = sum(inp.shape[axis] for inp in inps)
         rank = len(shape)
         if rank > 1:
             dims = [f'OUT_CONCAT_{i}_{self.index}' for i in range(rank)]
@@ -1127,6 +1187,99 @@ class GRU(Layer):
         self.add_weights_variable(name='recurrent_bias', var_name='br{index}')
 
 
+class MultiHeadAttention(Layer):
+    _projections = ['query', 'key', 'value', 'attention_output']
+
+    _expected_attributes = [
+        Attribute('num_heads'),
+        Attribute('head_dim_key'),
+        Attribute('head_dim_value'),
+        Attribute('feature_dim'),
+        Attribute('feature_dim_kv'),
+        Attribute('output_dim'),
+        Attribute('seq_len'),
+        Attribute('seq_len_kv'),
+        ConfigurableAttribute('query_reuse_factor', default=1),
+        ConfigurableAttribute('key_reuse_factor', default=1),
+        ConfigurableAttribute('value_reuse_factor', default=1),
+        ConfigurableAttribute('attention_output_reuse_factor', default=1),
+        WeightAttribute('query_weight'),
+        WeightAttribute('query_bias'),
+        WeightAttribute('key_weight'),
+        WeightAttribute('key_bias'),
+        WeightAttribute('value_weight'),
+        WeightAttribute('value_bias'),
+        WeightAttribute('attention_output_weight'),
+        WeightAttribute('attention_output_bias'),
+        TypeAttribute('query_weight'),
+        TypeAttribute('query_bias'),
+        TypeAttribute('key_weight'),
+        TypeAttribute('key_bias'),
+        TypeAttribute('value_weight'),
+        TypeAttribute('value_bias'),
+        TypeAttribute('attention_output_weight'),
+        TypeAttribute('attention_output_bias'),
+        TypeAttribute('query'),
+        TypeAttribute('key'),
+        TypeAttribute('value'),
+        TypeAttribute('score'),
+        TypeAttribute('attn_weight'),
+        TypeAttribute('head_output'),
+    ]
+
+    def initialize(self):
+        # Inputs are the query and, unless it is self-attention, the value which is also used as the key
+        if len(self.inputs) not in [1, 2]:
+            raise Exception(f'MultiHeadAttention layer {self.name} expects one or two inputs, got {len(self.inputs)}')
+        q_shape = self.get_input_variable(self.inputs[0]).shape
+        kv_shape = self.get_input_variable(self.inputs[-1]).shape
+        if len(q_shape) != 2 or len(kv_shape) != 2:
+            raise Exception(f'MultiHeadAttention layer {self.name} expects inputs of shape (sequence, features)')
+
+        self.set_attr('seq_len', q_shape[0])
+        self.set_attr('feature_dim', q_shape[1])
+        self.set_attr('seq_len_kv', kv_shape[0])
+        self.set_attr('feature_dim_kv', kv_shape[1])
+
+        # Projections are stored head-major as (num_heads, n_in, head_dim), the output projection is applied to the
+        # concatenated heads
+        num_heads = self.get_attr('num_heads')
+        head_dim_key = self.get_attr('head_dim_key')
+        head_dim_value = self.get_attr('head_dim_value')
+        output_bias = self.get_attr('attention_output_bias_data')
+        self.set_attr('output_dim', output_bias.shape[-1])
+
+        shape = [self.attributes['seq_len'], self.attributes['output_dim']]
+        dims = [f'SEQ_LEN_{self.index}', f'N_OUT_{self.index}']
+        self.add_output_variable(shape, dims)
+
+        # The scores are scaled by 1/sqrt(head_dim_key), which is folded into the query projection
+        scale = 1.0 / np.sqrt(head_dim_key)
+        query_weight = self.get_attr('query_weight_data').reshape(num_heads, q_shape[1], head_dim_key) * scale
+        query_bias = self.get_attr('query_bias_data').reshape(num_heads, head_dim_key) * scale
+        self.add_weights_variable(name='query_weight', var_name='wq{index}', data=query_weight)
+        self.add_weights_variable(name='query_bias', var_name='bq{index}', data=query_bias)
+        key_weight = self.get_attr('key_weight_data').reshape(num_heads, kv_shape[1], head_dim_key)
+        value_weight = self.get_attr('value_weight_data').reshape(num_heads, kv_shape[1], head_dim_value)
+        output_weight = self.get_attr('attention_output_weight_data').reshape(num_heads * head_dim_value, -1)
+        self.add_weights_variable(name='key_weight', var_name='wk{index}', data=key_weight)
+        self.add_weights_variable(name='key_bias', var_name='bk{index}')
+        self.add_weights_variable(name='value_weight', var_name='wv{index}', data=value_weight)
+        self.add_weights_variable(name='value_bias', var_name='bv{index}')
+        self.add_weights_variable(name='attention_output_weight', var_name='wo{index}', data=output_weight)
+        self.add_weights_variable(name='attention_output_bias', var_name='bo{index}')
+
+        for var in ['query', 'key', 'value', 'score', 'attn_weight', 'head_output']:
+            precision, type_name = self.model.config.get_precision(self, var)
+            self.set_attr(var + '_t', NamedType(type_name, precision))
+
+        # Each projection uses the reuse factor of the layer unless set on its own
+        reuse_factor = self.model.config.get_reuse_factor(self)
+        for proj in self._projections:
+            if self.get_attr(proj + '_reuse_factor') is None:
+                self.set_attr(proj + '_reuse_factor', reuse_factor)
+
+
 class GarNet(Layer):
     ref_impl = False
 
@@ -1350,6 +1503,7 @@ layer_map = {
     'QDepthwiseConv2D': DepthwiseConv2D,
     'BatchNormalization': BatchNormalization,
     'QBatchNormalization': BatchNormalization,
+    'LayerNormalization': LayerNormalization,
     'MaxPooling1D': Pooling1D,
     'AveragePooling1D': Pooling1D,
     'MaxPooling2D': Pooling2D,
@@ -1371,6 +1525,7 @@ layer_map = {
     'SimpleRNN': SimpleRNN,
     'LSTM': LSTM,
     'GRU': GRU,
+    'MultiHeadAttention': MultiHeadAttention,
     'QSimpleRNN': SimpleRNN,
     'QLSTM': LSTM,
     'QGRU': GRU,
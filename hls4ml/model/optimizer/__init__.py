@@ -52,6 +52,7 @@ register_flow(
         'fuse_batch_normalization',
         'replace_multidimensional_dense_with_conv',
         'set_precision_concat',
+        'infer_accum_precision',
     ],
     requires=['convert'],
 )
@@ -0,0 +1,174 @@
+import numpy as np
+
+from hls4ml.model.layers import Activation, Conv1D, Conv2D, Dense, DepthwiseConv1D, DepthwiseConv2D
+from hls4ml.model.optimizer import ConfigurableOptimizerPass
+from hls4ml.model.types import FixedPrecisionType, IntegerPrecisionType, NamedType, RoundingMode
+
+
+def _fixed_params(precision):
+    """Returns (signed, integer, fractional) of a fixed-point or integer type, None for other types."""
+    if isinstance(precision, FixedPrecisionType):
+        return precision.signed, precision.integer, precision.fractional
+    if isinstance(precision, IntegerPrecisionType):
+        return precision.signed, precision.width, 0
+    return None
+
+
+def _type_range(signed, integer, fractional):
+    lsb = 2.0**-fractional
+    if signed:
+        return -(2.0 ** (integer - 1)), 2.0 ** (integer - 1) - lsb
+    else:
+        return 0.0, 2.0**integer - lsb
+
+
+def _quantize(data, precision):
+    """The values the weights take after the conversion to their type."""
+    signed, integer, fractional = _fixed_params(precision)
+    scaled = data * 2.0**fractional
+    if isinstance(precision, FixedPrecisionType) and precision.rounding_mode != RoundingMode.TRN:
+        scaled = np.round(scaled)
+    else:
+        scaled = np.floor(scaled)
+    low, high = _type_range(signed, integer, fractional)
+    return np.clip(scaled * 2.0**-fractional, low, high)
+
+
+def _integer_bits(low, high, signed, fractional):
+    """The smallest number of integer bits for which [low, high] is representable with the given fractional bits."""
+    integer = -fractional + (1 if signed else 0)
+    while True:
+        type_low, type_high = _type_range(signed, integer, fractional)
+        if type_low <= low and high <= type_high:
+            return integer
+        integer += 1
+
+
+class InferAccumPrecision(ConfigurableOptimizerPass):
+    '''
+    Sets the accumulator of Dense and convolution layers to the smallest width that can never overflow (bit-growth
+    analysis). For every output, the range of the sum is computed from the quantized weights and bias and the range of
+    the input type, so pruned weights don't add any bits. The fractional bits are those of the old accumulator, or
+    fewer if the products and the bias need fewer. If the products are truncated to the accumulator, the range is
+    widened by one LSB per term.
+
+    The pass is applied to the layers in the layer list (names or class names), which is empty by default:
+    hls4ml.model.optimizer.get_optimizer('infer_accum_precision').configure(layers=['Dense', 'Conv2D'])
+    The result types of these layers, and of ReLU/linear activations directly following them, can be narrowed to the
+    same range:
+    hls4ml.model.optimizer.get_optimizer('infer_accum_precision').configure(tighten_result=True)
+    The bits saved in each layer are printed and stored in the 'accum_bits_saved' and 'result_bits_saved' attributes.
+    '''
+
+    def __init__(self):
+        self.layers = []
+        self.tighten_result = False
+
+    def match(self, node):
+        layer_match = node.class_name in self.layers or node.name in self.layers
+        is_mult_layer = isinstance(node, (Dense, Conv1D, Conv2D)) and not isinstance(
+            node, (DepthwiseConv1D, DepthwiseConv2D)
+        )
+        already_applied = node.get_attr('accum_bits_saved') is not None
+        return layer_match and is_mult_layer and not already_applied
+
+    def _output_range(self, node, accum_precision):
+        accum_params = _fixed_params(accum_precision)
+        in_params = _fixed_params(node.get_input_variable().type.precision)
+        weight = node.get_weights('weight')
+        bias = node.get_weights('bias')
+        if in_params is None or _fixed_params(weight.type.precision) is None or _fixed_params(bias.type.precision) is None:
+            return None
+
+        # Every input can take any value of its type, the output is the sum over the last axis of the weights
+        x_low, x_high = _type_range(*in_params)
+        w = _quantize(weight.data, weight.type.precision)
+        w = w.reshape(-1, w.shape[-1])
+        high = np.sum(np.maximum(w * x_low, w * x_high), axis=0)
+        low = np.sum(np.minimum(w * x_low, w * x_high), axis=0)
+        b = _quantize(bias.data, bias.type.precision).reshape(-1)
+        high += b
+        low += b
+        low, high = np.min(low), np.max(high)
+        exact_fractional = max(in_params[2] + _fixed_params(weight.type.precision)[2], _fixed_params(bias.type.precision)[2])
+
+        fractional = min(accum_params[2], exact_fractional)
+        if fractional < exact_fractional:
+            # The products and the bias are converted to the accumulator, each of them can lose up to one LSB (truncation)
+            # or move by half an LSB (rounding)
+            n_terms = w.shape[0] + 1
+            margin = n_terms * 2.0**-fractional
+            low -= margin
+            if getattr(accum_precision, 'rounding_mode', RoundingMode.TRN) != RoundingMode.TRN:
+                high += margin / 2
+
+        return low, high, fractional
+
+    def transform(self, model, node):
+        node.set_attr('accum_bits_saved', 0)
+        node.set_attr('result_bits_saved', 0)
+
+        accum_t = node.get_attr('accum_t')
+        accum_params = _fixed_params(accum_t.precision) if accum_t is not None else None
+        out_range = self._output_range(node, accum_t.precision) if accum_params is not None else None
+        if out_range is None:
+            print(f'Skipping bit-growth analysis of {node.name}, it requires fixed-point or integer types.')
+            return False
+
+        low, high, fractional = out_range
+        old_precision = accum_t.precision
+        signed = accum_params[0] or low < 0
+        integer = _integer_bits(low, high, signed, fractional)
+        new_precision = FixedPrecisionType(
+            integer + fractional,
+            integer,
+            signed,
+            getattr(old_precision, 'rounding_mode', None),
+            getattr(old_precision, 'saturation_mode', None),
+            getattr(old_precision, 'saturation_bits', None),
+        )
+        node.set_attr('accum_t', NamedType(f'layer{node.index}_accum_t', new_precision))
+        saved = old_precision.width - new_precision.width
+        node.set_attr('accum_bits_saved', saved)
+        print(f'Layer {node.name}: accumulator {old_precision} -> {new_precision} ({saved} bits saved)')
+
+        if self.tighten_result:
+            self._tighten_result(model, node, low, high)
+
+        return False
+
+    def _tighten_result(self, model, node, low, high):
+        nodes = [node]
+        # ReLU and linear activations can only narrow the range
+        consumers = [n for n in model.graph.values() if node.outputs[0] in n.inputs]
+        while (
+            len(consumers) == 1
+            and isinstance(consumers[0], Activation)
+            and consumers[0].get_attr('activation') in ['relu', 'linear']
+        ):
+            nodes.append(consumers[0])
+            if consumers[0].get_attr('activation') == 'relu':
+                low, high = max(low, 0), max(high, 0)
+            consumers = [n for n in model.graph.values() if consumers[0].outputs[0] in n.inputs]
+
+        for res_node in nodes:
+            out_var = res_node.get_output_variable()
+            old_precision = out_var.type.precision
+            if not isinstance(old_precision, FixedPrecisionType):
+                continue
+            signed, old_integer, fractional = _fixed_params(old_precision)
+            integer = _integer_bits(low if signed else max(low, 0), high, signed, fractional)
+            if integer >= old_integer:
+                continue
+            new_precision = FixedPrecisionType(
+                integer + fractional,
+                integer,
+                signed,
+                old_precision.rounding_mode,
+                old_precision.saturation_mode,
+                old_precision.saturation_bits,
+            )
+            out_var.type.precision = new_precision
+            saved = old_precision.width - new_precision.width
+            res_node.set_attr('result_bits_saved', saved)
+            print(f'Layer {res_node.name}: result {old_precision} -> {new_precision} ({saved} bits saved)')
@@ -1,3 +1,5 @@
+from functools import reduce
+
 from hls4ml.model.optimizer import OptimizerPass
 from hls4ml.model.types import FixedPrecisionType, RoundingMode, SaturationMode
 
@@ -16,13 +18,15 @@ def get_concat_type(itype1, itype2):
     return newtype
 
 
+def get_concat_inputs_type(node):
+    return reduce(get_concat_type, [node.get_input_variable(inp).type.precision for inp in node.inputs])
+
+
 class SetPrecisionConcat(OptimizerPass):
     def match(self, node):
         if node.__class__.__name__ == 'Concatenate':
             otype = node.get_output_variable().type.precision
-            itype1 = node.get_input_variable(node.inputs[0]).type.precision
-            itype2 = node.get_input_variable(node.inputs[1]).type.precision
-            if isinstance(otype, FixedPrecisionType) and otype != get_concat_type(itype1, itype2):
+            if isinstance(otype, FixedPrecisionType) and otype != get_concat_inputs_type(node):
                 return True
         return False
 
@@ -31,9 +35,7 @@ class SetPrecisionConcat(OptimizerPass):
         Set concat output precision
         """
         otype = node.get_output_variable().type.precision
-        itype1 = node.get_input_variable(node.inputs[0]).type.precision
-        itype2 = node.get_input_variable(node.inputs[1]).type.precision
-        newtype = get_concat_type(itype1, itype2)
+        newtype = get_concat_inputs_type(node)
         print(f"Found {node.name} in the model, optimizing {otype} to {newtype}...")
         node.get_output_variable().type.precision = newtype
 
@@ -0,0 +1,264 @@
+import copy
+import multiprocessing
+import os
+import shutil
+import tempfile
+
+import numpy as np
+
+from hls4ml.model.types import FixedPrecisionType, SaturationMode
+
+# State shared with the worker processes, which inherit it when forked, so the models don't have to be pickled
+_search_state = {}
+
+
+def relative_error(y_ref, y):
+    """Mean absolute error of the predictions, relative to the mean magnitude of the reference predictions."""
+    if isinstance(y_ref, list):
+        y_ref = np.concatenate([np.ravel(y_i) for y_i in y_ref])
+        y = np.concatenate([np.ravel(y_i) for y_i in y])
+    y_ref = np.ravel(y_ref)
+    y = np.ravel(y)
+    return np.mean(np.abs(y - y_ref)) / max(np.mean(np.abs(y_ref)), np.finfo(np.float64).tiny)
+
+
+def _integer_bits(max_abs, signed):
+    """The number of integer bits for which max_abs (and -max_abs if signed) is not saturated."""
+    if max_abs <= 0:
+        return 1 if signed else 0
+    integer = int(np.floor(np.log2(max_abs))) + 1
+    return max(integer + (1 if signed else 0), 1 if signed else 0)
+
+
+def _evaluate_candidate(i):
+    model = _search_state['models'][i]
+    try:
+        model.compile()
+        y = model.predict(_search_state['x'])
+    finally:
+        shutil.rmtree(model.config.get_output_dir(), ignore_errors=True)
+    return float(_search_state['metric'](_search_state['y_ref'], y))
+
+
+class _PrecisionSearch:
+    def __init__(self, model, x, y_ref, metric, build_model, n_jobs, output_dir, saturation_mode, verbose):
+        self.model = model
+        self.x = x
+        self.y_ref = y_ref
+        self.metric = metric
+        self.build_model = build_model
+        self.n_jobs = n_jobs
+        self.output_dir = output_dir
+        self.saturation_mode = saturation_mode
+        self.verbose = verbose
+        self.n_built = 0
+
+    def make_config(self, precisions, trace=False):
+        """A copy of the model configuration with the given {(layer, var): precision} overrides."""
+        config = self.model.config.config.copy()
+        config['HLSConfig'] = copy.deepcopy(config['HLSConfig'])
+        layer_cfg = config['HLSConfig'].setdefault('LayerName', {})
+        for (layer_name, var), precision in precisions.items():
+            cfg = layer_cfg.setdefault(layer_name, {})
+            precision_cfg = cfg.get('Precision', {})
+            if not isinstance(precision_cfg, dict):
+                precision_cfg = {'default': precision_cfg}
+            precision_cfg[var] = str(precision)
+            cfg['Precision'] = precision_cfg
+        if trace:
+            for layer in self.model.get_layers():
+                layer_cfg.setdefault(layer.name, {})['Trace'] = True
+        config['OutputDir'] = os.path.join(self.output_dir, f'candidate_{self.n_built}')
+        self.n_built += 1
+        return config
+
+    def evaluate(self, candidates):
+        """Builds a model for each of the candidate precision overrides and returns their errors."""
+        _search_state['models'] = [self.build_model(self.make_config(precisions)) for precisions in candidates]
+        _search_state['x'] = self.x
+        _search_state['y_ref'] = self.y_ref
+        _search_state['metric'] = self.metric
+        try:
+            n_jobs = min(self.n_jobs, len(candidates))
+            if n_jobs > 1 and 'fork' in multiprocessing.get_all_start_methods():
+                with multiprocessing.get_context('fork').Pool(n_jobs) as pool:
+                    return pool.map(_evaluate_candidate, range(len(candidates)))
+            else:
+                return [_evaluate_candidate(i) for i in range(len(candidates))]
+        finally:
+            _search_state.clear()
+
+    def find_variables(self, types):
+        """The fixed-point variables to search and their integer bits, from the ranges of the traced calibration data."""
+        traced_model = self.build_model(self.make_config({}, trace=True))
+        try:
+            _, trace = traced_model.trace(self.x)
+        finally:
+            shutil.rmtree(traced_model.config.get_output_dir(), ignore_errors=True)
+
+        input_names = self.model.inputs
+        x_list = self.x if len(input_names) > 1 else [self.x]
+        variables = {}
+        for layer in self.model.get_layers():
+            for var in types:
+                if var == 'result':
+                    if layer.name in input_names:
+                        data = x_list[input_names.index(layer.name)]
+                    elif layer.name in trace:
+                        data = trace[layer.name]
+                    else:
+                        continue
+                    precision = layer.get_output_variable().type.precision
+                else:
+                    weight = layer.weights.get(var)
+                    if weight is None:
+                        continue
+                    data = weight.data
+                    precision = weight.type.precision
+                if not isinstance(precision, FixedPrecisionType):
+                    continue
+
+                data = np.asarray(data, dtype=np.float64)
+                signed = bool(np.any(data < 0)) if data.size > 0 else precision.signed
+                integer = _integer_bits(np.max(np.abs(data)) if data.size > 0 else 0, signed)
+                variables[(layer.name, var)] = {
+                    'signed': signed,
+                    'integer': integer,
+                    'reference': precision,
+                    # Never wider than the reference, and at least one bit wide
+                    'max_fractional': max(precision.fractional, 1 - integer),
+                }
+
+        return variables
+
+    def precision(self, variable, fractional):
+        integer = variable['integer']
+        reference = variable['reference']
+        saturation_mode = reference.saturation_mode if self.saturation_mode is None else self.saturation_mode
+        return FixedPrecisionType(
+            integer + fractional, integer, variable['signed'], reference.rounding_mode, saturation_mode
+        )
+
+    def precisions(self, variables, fractionals):
+        return {key: self.precision(variables[key], fractionals[key]) for key in variables}
+
+    def log(self, msg):
+        if self.verbose:
+            print(msg)
+
+
+def search_precision(
+    model,
+    x,
+    tolerance,
+    y_ref=None,
+    metric=relative_error,
+    types=('result',),
+    min_fractional=0,
+    build_model=None,
+    n_jobs=None,
+    output_dir=None,
+    saturation_mode='SAT',
+    verbose=True,
+):
+    """Search the narrowest per-layer fixed-point precision for which the model stays within a tolerance.
+
+    The calibration data is traced through the model to find the integer bits each layer needs. The fractional bits of
+    every layer are then found with a binary search, reducing one layer at a time from the precision of the model.
+    Since the errors of the layers add up, the combined configuration is then greedily widened by one bit at a time, in
+    the layer that reduces the error the most, until it is within the tolerance. All candidates of a step are compiled
+    and evaluated with the emulation library in parallel processes.
+
+    Args:
+        model (ModelGraph): The model, with the precision used as reference (and the upper bound of the search).
+        x (ndarray or list): The calibration data, a list of arrays for models with multiple inputs.
+        tolerance (float): The largest acceptable value of ``metric``.
+        y_ref (ndarray or list, optional): The reference predictions. If ``None``, the predictions of ``model`` are
+            used. Defaults to ``None``.
+        metric (callable, optional): ``metric(y_ref, y)`` returning the error of predictions ``y``. Defaults to the
+            mean absolute error relative to the mean magnitude of ``y_ref``.
+        types (tuple, optional): The precision variables to search, ``'result'`` and/or weight variables like
+            ``'weight'`` and ``'bias'``. Defaults to ``('result',)``.
+        min_fractional (int, optional): The smallest number of fractional bits of the search. Defaults to 0.
+        build_model (callable, optional): ``build_model(config)`` returning a ModelGraph for a copy of the model
+            configuration with a modified 'HLSConfig' and 'OutputDir'. Defaults to
+            ``hls4ml.converters.convert_from_config``.
+        n_jobs (int, optional): Number of candidates compiled and evaluated in parallel. Defaults to the number of CPUs.
+        output_dir (str, optional): Directory for the candidate projects, which are removed after evaluation. Defaults
+            to a temporary directory.
+        saturation_mode (str, optional): Saturation mode of the new types, as the integer bits only cover the range of
+            the calibration data. ``None`` keeps the mode of the reference types. Defaults to ``'SAT'``.
+        verbose (bool, optional): Print the progress of the search. Defaults to ``True``.
+
+    Raises:
+        Exception: If no configuration within the tolerance is found.
+
+    Returns:
+        dict: A copy of the 'HLSConfig' of the model with the precision of every searched layer in 'LayerName'.
+    """
+    if build_model is None:
+        from hls4ml.converters import convert_from_config
+
+        build_model = convert_from_config
+    if n_jobs is None:
+        n_jobs = os.cpu_count() or 1
+    if isinstance(saturation_mode, str):
+        saturation_mode = SaturationMode.from_string(saturation_mode)
+    if y_ref is None:
+        if model._top_function_lib is None:
+            model.compile()
+        y_ref = model.predict(x)
+
+    remove_output_dir = output_dir is None
+    if output_dir is None:
+        output_dir = tempfile.mkdtemp(prefix='hls4ml_precision_search_')
+    search = _PrecisionSearch(model, x, y_ref, metric, build_model, n_jobs, output_dir, saturation_mode, verbose)
+
+    try:
+        variables = search.find_variables(types)
+        if len(variables) == 0:
+            raise Exception('No fixed-point precision to search')
+        upper = {key: var['max_fractional'] for key, var in variables.items()}
+        lower = {key: min(max(min_fractional, 1 - var['integer']), upper[key]) for key, var in variables.items()}
+        search.log(f'Searching the precision of {len(variables)} variables with {n_jobs} parallel jobs')
+
+        # Binary search of each variable, with the others at the reference precision. The candidates of all variables
+        # are evaluated together.
+        step = 0
+        while any(lower[key] < upper[key] for key in variables):
+            keys = [key for key in variables if lower[key] < upper[key]]
+            mid = {key: (lower[key] + upper[key]) // 2 for key in keys}
+            references = {key: var['reference'] for key, var in variables.items()}
+            candidates = [{**references, key: search.precision(variables[key], mid[key])} for key in keys]
+            errors = search.evaluate(candidates)
+            for key, error in zip(keys, errors):
+                if error <= tolerance:
+                    upper[key] = mid[key]
+                else:
+                    lower[key] = mid[key] + 1
+            step += 1
+            search.log(f'Binary search step {step}: evaluated {len(keys)} candidates')
+
+        # Greedy repair of the combined configuration
+        fractionals = dict(lower)
+        error = search.evaluate([search.precisions(variables, fractionals)])[0]
+        while error > tolerance:
+            keys = [key for key in variables if fractionals[key] < variables[key]['max_fractional']]
+            if len(keys) == 0:
+                raise Exception(f'No precision within the tolerance found, the error of the widest candidate is {error}')
+            candidates = [search.precisions(variables, {**fractionals, key: fractionals[key] + 1}) for key in keys]
+            errors = search.evaluate(candidates)
+            best = int(np.argmin(errors))
+            fractionals[keys[best]] += 1
+            error = errors[best]
+            search.log(f'Widened {keys[best][0]}->{keys[best][1]}, error {error}')
+    finally:
+        if remove_output_dir:
+            shutil.rmtree(output_dir, ignore_errors=True)
+
+    hls_config = search.make_config(search.precisions(variables, fractionals))['HLSConfig']
+    for key, fractional in fractionals.items():
+        search.log(f'{key[0]}->{key[1]}: {variables[key]["reference"]} -> {search.precision(variables[key], fractional)}')
+    search.log(f'Error of the searched precision: {error}')
+
+    return hls_config
@@ -19,10 +19,21 @@ class hls4mlAttributes:
         output_precision (FixedPrecisionType): Layer output precision
         reuse_factor (int): Layer reuse factor
         parallelization_factor (int): Layer parallelization factor - [applicable to io_parallel Conv2D]
+        block_shape (tuple): Shape of the weight blocks stored by the block-sparse Resource implementation of Dense,
+            None if the blocks are not used
     '''
 
     def __init__(
-        self, n_in, n_out, io_type, strategy, weight_precision, output_precision, reuse_factor, parallelization_factor=1
+        self,
+        n_in,
+        n_out,
+        io_type,
+        strategy,
+        weight_precision,
+        output_precision,
+        reuse_factor,
+        parallelization_factor=1,
+        block_shape=None,
     ):
         if not isinstance(weight_precision, (FixedPrecisionType, IntegerPrecisionType)):
             raise Exception('Layer weight precision is not in valid format')
@@ -44,6 +55,7 @@ class hls4mlAttributes:
         self.output_precision = output_precision
         self.reuse_factor = reuse_factor
         self.parallelization_factor = parallelization_factor
+        self.block_shape = tuple(block_shape) if block_shape is not None else None
 
 
 class OptimizationAttributes:
@@ -212,6 +224,7 @@ def get_attributes_from_keras_model_and_hls4ml_config(model, config):
             reuse_factor = layer_config['ReuseFactor'] if 'ReuseFactor' in layer_config else default_reuse_factor
             parallelization_factor = layer_config['ParallelizationFactor'] if 'ParallelizationFactor' in layer_config else 1
             strategy = layer_config['Strategy'] if 'Strategy' in layer_config else default_strategy
+            block_shape = layer_config['BlockShape'] if 'BlockShape' in layer_config else None
             weight_precision = (
                 layer_config['Precision']['weight'] if 'weight' in layer_config['Precision'] else default_precision
             )
@@ -222,7 +235,15 @@ def get_attributes_from_keras_model_and_hls4ml_config(model, config):
             output_precision = hls4ml.backends.fpga.fpga_backend.FPGABackend.convert_precision_string(output_precision)
 
             hls4ml_attributes = hls4mlAttributes(
-                n_in, n_out, io_type, strategy, weight_precision, output_precision, reuse_factor, parallelization_factor
+                n_in,
+                n_out,
+                io_type,
+                strategy,
+                weight_precision,
+                output_precision,
+                reuse_factor,
+                parallelization_factor,
+                block_shape,
             )
             model_attributes[layer].update_args({'hls4ml_attributes': hls4ml_attributes})
 
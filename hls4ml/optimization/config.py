@@ -36,6 +36,7 @@ For more information, see attributes.py
     - Weight sharing: Y
     - Description: Zeroes out or quantizes all the weights in a block of size (w, h)
     - Supports: All rank-2 (e.g. Dense, but not Conv2D) layers in SUPPORTED_LAYERS (hls4ml.optimization.keras)
+    - The zero blocks are removed from Dense layers with Resource strategy and BlockShape set in the hls4ml config
 
 '''
 
@@ -82,7 +82,7 @@ def optimize_model(
         directory (string): Directory to store temporary results
         tuner (str): Tuning algorithm, choose between Bayesian, Hyperband and None
         knapsack_solver (str): Algorithm to solve Knapsack problem when optimizing;
-            default usually works well; for very large networks, greedy algorithm might be more suitable
+            default usually works well; for very large networks, greedy algorithm or the native solver might be more suitable
         regularization_range (list): List of suitable hyperparameters for weight decay
 
     Returns:
@@ -0,0 +1,229 @@
+// Native Knapsack solvers used by hls4ml.optimization.knapsack (implementation='native')
+// Compiled on first use and loaded through ctypes, see _load_native_solver()
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+void set_threads(int n_threads) {
+#ifdef _OPENMP
+    if (n_threads > 0) {
+        omp_set_num_threads(n_threads);
+    }
+#else
+    (void)n_threads;
+#endif
+}
+
+// Greedily fills the knapsack with the items in the given order, skipping the items that do not fit
+double greedy_fill(int64_t n, int64_t m, const double *values, const int64_t *weights, const int64_t *capacity,
+                   const std::vector<int64_t> &order, std::vector<uint8_t> &selected) {
+    std::vector<int64_t> load(m, 0);
+    std::fill(selected.begin(), selected.end(), 0);
+    double value = 0;
+    for (int64_t i : order) {
+        bool fits = true;
+        for (int64_t j = 0; j < m && fits; j++) {
+            fits = load[j] + weights[j * n + i] <= capacity[j];
+        }
+        if (!fits) {
+            continue;
+        }
+        for (int64_t j = 0; j < m; j++) {
+            load[j] += weights[j * n + i];
+        }
+        selected[i] = 1;
+        value += values[i];
+    }
+    return value;
+}
+
+} // namespace
+
+extern "C" {
+
+/*
+ * Exact solution of the single-constraint Knapsack problem by dynamic programming, O(n * capacity)
+ *
+ * best[w] is the highest value of the items considered so far with a total weight of at most w. For every item, the row
+ * is updated from the previous one, so all the capacities are independent and are split over the threads. Whether the
+ * item was taken at capacity w is kept in a bitset of (capacity + 1) bits per item, which is all that is needed to find
+ * the selected items afterwards. Each thread writes whole 64-bit words of the bitset.
+ *
+ * Returns the optimal value, selected[i] is set to 1 for the selected items.
+ */
+double knapsack_dp(int64_t n, const double *values, const int64_t *weights, int64_t capacity, int n_threads,
+                   uint8_t *selected) {
+    // No item fits in a negative capacity
+    if (capacity < 0) {
+        return 0;
+    }
+    set_threads(n_threads);
+
+    const int64_t n_words = (capacity + 1 + 63) / 64;
+    std::vector<uint64_t> taken(n * n_words, 0);
+    std::vector<double> prev(n_words * 64, 0.0), cur(n_words * 64, 0.0);
+
+    for (int64_t i = 0; i < n; i++) {
+        const int64_t weight = weights[i];
+        const double value = values[i];
+        uint64_t *taken_row = &taken[i * n_words];
+
+        #pragma omp parallel for schedule(static)
+        for (int64_t k = 0; k < n_words; k++) {
+            uint64_t word = 0;
+            for (int64_t b = 0; b < 64; b++) {
+                const int64_t w = k * 64 + b;
+                double best = prev[w];
+                if (w >= weight && w <= capacity && prev[w - weight] + value > best) {
+                    best = prev[w - weight] + value;
+                    word |= uint64_t(1) << b;
+                }
+                cur[w] = best;
+            }
+            taken_row[k] = word;
+        }
+        std::swap(prev, cur);
+    }
+
+    // Walk back from the full capacity
+    int64_t w = capacity;
+    for (int64_t i = n - 1; i >= 0; i--) {
+        selected[i] = (taken[i * n_words + w / 64] >> (w % 64)) & 1;
+        if (selected[i]) {
+            w -= weights[i];
+        }
+    }
+
+    return prev[capacity];
+}
+
+/*
+ * Heuristic for the multi-constraint Knapsack problem, with an upper bound on the optimal value
+ *
+ * For multipliers lambda >= 0, the m constraints are replaced by the single surrogate constraint
+ * sum_j lambda_j * A_j x <= sum_j lambda_j * W_j, which is satisfied by every feasible solution. The fractional (LP)
+ * optimum of the surrogate problem, found by taking the items in decreasing order of value / surrogate weight, is
+ * therefore an upper bound of the optimal value. The feasible solution is built by taking the items in the same order
+ * while they fit all the constraints, or the most valuable item that fits alone if it is better (which also guarantees
+ * at least half of the optimal value for a single constraint).
+ *
+ * The multipliers start at 1 / W_j and, at every iteration, the ones of the constraints overloaded by the fractional
+ * solution are increased. The best solution and the lowest bound are kept, the iterations stop early once the relative
+ * gap between them is at most gap_tolerance.
+ *
+ * Returns the value of the solution, selected[i] is set to 1 for the selected items and upper_bound to the bound.
+ */
+double knapsack_surrogate(int64_t n, int64_t m, const double *values, const int64_t *weights, const int64_t *capacity,
+                          int n_iterations, double gap_tolerance, int n_threads, uint8_t *selected, double *upper_bound) {
+    set_threads(n_threads);
+
+    std::vector<double> lambda(m);
+    for (int64_t j = 0; j < m; j++) {
+        lambda[j] = 1.0 / std::max<int64_t>(capacity[j], 1);
+    }
+
+    // Most valuable item that fits alone
+    int64_t single = -1;
+    for (int64_t i = 0; i < n; i++) {
+        bool fits = true;
+        for (int64_t j = 0; j < m && fits; j++) {
+            fits = weights[j * n + i] <= capacity[j];
+        }
+        if (fits && (single < 0 || values[i] > values[single])) {
+            single = i;
+        }
+    }
+
+    std::vector<double> surrogate(n), ratio(n);
+    std::vector<int64_t> order(n);
+    std::vector<uint8_t> candidate(n);
+    std::vector<double> fraction(n);
+    double best_value = -1;
+    double best_bound = std::numeric_limits<double>::infinity();
+
+    for (int it = 0; it < n_iterations; it++) {
+        double surrogate_capacity = 0;
+        for (int64_t j = 0; j < m; j++) {
+            surrogate_capacity += lambda[j] * capacity[j];
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < n; i++) {
+            double s = 0;
+            for (int64_t j = 0; j < m; j++) {
+                s += lambda[j] * weights[j * n + i];
+            }
+            surrogate[i] = s;
+            ratio[i] = s > 0 ? values[i] / s : std::numeric_limits<double>::infinity();
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) { return ratio[a] > ratio[b]; });
+
+        // Upper bound, fractional solution of the surrogate problem
+        double bound = 0;
+        double remaining = surrogate_capacity;
+        std::fill(fraction.begin(), fraction.end(), 0.0);
+        for (int64_t i : order) {
+            if (surrogate[i] <= remaining) {
+                fraction[i] = 1;
+                bound += values[i];
+                remaining -= surrogate[i];
+            } else {
+                fraction[i] = remaining / surrogate[i];
+                bound += values[i] * fraction[i];
+                break;
+            }
+        }
+        best_bound = std::min(best_bound, bound);
+
+        // Feasible solution
+        double value = greedy_fill(n, m, values, weights, capacity, order, candidate);
+        if (single >= 0 && values[single] > value) {
+            std::fill(candidate.begin(), candidate.end(), 0);
+            candidate[single] = 1;
+            value = values[single];
+        }
+        if (value > best_value) {
+            best_value = value;
+            std::copy(candidate.begin(), candidate.end(), selected);
+        }
+
+        if (best_bound - best_value <= gap_tolerance * best_bound) {
+            break;
+        }
+
+        // Increase the multipliers of the constraints overloaded by the fractional solution
+        double step = 1.0 / std::sqrt(it + 1.0);
+        double norm = 0;
+        for (int64_t j = 0; j < m; j++) {
+            double load = 0;
+            #pragma omp parallel for reduction(+ : load) schedule(static)
+            for (int64_t i = 0; i < n; i++) {
+                load += weights[j * n + i] * fraction[i];
+            }
+            double usage = capacity[j] > 0 ? load / capacity[j] : (load > 0 ? 2.0 : 0.0);
+            lambda[j] *= std::exp(step * (usage - 1));
+            norm += lambda[j] * capacity[j];
+        }
+        // The bound does not depend on the scale of the multipliers
+        for (int64_t j = 0; j < m && norm > 0; j++) {
+            lambda[j] /= norm;
+        }
+    }
+
+    *upper_bound = best_bound;
+    return best_value;
+}
+
+} // extern "C"
@@ -1,7 +1,16 @@
+import ctypes
+import hashlib
+import os
+import platform
+import subprocess
 import sys
+import tempfile
 import time
 
 import numpy as np
+import numpy.ctypeslib as npc
+
+from hls4ml.utils.library_cache import LibraryCache, _compiler_version
 
 
 def solve_knapsack(values, weights, capacity, implementation='CBC_MIP', **kwargs):
@@ -12,10 +21,16 @@ def solve_knapsack(values, weights, capacity, implementation='CBC_MIP', **kwargs
         - values (np.array, float): A one-dimensional array, where each entry is the value of an item
         - weights (np.array, int): An matrix, each row represents the weights of every item, in a given knapsack
         - capacity (np.array, int): A one-dimensional array, each entry is the maximum weights of a Knapsack
-        - implementation (string): Algorithm to solve Knapsack problem - dynamic programming, greedy, branch and bound
+        - implementation (string): Algorithm to solve Knapsack problem - dynamic programming, greedy, branch and bound,
+            CBC MIP or native
         - time_limit (float): Limit (in seconds) after which the CBC or Branch & Bound should
             stop looking for a solution and return optimal so far
         - scaling_factor (float): Scaling factor for floating points values in CBC or B&B
+        - n_threads (int): Number of threads used by the native solver, defaults to all the available cores
+        - n_iterations (int): Maximum number of iterations of the native multi-dimensional solver
+        - gap_tolerance (float): Relative gap to the upper bound at which the native multi-dimensional solver stops
+        - max_table_size (int): Largest tables (in bytes) the native dynamic programming solver can allocate;
+            larger single-dimensional problems are solved with the native multi-dimensional solver
 
     Returns:
         tuple containing
@@ -47,13 +62,19 @@ def solve_knapsack(values, weights, capacity, implementation='CBC_MIP', **kwargs
                 - Solution sub-optimal
                 - Time complexity: O(mn)
                 - Suitable for highly dimensional constraints or a very high number of items
+            - Native:
+                - Compiled C++ solvers, multi-threaded with OpenMP (built with g++ on first use and cached)
+                - Single-dimensional constraints: optimal, dynamic programming, time complexity O(nW), memory O(nW) bits
+                - Multi-dimensional constraints: sub-optimal, greedy on surrogate relaxations of the constraints,
+                    improved iteratively; also finds an upper bound of the optimal value, so the gap is known
+                - Suitable for a very high number of items when OR-Tools is too slow or not available
 
         - Most implementations require integer values of weights and capacities;
             For pruning & weight sharing this is never a problem
             In case non-integer weights and capacities are requires,
             All of the values should be scaled by an appropriate scaling factor
     '''
-    if implementation not in ('dynamic', 'greedy', 'branch_bound', 'CBC_MIP'):
+    if implementation not in ('dynamic', 'greedy', 'branch_bound', 'CBC_MIP', 'native'):
         raise Exception('Unknown algorithm for solving Knapsack')
 
     if len(values.shape) != 1:
@@ -75,6 +96,9 @@ def solve_knapsack(values, weights, capacity, implementation='CBC_MIP', **kwargs
     if not (np.all(values >= 0) and np.all(weights >= 0)):
         raise Exception('Current implementation of Knapsack problem requires non-negative values and weights')
 
+    if np.any(np.asarray(capacity) < 0):
+        raise Exception('Current implementation of Knapsack problem requires non-negative capacities')
+
     if not np.all(np.equal(np.mod(capacity, 1), 0)) or not np.all(np.equal(np.mod(weights, 1), 0)):
         raise Exception('Current implementation of Knapsack problem requires integer weights and capacities')
 
@@ -103,6 +127,8 @@ def solve_knapsack(values, weights, capacity, implementation='CBC_MIP', **kwargs
         optimal_value, selected_items = __solve_knapsack_branch_and_bound(values, weights, capacity, **kwargs)
     elif implementation == 'CBC_MIP':
         optimal_value, selected_items = __solve_knapsack_cbc_mip(values, weights, capacity, **kwargs)
+    elif implementation == 'native':
+        optimal_value, selected_items = __solve_knapsack_native(values, weights, capacity, **kwargs)
     else:
         optimal_value, selected_items = __solve_knapsack_greedy(values, weights, capacity)
 
@@ -260,3 +286,114 @@ def __solve_knapsack_equal_weights(values, weights, capacity):
             break
 
     return optimal, selected
+
+
+_native_solver = None
+
+
+def _load_native_solver():
+    '''
+    Helper function that compiles (on first use) and loads the native Knapsack solvers from knapsack.cpp
+    The compiled library is kept in the hls4ml library cache, keyed by the source, compiler and flags
+    The compiler can be changed with the CXX environment variable; OpenMP is used if the compiler supports it
+    '''
+    global _native_solver
+    if _native_solver is not None:
+        return _native_solver
+
+    source = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'knapsack.cpp')
+    compiler = os.environ.get('CXX', 'g++')
+    with open(source, 'rb') as f:
+        content = f.read()
+
+    # The loaded library stays mapped after the build directory is removed
+    with tempfile.TemporaryDirectory(prefix='hls4ml_knapsack_') as build_dir:
+        lib_name = os.path.join(build_dir, 'knapsack.so')
+        cache = LibraryCache()
+        for flags in (['-O3', '-std=c++14', '-fPIC', '-shared', '-fopenmp'], ['-O3', '-std=c++14', '-fPIC', '-shared']):
+            sha = hashlib.sha256()
+            sha.update(platform.system().encode() + platform.machine().encode())
+            sha.update(_compiler_version(compiler))
+            sha.update(' '.join(flags).encode())
+            sha.update(content)
+            key = 'knapsack_' + sha.hexdigest()
+            if cache.fetch(key, lib_name):
+                break
+            result = subprocess.run([compiler, *flags, source, '-o', lib_name], capture_output=True)
+            if result.returncode == 0:
+                try:
+                    cache.store(key, lib_name)
+                except OSError:
+                    pass  # Not cached, compiled again next session
+                break
+        else:
+            raise Exception(f'Failed to compile the native Knapsack solver:\n{result.stderr.decode()}')
+
+        lib = ctypes.cdll.LoadLibrary(lib_name)
+
+    f64 = npc.ndpointer(dtype=np.float64, flags='C_CONTIGUOUS')
+    i64 = npc.ndpointer(dtype=np.int64, flags='C_CONTIGUOUS')
+    u8 = npc.ndpointer(dtype=np.uint8, flags='C_CONTIGUOUS')
+
+    lib.knapsack_dp.argtypes = [ctypes.c_int64, f64, i64, ctypes.c_int64, ctypes.c_int, u8]
+    lib.knapsack_dp.restype = ctypes.c_double
+    lib.knapsack_surrogate.argtypes = [
+        ctypes.c_int64,
+        ctypes.c_int64,
+        f64,
+        i64,
+        i64,
+        ctypes.c_int,
+        ctypes.c_double,
+        ctypes.c_int,
+        u8,
+        ctypes.POINTER(ctypes.c_double),
+    ]
+    lib.knapsack_surrogate.restype = ctypes.c_double
+
+    _native_solver = lib
+    return lib
+
+
+def __solve_knapsack_native(
+    values,
+    weights,
+    capacity,
+    n_threads=0,
+    n_iterations=100,
+    gap_tolerance=1e-3,
+    max_table_size=2**30,
+    **kwargs,
+):
+    '''
+    Helper function to solve the Knapsack problem with the compiled solvers in knapsack.cpp
+    Single-dimensional problems are solved exactly with dynamic programming, if the table of selected items,
+    of N * (W + 1) bits, and the two rows of values, of W + 1 doubles each, fit in max_table_size bytes;
+    otherwise, and for multi-dimensional problems,
+    the surrogate relaxation heuristic is used, which also reports an upper bound of the optimal value
+
+    Additional args:
+        - n_threads - Number of OpenMP threads, 0 to use the default (all the available cores)
+        - n_iterations - Maximum number of updates of the surrogate multipliers
+        - gap_tolerance - Relative gap between the solution and the upper bound at which the heuristic stops
+        - max_table_size - Memory limit (bytes) of the dynamic programming tables
+    '''
+    lib = _load_native_solver()
+
+    n = values.shape[0]
+    values = np.ascontiguousarray(values, dtype=np.float64)
+    weights = np.ascontiguousarray(weights, dtype=np.int64)
+    capacity = np.ascontiguousarray(np.reshape(capacity, -1), dtype=np.int64)
+    selected = np.zeros(n, dtype=np.uint8)
+
+    if weights.shape[0] == 1 and n * (capacity[0] + 1) / 8 + 16 * (capacity[0] + 1) <= max_table_size:
+        optimal = lib.knapsack_dp(n, values, weights[0].copy(), capacity[0], n_threads, selected)
+    else:
+        upper_bound = ctypes.c_double(0)
+        optimal = lib.knapsack_surrogate(
+            n, weights.shape[0], values, weights, capacity, n_iterations, gap_tolerance, n_threads, selected, upper_bound
+        )
+        gap = (upper_bound.value - optimal) / upper_bound.value if upper_bound.value > 0 else 0
+        print(f'Native Knapsack solution {optimal}, upper bound {upper_bound.value} (gap at most {100 * gap:.2f}%)')
+
+    return optimal, np.flatnonzero(selected).tolist()
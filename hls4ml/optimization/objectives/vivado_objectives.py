@@ -15,7 +15,13 @@ class VivadoDSPEstimator(ObjectiveEstimator):
         if not layer_attributes.weight_shape or layer_attributes.args['hls4ml_attributes'].weight_precision.width < 9:
             return False, None
         else:
-            if layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource':
+            block_shape = layer_attributes.args['hls4ml_attributes'].block_shape
+            if layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource' and block_shape is not None:
+                # The zero blocks are removed from the block-sparse Resource implementation
+                return True, OptimizationAttributes(
+                    SUPPORTED_STRUCTURES.BLOCK, pruning=True, weight_sharing=False, block_shape=block_shape
+                )
+            elif layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource':
                 return True, OptimizationAttributes(
                     SUPPORTED_STRUCTURES.PATTERN,
                     pruning=True,
@@ -78,8 +84,14 @@ class VivadoDSPEstimator(ObjectiveEstimator):
                 else:
                     return [0]
             elif structure_type == SUPPORTED_STRUCTURES.BLOCK:
-                logging.warn('hls4ml does not support block sparsity patterns...setting layer savings to zero')
-                return [0]
+                # Every reuse cycle of the block-sparse implementation multiplies n_blocks / reuse_factor blocks
+                if layer_attributes.args['hls4ml_attributes'].block_shape is None:
+                    logging.warn('Block sparsity requires BlockShape in the layer config...setting layer savings to zero')
+                    return [0]
+                return [
+                    np.prod(layer_attributes.optimization_attributes.block_shape)
+                    / layer_attributes.args['hls4ml_attributes'].reuse_factor
+                ]
 
 
 # Optimizes BRAM and DSP for Vivado backend
@@ -90,6 +102,16 @@ class VivadoMultiObjectiveEstimator(ObjectiveEstimator):
             return False, None
 
         if (
+            layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource'
+            and layer_attributes.args['hls4ml_attributes'].block_shape is not None
+        ):
+            return True, OptimizationAttributes(
+                SUPPORTED_STRUCTURES.BLOCK,
+                pruning=True,
+                weight_sharing=False,
+                block_shape=layer_attributes.args['hls4ml_attributes'].block_shape,
+            )
+        elif (
             layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource'
             and layer_attributes.args['hls4ml_attributes'].reuse_factor > 1
         ):
@@ -165,6 +187,17 @@ class VivadoMultiObjectiveEstimator(ObjectiveEstimator):
                 return [0, 0]
         else:
             if (
+                structure_type == SUPPORTED_STRUCTURES.BLOCK
+                and layer_attributes.args['hls4ml_attributes'].block_shape is not None
+            ):
+                # A removed block frees block_size / reuse_factor multipliers and as many BRAM bits per reuse cycle
+                block_size = np.prod(layer_attributes.optimization_attributes.block_shape)
+                reuse_factor = layer_attributes.args['hls4ml_attributes'].reuse_factor
+                weight_precision = layer_attributes.args['hls4ml_attributes'].weight_precision.width
+                if reuse_factor == 1:
+                    return [block_size, 0]
+                return [block_size / reuse_factor, block_size * weight_precision / (reuse_factor * 36)]
+            elif (
                 layer_attributes.args['hls4ml_attributes'].strategy.lower() == 'resource'
                 and layer_attributes.args['hls4ml_attributes'].reuse_factor == 1
             ):
@@ -99,6 +99,59 @@ void normalize_ternary_tanh(data_T data[CONFIG_T::n_in], ac_int<2, true> res[CON
     }
 }
 
+// ****************************************************
+//       Merged Batch Normalization and n-bit Quantized Activation
+// ****************************************************
+struct batchnorm_quantized_threshold_config {
+    // Layer Sizes
+    static const unsigned n_in = 10;
+    static const unsigned n_filt = -1;
+    static const unsigned n_scale_bias = 10;
+
+    // Thresholds per channel (2^n - 1) and raw value of the lowest output level
+    static const unsigned n_thresholds = 3;
+    static const int code_lo = 0;
+    typedef ac_fixed<17, 7, true> threshold_t;
+    typedef ac_int<1, false> direction_t;
+
+    // Resource reuse info
+    static const unsigned io_type = io_parallel;
+    static const unsigned reuse_factor = 1;
+    static const unsigned n_zeros = 0;
+};
+
+// Output level of one input: the number of thresholds of the channel that are reached, counted downwards if the
+// direction of the channel is 0 (negative scale). The level is written as the raw bits of the output.
+template <class data_T, class res_T, typename CONFIG_T>
+res_T quantized_threshold_level(data_T x, const typename CONFIG_T::threshold_t *threshold,
+                                typename CONFIG_T::direction_t direction) {
+    ac_int<8, false> count = 0;
+ThresholdCompare:
+    #pragma unroll
+    for (int it = 0; it < CONFIG_T::n_thresholds; it++) {
+        if (x >= threshold[it])
+            count++;
+    }
+    int level = direction ? (int)count : (int)CONFIG_T::n_thresholds - (int)count;
+
+    res_T res;
+    res.set_slc(0, ac_int<res_T::width, true>(CONFIG_T::code_lo + level));
+    return res;
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void normalize_quantized_threshold(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in],
+                                   const typename CONFIG_T::threshold_t
+                                       threshold[CONFIG_T::n_scale_bias * CONFIG_T::n_thresholds],
+                                   const typename CONFIG_T::direction_t direction[CONFIG_T::n_scale_bias]) {
+    #pragma unroll
+    for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
+        int norm_index = CONFIG_T::n_filt == -1 ? ii : ii % CONFIG_T::n_filt;
+        res[ii] = quantized_threshold_level<data_T, res_T, CONFIG_T>(
+            data[ii], &threshold[norm_index * CONFIG_T::n_thresholds], direction[norm_index]);
+    }
+}
+
 } // namespace nnet
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef NNET_BATCHNORM_STREAM_H_
 #define NNET_BATCHNORM_STREAM_H_
 
+#include "nnet_batchnorm.h"
 #include "nnet_common.h"
 #include "nnet_helpers.h"
 #include "nnet_mult.h"
@@ -103,6 +104,35 @@ TernaryNormLoop:
     }
 }
 
+template <class data_T, class res_T, typename CONFIG_T>
+void normalize_quantized_threshold(stream<data_T> &data, stream<res_T> &res,
+                                   const typename CONFIG_T::threshold_t
+                                       threshold[CONFIG_T::n_scale_bias * CONFIG_T::n_thresholds],
+                                   const typename CONFIG_T::direction_t direction[CONFIG_T::n_scale_bias]) {
+
+ThresholdNormLoop:
+    #pragma ii 1
+    for (int i = 0; i < CONFIG_T::n_in / data_T::size; i++) {
+        data_T in_data = data.read();
+        res_T out_data;
+
+    BatchNormPack:
+        #pragma unroll
+        for (int j = 0; j < data_T::size; j++) {
+            int norm_index;
+            if (CONFIG_T::n_filt == -1)
+                norm_index = i * data_T::size + j;
+            else
+                norm_index = j % CONFIG_T::n_filt;
+
+            out_data[j] = quantized_threshold_level<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(
+                in_data[j], &threshold[norm_index * CONFIG_T::n_thresholds], direction[norm_index]);
+        }
+
+        res.write(out_data);
+    }
+}
+
 } // namespace nnet
 
 #endif
@@ -2,6 +2,7 @@
 #define NNET_HELPERS_H
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -43,6 +44,42 @@ template <class srcType, class dstType, size_t SIZE> void convert_data_back(stre
     }
 }
 
+// Raw conversion, the integers are the underlying bit patterns of the fixed-point values (no rounding/quantization)
+template <class dstType, class srcType> dstType fixed_to_raw(const srcType &x) {
+    return static_cast<dstType>(x.template slc<srcType::width>(0).to_int64());
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_from_raw(srcType *src, dstType *dst) {
+    for (size_t i = 0; i < SIZE; i++) {
+        dst[i].set_slc(0, ac_int<dstType::width, false>(src[i]));
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_from_raw(srcType *src, stream_in<dstType> &dst) {
+    for (size_t i = 0; i < SIZE / dstType::size; i++) {
+        dstType ctype;
+        for (size_t j = 0; j < dstType::size; j++) {
+            ctype[j].set_slc(0, ac_int<dstType::value_type::width, false>(src[i * dstType::size + j]));
+        }
+        dst.write(ctype);
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_to_raw(srcType *src, dstType *dst) {
+    for (size_t i = 0; i < SIZE; i++) {
+        dst[i] = fixed_to_raw<dstType>(src[i]);
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_to_raw(stream_out<srcType> &src, dstType *dst) {
+    for (size_t i = 0; i < SIZE / srcType::size; i++) {
+        srcType ctype = src.read();
+        for (size_t j = 0; j < srcType::size; j++) {
+            dst[i * srcType::size + j] = fixed_to_raw<dstType>(ctype[j]);
+        }
+    }
+}
+
 extern bool trace_enabled;
 extern std::map<std::string, void *> *trace_outputs;
 extern size_t trace_type_size;
@@ -135,6 +172,29 @@ template <class data_T> void save_layer_output(stream<data_T> &data, const char
     }
 }
 
+#ifndef HLS_SYNTHESIS
+
+// Per-layer profiling, the table is defined in the bridge of projects compiled with LayerProfiling enabled
+struct layer_profile_data {
+    const char *name;
+    unsigned long long calls;
+    unsigned long long time_ns;
+};
+
+extern layer_profile_data layer_profile[];
+
+inline unsigned long long profile_timestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+inline void profile_layer(unsigned index, unsigned long long start) {
+    layer_profile[index].time_ns += profile_timestamp() - start;
+    layer_profile[index].calls++;
+}
+
+#endif
+
 } // namespace nnet
 
 #endif
@@ -0,0 +1,109 @@
+#ifndef NNET_LAYERNORM_H_
+#define NNET_LAYERNORM_H_
+
+#include "nnet_common.h"
+#include "nnet_helpers.h"
+#include "nnet_mult.h"
+
+namespace nnet {
+
+struct layernorm_config {
+    // Internal data type definitions
+    typedef float bias_t;
+    typedef float scale_t;
+    typedef float accum_t;
+    typedef ac_fixed<18, 2, true> table_t;
+
+    // Layer Sizes
+    static const unsigned n_in = 20;
+    static const unsigned seq_len = 1;
+    static const unsigned table_size = 1024;
+
+    // Resource reuse info
+    static const unsigned io_type = io_parallel;
+    static const unsigned reuse_factor = 1;
+    static const bool store_weights_in_bram = false;
+
+    // Default multiplication
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+// Normalizes one row of n_in elements in a single pass. The sums of x and x^2 are exact in accum_t, so that
+//   (x - mean) / sqrt(var + eps) = (n * x - sum(x)) / sqrt(n * sum(x^2) - sum(x)^2 + n^2 * eps)
+// needs no division. The inverse square root of v = m * 4^k, m in [1, 4), is 1/sqrt(m) from the table shifted by k bits.
+// The table of each layer is written by the QuartusWriter and read through CONFIG_T::invert_sqrt(), its top address
+// bit selects [1, 2) or [2, 4).
+template <class data_T, class res_T, typename CONFIG_T>
+void layernorm_1d(const data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in],
+                  const typename CONFIG_T::scale_t scale[CONFIG_T::n_in], const typename CONFIG_T::bias_t bias[CONFIG_T::n_in]) {
+    typedef typename CONFIG_T::accum_t accum_t;
+    static constexpr int W = accum_t::width;
+    static constexpr int F = accum_t::width - accum_t::i_width;
+    static constexpr int N = ceillog2(CONFIG_T::table_size);
+
+    hls_register accum_t sum = 0;
+    hls_register accum_t sum_sq = 0;
+Accumulate:
+    #pragma unroll
+    for (int i = 0; i < CONFIG_T::n_in; i++) {
+        sum += data[i];
+        sum_sq += data[i] * data[i];
+    }
+
+    hls_register accum_t var_n2 = sum_sq * CONFIG_T::n_in - sum * sum;
+    var_n2 += (accum_t)(CONFIG_T::epsilon * CONFIG_T::n_in * CONFIG_T::n_in);
+
+    // Leading one of the (non-negative) variance
+    hls_register ac_int<W, false> var_bits = var_n2.template slc<W>(0);
+    int msb = -1;
+LeadingOne:
+    #pragma unroll
+    for (int b = 0; b < W; b++) {
+        if (var_bits[b])
+            msb = b;
+    }
+
+    if (msb < 0) {
+        // All inputs are equal and there is no epsilon, the normalized values are 0
+        #pragma unroll
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            res[i] = bias[i];
+        }
+        return;
+    }
+
+    int exponent = msb - F; // var_n2 is in [2^exponent, 2^(exponent + 1))
+    int odd = exponent & 1;
+    int shift = (exponent - odd) / 2;
+    hls_register ac_int<W, false> var_norm = var_bits << (W - 1 - msb);
+    unsigned index = (odd << (N - 1)) | var_norm.template slc<N - 1>(W - N).to_uint();
+    hls_register typename CONFIG_T::table_t inv_sqrt_m = CONFIG_T::invert_sqrt(index);
+
+Normalize:
+    #pragma unroll
+    for (int i = 0; i < CONFIG_T::n_in; i++) {
+        hls_register accum_t diff = data[i] * CONFIG_T::n_in - sum;
+        hls_register accum_t norm = diff * inv_sqrt_m;
+        if (shift >= 0) {
+            norm = norm >> shift;
+        } else {
+            norm = norm << -shift;
+        }
+        res[i] = CONFIG_T::template product<accum_t, typename CONFIG_T::scale_t>::product(norm, scale[i]) + bias[i];
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void layernormalize(data_T data[CONFIG_T::seq_len * CONFIG_T::n_in], res_T res[CONFIG_T::seq_len * CONFIG_T::n_in],
+                    const typename CONFIG_T::scale_t scale[CONFIG_T::n_in],
+                    const typename CONFIG_T::bias_t bias[CONFIG_T::n_in]) {
+LayerNormLoop:
+    #pragma unroll
+    for (int j = 0; j < CONFIG_T::seq_len; j++) {
+        layernorm_1d<data_T, res_T, CONFIG_T>(&data[j * CONFIG_T::n_in], &res[j * CONFIG_T::n_in], scale, bias);
+    }
+}
+
+} // namespace nnet
+
+#endif
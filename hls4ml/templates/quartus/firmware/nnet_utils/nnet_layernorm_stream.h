@@ -0,0 +1,48 @@
+#ifndef NNET_LAYERNORM_STREAM_H_
+#define NNET_LAYERNORM_STREAM_H_
+
+#include "nnet_common.h"
+#include "nnet_helpers.h"
+#include "nnet_layernorm.h"
+#include "nnet_mult.h"
+#include "nnet_types.h"
+
+namespace nnet {
+
+// ****************************************************
+//       Streaming Layer Normalization
+// ****************************************************
+// Each element of the stream is one row of n_in elements, normalized as soon as it is read
+template <class data_T, class res_T, typename CONFIG_T>
+void layernormalize(stream<data_T> &data, stream<res_T> &res, const typename CONFIG_T::scale_t scale[CONFIG_T::n_in],
+                    const typename CONFIG_T::bias_t bias[CONFIG_T::n_in]) {
+    constexpr unsigned multiplier_limit = DIV_ROUNDUP(CONFIG_T::n_in, CONFIG_T::reuse_factor);
+    constexpr unsigned pipeline = CONFIG_T::n_in / multiplier_limit;
+    CONFIG_T::template product<typename CONFIG_T::accum_t, typename CONFIG_T::scale_t>::limit(multiplier_limit);
+
+LayerNormLoop:
+    #pragma ii pipeline
+    for (int j = 0; j < CONFIG_T::seq_len; j++) {
+        data_T in_data = data.read();
+        hls_register typename data_T::value_type in_row[CONFIG_T::n_in];
+        hls_register typename res_T::value_type out_row[CONFIG_T::n_in];
+
+        #pragma unroll
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            in_row[i] = in_data[i];
+        }
+
+        layernorm_1d<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(in_row, out_row, scale, bias);
+
+        res_T out_data;
+        #pragma unroll
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            out_data[i] = out_row[i];
+        }
+        res.write(out_data);
+    }
+}
+
+} // namespace nnet
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef NNET_SEPARABLE_CONV_H_
+#define NNET_SEPARABLE_CONV_H_
+
+#include "nnet_common.h"
+#include "nnet_dense.h"
+#include "nnet_mult.h"
+
+namespace nnet {
+
+/*
+ * void depthwise_product(data, res, weights, biases)
+ *
+ * Args:
+ *   data - kernel window, stored as [kernel_size][n_chan]
+ *   res - one output per channel
+ *   weights - depthwise kernel, stored as [kernel_size][n_chan]
+ *   biases - one bias per channel
+ *
+ * Every channel is convolved with its own kernel, so the window is not a dense matrix multiplication. The products are
+ * computed in reuse_factor steps of block_factor multipliers. The reuse factor divides the kernel size, so each step covers
+ * whole kernel positions and multiplier im always accumulates into channel im % n_chan.
+ */
+template <class data_T, class res_T, typename CONFIG_T>
+void depthwise_product(data_T data[CONFIG_T::kernel_size * CONFIG_T::n_chan], res_T res[CONFIG_T::n_chan],
+                       const typename CONFIG_T::weight_t weights[CONFIG_T::kernel_size * CONFIG_T::n_chan],
+                       const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+    assert((CONFIG_T::kernel_size % CONFIG_T::reuse_factor == 0) && "The reuse factor must divide the kernel size");
+
+    static constexpr int block_factor = CONFIG_T::kernel_size / CONFIG_T::reuse_factor * CONFIG_T::n_chan;
+
+    hls_register typename CONFIG_T::accum_t acc[CONFIG_T::n_chan];
+InitAccum:
+    #pragma unroll
+    for (int iacc = 0; iacc < CONFIG_T::n_chan; iacc++) {
+        acc[iacc] = (typename CONFIG_T::accum_t)biases[iacc];
+    }
+
+ReuseLoop:
+    #pragma nofusion
+    #pragma speculated_iterations 0
+    for (int ir = 0; ir < CONFIG_T::reuse_factor; ir++) {
+    MultLoop:
+        #pragma unroll
+        for (int im = 0; im < block_factor; im++) {
+            int index = ir * block_factor + im;
+            acc[im % CONFIG_T::n_chan] +=
+                CONFIG_T::mult_config::template product<data_T, typename CONFIG_T::weight_t>::product(data[index],
+                                                                                                       weights[index]);
+        }
+    }
+
+// Cast to "res_t" type
+Result:
+    #pragma unroll
+    for (int ires = 0; ires < CONFIG_T::n_chan; ires++) {
+        res[ires] = cast<data_T, res_T, typename CONFIG_T::mult_config>(acc[ires]);
+    }
+}
+
+} // namespace nnet
+
+#endif
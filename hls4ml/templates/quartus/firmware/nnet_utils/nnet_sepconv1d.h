@@ -0,0 +1,88 @@
+#ifndef NNET_SEPARABLE_CONV1D_H_
+#define NNET_SEPARABLE_CONV1D_H_
+
+#include "nnet_common.h"
+#include "nnet_conv1d.h"
+#include "nnet_dense.h"
+#include "nnet_sepconv.h"
+
+namespace nnet {
+
+// ****************************************************************
+//      im2col - Depthwise 1D Convolution
+// ****************************************************************
+
+template <class data_T, class res_T, typename CONFIG_T>
+void depthwise_conv_1d_cl(data_T data[CONFIG_T::in_width * CONFIG_T::n_chan],
+                          res_T res[CONFIG_T::out_width * CONFIG_T::n_chan],
+                          const typename CONFIG_T::weight_t weights[CONFIG_T::filt_width * CONFIG_T::n_chan],
+                          const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+    assert(CONFIG_T::filt_width == CONFIG_T::impl_filt_width);
+
+    // Unroll factor for loop traversing input image, derived from parallelisation_factor
+    static constexpr int pf = MIN(CONFIG_T::parallelisation_factor, CONFIG_T::out_width);
+
+ColLoop:
+    #pragma unroll pf
+    #pragma ii CONFIG_T::reuse_factor
+    for (int i = 0; i < CONFIG_T::out_width; i++) {
+        hls_register data_T data_col[CONFIG_T::filt_width * CONFIG_T::n_chan];
+        im2col_1d_cl<data_T, CONFIG_T>(data, data_col, i);
+
+        hls_register res_T res_col[CONFIG_T::n_chan];
+        depthwise_product<data_T, res_T, CONFIG_T>(data_col, res_col, weights, biases);
+
+    ChanLoop:
+        #pragma unroll
+        for (int k = 0; k < CONFIG_T::n_chan; k++) {
+            res[i * CONFIG_T::n_chan + k] = res_col[k];
+        }
+    }
+}
+
+// ****************************************************************
+//      im2col - Separable 1D Convolution
+// ****************************************************************
+
+// The depthwise output of each pixel is passed directly to the pointwise multiplication, so the intermediate image of
+// dw_res_T values is never stored
+template <class data_T, class dw_res_T, class res_T, typename CONFIG_T>
+void separable_conv_1d_cl(
+    data_T data[CONFIG_T::depthwise_config::in_width * CONFIG_T::depthwise_config::n_chan],
+    res_T res[CONFIG_T::depthwise_config::out_width * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::weight_t
+        depthwise_weights[CONFIG_T::depthwise_config::filt_width * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::weight_t
+        pointwise_weights[CONFIG_T::pointwise_config::n_chan * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::bias_t depthwise_biases[CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::bias_t pointwise_biases[CONFIG_T::pointwise_config::n_filt]) {
+    typedef typename CONFIG_T::depthwise_config dw_config;
+    typedef typename CONFIG_T::pointwise_config pw_config;
+
+    static constexpr int pf = MIN(dw_config::parallelisation_factor, dw_config::out_width);
+
+ColLoop:
+    #pragma unroll pf
+    #pragma ii CONFIG_T::pointwise_config::reuse_factor
+    for (int i = 0; i < dw_config::out_width; i++) {
+        hls_register data_T data_col[dw_config::filt_width * dw_config::n_chan];
+        im2col_1d_cl<data_T, dw_config>(data, data_col, i);
+
+        hls_register dw_res_T dw_col[dw_config::n_chan];
+        depthwise_product<data_T, dw_res_T, dw_config>(data_col, dw_col, depthwise_weights, depthwise_biases);
+
+        hls_register res_T res_col[pw_config::n_filt];
+        dense_resource<dw_res_T, res_T, typename pw_config::mult_config>(dw_col, res_col, pointwise_weights,
+                                                                        pointwise_biases);
+
+    FiltLoop:
+        #pragma unroll
+        for (int k = 0; k < pw_config::n_filt; k++) {
+            res[i * pw_config::n_filt + k] = res_col[k];
+        }
+    }
+}
+
+} // namespace nnet
+
+#endif
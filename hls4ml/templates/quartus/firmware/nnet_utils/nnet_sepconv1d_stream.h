@@ -0,0 +1,203 @@
+#ifndef NNET_SEPARABLE_CONV1D_STREAM_H_
+#define NNET_SEPARABLE_CONV1D_STREAM_H_
+
+#include "nnet_conv1d_stream.h"
+#include "nnet_dense.h"
+#include "nnet_sepconv.h"
+#include "nnet_types.h"
+
+namespace nnet {
+
+/*
+ * bool kernel_window_ready_1d()
+ *
+ * Counter housekeeping of compute_output_buffer_1d, called once for every pixel (including padding) shifted into the
+ * kernel window. Returns true if the kernel window holds a full kernel at a strided position, and moves to the next pixel.
+ */
+template <typename CONFIG_T> bool kernel_window_ready_1d() {
+    // Thresholds
+    static constexpr int lShiftX = CONFIG_T::filt_width - 1;
+
+    // X position pixel
+    static int pX = 0;
+
+    // X strides
+    static int sX = 0;
+
+    bool ready = (sX - lShiftX) == 0 && pX > (lShiftX - 1);
+
+    // Reached end of image
+    if ((pX + 1) == (CONFIG_T::in_width + CONFIG_T::pad_left + CONFIG_T::pad_right)) {
+        pX = 0;
+        sX = 0;
+        // Move to the right
+    } else {
+        pX++;
+        sX = ((sX - lShiftX) == 0) ? (sX - CONFIG_T::stride_width + 1) : (sX + 1);
+    }
+
+    return ready;
+}
+
+// ****************************************************************
+//      Line buffer - Depthwise 1D Convolution
+// ****************************************************************
+
+template <class data_T, class res_T, typename CONFIG_T>
+void compute_depthwise_output_buffer_1d(
+    const data_T &in_elem, stream<res_T> &res_stream,
+    nnet::shift_reg<typename data_T::value_type, CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right>
+        line_buffer[CONFIG_T::n_chan],
+    typename data_T::value_type kernel_window[CONFIG_T::filt_width * CONFIG_T::n_chan],
+    const typename CONFIG_T::weight_t weights[CONFIG_T::kernel_size * CONFIG_T::n_chan],
+    const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+    // Shift line buffer and kernel window
+    hls_register typename data_T::value_type shift_buffer[CONFIG_T::n_chan];
+    nnet::shift_line_buffer_1d<data_T, CONFIG_T>(in_elem, line_buffer, shift_buffer);
+    nnet::kernel_shift_1d<data_T, CONFIG_T>(shift_buffer, kernel_window);
+
+    if (kernel_window_ready_1d<CONFIG_T>()) {
+        hls_register typename res_T::value_type res_out[CONFIG_T::n_chan];
+        depthwise_product<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(kernel_window, res_out,
+                                                                                            weights, biases);
+
+        hls_register res_T res_pack;
+    CastLoop:
+        #pragma unroll
+        for (int channel = 0; channel < CONFIG_T::n_chan; channel++) {
+            res_pack[channel] = res_out[channel];
+        }
+        res_stream.write(res_pack);
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void depthwise_conv_1d_cl(stream<data_T> &data, stream<res_T> &res,
+                          const typename CONFIG_T::weight_t weights[CONFIG_T::filt_width * CONFIG_T::n_chan],
+                          const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+    // Line buffer and kernel window
+    hls_register static nnet::shift_reg<typename data_T::value_type,
+                                        CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right>
+        line_buffer[CONFIG_T::n_chan];
+    hls_register static typename data_T::value_type kernel_window[CONFIG_T::filt_width * CONFIG_T::n_chan];
+
+    // An array of length CONFIG_T::n_chan, with elements set to zero (padding for each channel)
+    static const data_T padds(0);
+
+// Input image left-side padding
+PaddingLeftWidth:
+    for (int col = 0; col < CONFIG_T::pad_left; col++) {
+        compute_depthwise_output_buffer_1d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                    biases);
+    }
+
+// Read input image
+ReadInputWidth:
+    for (int col = 0; col < CONFIG_T::in_width; col++) {
+        compute_depthwise_output_buffer_1d<data_T, res_T, CONFIG_T>(data.read(), res, line_buffer, kernel_window, weights,
+                                                                    biases);
+    }
+
+// Input image right-side padding
+PaddingRightWidth:
+    for (int col = 0; col < CONFIG_T::pad_right; col++) {
+        compute_depthwise_output_buffer_1d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                    biases);
+    }
+}
+
+// ****************************************************************
+//      Line buffer - Separable 1D Convolution
+// ****************************************************************
+
+// The depthwise output of a full kernel window is passed directly to the pointwise multiplication, so no intermediate
+// stream is needed between the two steps
+template <class data_T, class dw_res_T, class res_T, typename CONFIG_T>
+void compute_separable_output_buffer_1d(
+    const data_T &in_elem, stream<res_T> &res_stream,
+    nnet::shift_reg<typename data_T::value_type, CONFIG_T::depthwise_config::pad_left +
+                                                     CONFIG_T::depthwise_config::in_width +
+                                                     CONFIG_T::depthwise_config::pad_right>
+        line_buffer[CONFIG_T::depthwise_config::n_chan],
+    typename data_T::value_type kernel_window[CONFIG_T::depthwise_config::filt_width * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::depthwise_config::weight_t
+        depthwise_weights[CONFIG_T::depthwise_config::kernel_size * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::weight_t
+        pointwise_weights[CONFIG_T::pointwise_config::n_chan * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::bias_t depthwise_biases[CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::bias_t pointwise_biases[CONFIG_T::pointwise_config::n_filt]) {
+    typedef typename CONFIG_T::depthwise_config dw_config;
+    typedef typename CONFIG_T::pointwise_config pw_config;
+
+    // Shift line buffer and kernel window
+    hls_register typename data_T::value_type shift_buffer[dw_config::n_chan];
+    nnet::shift_line_buffer_1d<data_T, dw_config>(in_elem, line_buffer, shift_buffer);
+    nnet::kernel_shift_1d<data_T, dw_config>(shift_buffer, kernel_window);
+
+    if (kernel_window_ready_1d<dw_config>()) {
+        hls_register dw_res_T dw_out[dw_config::n_chan];
+        depthwise_product<typename data_T::value_type, dw_res_T, dw_config>(kernel_window, dw_out, depthwise_weights,
+                                                                           depthwise_biases);
+
+        hls_register typename res_T::value_type res_out[pw_config::n_filt];
+        dense_resource<dw_res_T, typename res_T::value_type, typename pw_config::mult_config>(
+            dw_out, res_out, pointwise_weights, pointwise_biases);
+
+        hls_register res_T res_pack;
+    CastLoop:
+        #pragma unroll
+        for (int channel = 0; channel < pw_config::n_filt; channel++) {
+            res_pack[channel] = res_out[channel];
+        }
+        res_stream.write(res_pack);
+    }
+}
+
+template <class data_T, class dw_res_T, class res_T, typename CONFIG_T>
+void separable_conv_1d_cl(
+    stream<data_T> &data, stream<res_T> &res,
+    const typename CONFIG_T::depthwise_config::weight_t
+        depthwise_weights[CONFIG_T::depthwise_config::filt_width * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::weight_t
+        pointwise_weights[CONFIG_T::pointwise_config::n_chan * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::bias_t depthwise_biases[CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::bias_t pointwise_biases[CONFIG_T::pointwise_config::n_filt]) {
+    typedef typename CONFIG_T::depthwise_config dw_config;
+
+    // Line buffer and kernel window
+    hls_register static nnet::shift_reg<typename data_T::value_type,
+                                        dw_config::pad_left + dw_config::in_width + dw_config::pad_right>
+        line_buffer[dw_config::n_chan];
+    hls_register static typename data_T::value_type kernel_window[dw_config::filt_width * dw_config::n_chan];
+
+    // An array of length n_chan, with elements set to zero (padding for each channel)
+    static const data_T padds(0);
+
+// Input image left-side padding
+PaddingLeftWidth:
+    for (int col = 0; col < dw_config::pad_left; col++) {
+        compute_separable_output_buffer_1d<data_T, dw_res_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window,
+                                                                              depthwise_weights, pointwise_weights,
+                                                                              depthwise_biases, pointwise_biases);
+    }
+
+// Read input image
+ReadInputWidth:
+    for (int col = 0; col < dw_config::in_width; col++) {
+        compute_separable_output_buffer_1d<data_T, dw_res_T, res_T, CONFIG_T>(data.read(), res, line_buffer, kernel_window,
+                                                                              depthwise_weights, pointwise_weights,
+                                                                              depthwise_biases, pointwise_biases);
+    }
+
+// Input image right-side padding
+PaddingRightWidth:
+    for (int col = 0; col < dw_config::pad_right; col++) {
+        compute_separable_output_buffer_1d<data_T, dw_res_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window,
+                                                                              depthwise_weights, pointwise_weights,
+                                                                              depthwise_biases, pointwise_biases);
+    }
+}
+
+} // namespace nnet
+
+#endif
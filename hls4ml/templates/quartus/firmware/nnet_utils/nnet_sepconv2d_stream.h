@@ -0,0 +1,275 @@
+#ifndef NNET_SEPARABLE_CONV2D_STREAM_H_
+#define NNET_SEPARABLE_CONV2D_STREAM_H_
+
+#include "nnet_conv2d_stream.h"
+#include "nnet_dense.h"
+#include "nnet_sepconv.h"
+#include "nnet_types.h"
+
+namespace nnet {
+
+/*
+ * bool kernel_window_ready_2d()
+ *
+ * Counter housekeeping of compute_output_buffer_2d, called once for every pixel (including padding) shifted into the line
+ * buffer. Returns true if the kernel window holds a full kernel at a strided position, and moves to the next pixel.
+ */
+template <typename CONFIG_T> bool kernel_window_ready_2d() {
+    // Thresholds
+    static constexpr int lShiftX = CONFIG_T::filt_width - 1;
+    static constexpr int lShiftY = CONFIG_T::filt_height - 1;
+
+    // X, Y position pixels
+    static int pX = 0;
+    static int pY = 0;
+
+    // X, Y strides
+    static int sX = 0;
+    static int sY = 0;
+
+    bool ready = (sX - lShiftX) == 0 && (sY - lShiftY) == 0 && pY > (lShiftY - 1) && pX > (lShiftX - 1);
+
+    // Reached end of image
+    if ((pX + 1) == (CONFIG_T::in_width + CONFIG_T::pad_left + CONFIG_T::pad_right) &&
+        (pY + 1) == (CONFIG_T::in_height + CONFIG_T::pad_top + CONFIG_T::pad_bottom)) {
+        pX = 0;
+        sX = 0;
+        pY = 0;
+        sY = 0;
+        // Reached end of row
+    } else if ((pX + 1) == (CONFIG_T::in_width + CONFIG_T::pad_left + CONFIG_T::pad_right)) {
+        pX = 0;
+        sX = 0;
+        pY++;
+        sY = ((sY - lShiftY) == 0) ? (sY - CONFIG_T::stride_height + 1) : (sY + 1);
+        // Same row, same colum, therefore, move to the right
+    } else {
+        pX++;
+        sX = ((sX - lShiftX) == 0) ? (sX - CONFIG_T::stride_width + 1) : (sX + 1);
+    }
+
+    return ready;
+}
+
+// ****************************************************************
+//      Line buffer - Depthwise 2D Convolution
+// ****************************************************************
+
+template <class data_T, class res_T, typename CONFIG_T>
+void compute_depthwise_output_buffer_2d(
+    const data_T &in_elem, stream<res_T> &res_stream,
+    nnet::shift_reg<typename data_T::value_type, CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right>
+        line_buffer[MAX(CONFIG_T::filt_height - 1, 1)][CONFIG_T::n_chan],
+    typename data_T::value_type kernel_window[CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan],
+    const typename CONFIG_T::weight_t weights[CONFIG_T::kernel_size * CONFIG_T::n_chan],
+    const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+    // Shift line buffer and kernel window
+    hls_register typename data_T::value_type shift_buffer[CONFIG_T::filt_height][CONFIG_T::n_chan];
+    nnet::shift_line_buffer_2d<data_T, CONFIG_T>(in_elem, line_buffer, shift_buffer);
+    nnet::kernel_shift_2d<data_T, CONFIG_T>(shift_buffer, kernel_window);
+
+    if (kernel_window_ready_2d<CONFIG_T>()) {
+        hls_register typename res_T::value_type res_out[CONFIG_T::n_chan];
+        depthwise_product<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(kernel_window, res_out,
+                                                                                            weights, biases);
+
+        hls_register res_T res_pack;
+    CastLoop:
+        #pragma unroll
+        for (int channel = 0; channel < CONFIG_T::n_chan; channel++) {
+            res_pack[channel] = res_out[channel];
+        }
+        res_stream.write(res_pack);
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void depthwise_conv_2d_cl(stream<data_T> &data, stream<res_T> &res,
+                          const typename CONFIG_T::weight_t weights[CONFIG_T::filt_height * CONFIG_T::filt_width *
+                                                                    CONFIG_T::n_chan],
+                          const typename CONFIG_T::bias_t biases[CONFIG_T::n_chan]) {
+
+    // Line buffer and kernel window
+    hls_register static nnet::shift_reg<typename data_T::value_type,
+                                        CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right>
+        line_buffer[MAX(CONFIG_T::filt_height - 1, 1)][CONFIG_T::n_chan];
+    hls_register static
+        typename data_T::value_type kernel_window[CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan];
+
+    // An array of length CONFIG_T::n_chan, with elements set to zero (padding for each channel)
+    static const data_T padds(0);
+
+// Padding above input image
+PaddingTopHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < CONFIG_T::pad_top; row++) {
+    PaddingTopWidth:
+        for (int col = 0; col < CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right; col++) {
+            compute_depthwise_output_buffer_2d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                        biases);
+        }
+    }
+
+ReadInputHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < CONFIG_T::in_height; row++) {
+    // Input image left-side padding
+    PaddingLeftWidth:
+        for (int col = 0; col < CONFIG_T::pad_left; col++) {
+            compute_depthwise_output_buffer_2d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                        biases);
+        }
+
+    // Read input image
+    ReadInputWidth:
+        for (int col = 0; col < CONFIG_T::in_width; col++) {
+            compute_depthwise_output_buffer_2d<data_T, res_T, CONFIG_T>(data.read(), res, line_buffer, kernel_window,
+                                                                        weights, biases);
+        }
+
+    // Input image right-side padding
+    PaddingRightWidth:
+        for (int col = 0; col < CONFIG_T::pad_right; col++) {
+            compute_depthwise_output_buffer_2d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                        biases);
+        }
+    }
+
+// Padding below input image
+PaddingBottomHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < CONFIG_T::pad_bottom; row++) {
+    PaddingBottomWidth:
+        for (int col = 0; col < CONFIG_T::pad_left + CONFIG_T::in_width + CONFIG_T::pad_right; col++) {
+            compute_depthwise_output_buffer_2d<data_T, res_T, CONFIG_T>(padds, res, line_buffer, kernel_window, weights,
+                                                                        biases);
+        }
+    }
+}
+
+// ****************************************************************
+//      Line buffer - Separable 2D Convolution
+// ****************************************************************
+
+// The depthwise output of a full kernel window is passed directly to the pointwise multiplication, so no intermediate
+// stream is needed between the two steps
+template <class data_T, class dw_res_T, class res_T, typename CONFIG_T>
+void compute_separable_output_buffer_2d(
+    const data_T &in_elem, stream<res_T> &res_stream,
+    nnet::shift_reg<typename data_T::value_type, CONFIG_T::depthwise_config::pad_left +
+                                                     CONFIG_T::depthwise_config::in_width +
+                                                     CONFIG_T::depthwise_config::pad_right>
+        line_buffer[MAX(CONFIG_T::depthwise_config::filt_height - 1, 1)][CONFIG_T::depthwise_config::n_chan],
+    typename data_T::value_type kernel_window[CONFIG_T::depthwise_config::filt_height *
+                                              CONFIG_T::depthwise_config::filt_width * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::depthwise_config::weight_t
+        depthwise_weights[CONFIG_T::depthwise_config::kernel_size * CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::weight_t
+        pointwise_weights[CONFIG_T::pointwise_config::n_chan * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::bias_t depthwise_biases[CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::bias_t pointwise_biases[CONFIG_T::pointwise_config::n_filt]) {
+    typedef typename CONFIG_T::depthwise_config dw_config;
+    typedef typename CONFIG_T::pointwise_config pw_config;
+
+    // Shift line buffer and kernel window
+    hls_register typename data_T::value_type shift_buffer[dw_config::filt_height][dw_config::n_chan];
+    nnet::shift_line_buffer_2d<data_T, dw_config>(in_elem, line_buffer, shift_buffer);
+    nnet::kernel_shift_2d<data_T, dw_config>(shift_buffer, kernel_window);
+
+    if (kernel_window_ready_2d<dw_config>()) {
+        hls_register dw_res_T dw_out[dw_config::n_chan];
+        depthwise_product<typename data_T::value_type, dw_res_T, dw_config>(kernel_window, dw_out, depthwise_weights,
+                                                                           depthwise_biases);
+
+        hls_register typename res_T::value_type res_out[pw_config::n_filt];
+        dense_resource<dw_res_T, typename res_T::value_type, typename pw_config::mult_config>(
+            dw_out, res_out, pointwise_weights, pointwise_biases);
+
+        hls_register res_T res_pack;
+    CastLoop:
+        #pragma unroll
+        for (int channel = 0; channel < pw_config::n_filt; channel++) {
+            res_pack[channel] = res_out[channel];
+        }
+        res_stream.write(res_pack);
+    }
+}
+
+template <class data_T, class dw_res_T, class res_T, typename CONFIG_T>
+void separable_conv_2d_cl(
+    stream<data_T> &data, stream<res_T> &res,
+    const typename CONFIG_T::depthwise_config::weight_t
+        depthwise_weights[CONFIG_T::depthwise_config::filt_height * CONFIG_T::depthwise_config::filt_width *
+                          CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::weight_t
+        pointwise_weights[CONFIG_T::pointwise_config::n_chan * CONFIG_T::pointwise_config::n_filt],
+    const typename CONFIG_T::depthwise_config::bias_t depthwise_biases[CONFIG_T::depthwise_config::n_chan],
+    const typename CONFIG_T::pointwise_config::bias_t pointwise_biases[CONFIG_T::pointwise_config::n_filt]) {
+    typedef typename CONFIG_T::depthwise_config dw_config;
+
+    // Line buffer and kernel window
+    hls_register static nnet::shift_reg<typename data_T::value_type,
+                                        dw_config::pad_left + dw_config::in_width + dw_config::pad_right>
+        line_buffer[MAX(dw_config::filt_height - 1, 1)][dw_config::n_chan];
+    hls_register static
+        typename data_T::value_type kernel_window[dw_config::filt_height * dw_config::filt_width * dw_config::n_chan];
+
+    // An array of length n_chan, with elements set to zero (padding for each channel)
+    static const data_T padds(0);
+
+// Padding above input image
+PaddingTopHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < dw_config::pad_top; row++) {
+    PaddingTopWidth:
+        for (int col = 0; col < dw_config::pad_left + dw_config::in_width + dw_config::pad_right; col++) {
+            compute_separable_output_buffer_2d<data_T, dw_res_T, res_T, CONFIG_T>(
+                padds, res, line_buffer, kernel_window, depthwise_weights, pointwise_weights, depthwise_biases,
+                pointwise_biases);
+        }
+    }
+
+ReadInputHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < dw_config::in_height; row++) {
+    // Input image left-side padding
+    PaddingLeftWidth:
+        for (int col = 0; col < dw_config::pad_left; col++) {
+            compute_separable_output_buffer_2d<data_T, dw_res_T, res_T, CONFIG_T>(
+                padds, res, line_buffer, kernel_window, depthwise_weights, pointwise_weights, depthwise_biases,
+                pointwise_biases);
+        }
+
+    // Read input image
+    ReadInputWidth:
+        for (int col = 0; col < dw_config::in_width; col++) {
+            compute_separable_output_buffer_2d<data_T, dw_res_T, res_T, CONFIG_T>(
+                data.read(), res, line_buffer, kernel_window, depthwise_weights, pointwise_weights, depthwise_biases,
+                pointwise_biases);
+        }
+
+    // Input image right-side padding
+    PaddingRightWidth:
+        for (int col = 0; col < dw_config::pad_right; col++) {
+            compute_separable_output_buffer_2d<data_T, dw_res_T, res_T, CONFIG_T>(
+                padds, res, line_buffer, kernel_window, depthwise_weights, pointwise_weights, depthwise_biases,
+                pointwise_biases);
+        }
+    }
+
+// Padding below input image
+PaddingBottomHeight:
+    #pragma loop_coalesce 2
+    for (int row = 0; row < dw_config::pad_bottom; row++) {
+    PaddingBottomWidth:
+        for (int col = 0; col < dw_config::pad_left + dw_config::in_width + dw_config::pad_right; col++) {
+            compute_separable_output_buffer_2d<data_T, dw_res_T, res_T, CONFIG_T>(
+                padds, res, line_buffer, kernel_window, depthwise_weights, pointwise_weights, depthwise_biases,
+                pointwise_biases);
+        }
+    }
+}
+
+} // namespace nnet
+
+#endif
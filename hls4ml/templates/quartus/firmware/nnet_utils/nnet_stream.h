@@ -12,48 +12,33 @@ struct broadcast_config {
     static const unsigned n_dupl = 2;
 };
 
-template <class data_T, class res_T, int N>
-void clone_stream(stream<data_T> &data, stream<res_T> &res1, stream<res_T> &res2) {
-CloneLoop:
-    #pragma ii 1
-    for (int i = 0; i < N / data_T::size; i++) {
-        data_T in_data = data.read();
-        res_T out_data1;
-        res_T out_data2;
-
-    ClonePack:
-        #pragma unroll
-        for (int j = 0; j < data_T::size; j++) {
-            out_data1[j] = in_data[j];
-            out_data2[j] = in_data[j];
-        }
-
-        res1.write(out_data1);
-        res2.write(out_data2);
+// Writes a copy of the input pack to every output stream
+template <class data_T, class res_T> void clone_pack(const data_T &in_data, stream<res_T> &res) {
+    res_T out_data;
+
+ClonePack:
+    #pragma unroll
+    for (int j = 0; j < data_T::size; j++) {
+        out_data[j] = in_data[j];
     }
+
+    res.write(out_data);
+}
+
+template <class data_T, class res_T, class... res_Ts>
+void clone_pack(const data_T &in_data, stream<res_T> &res, stream<res_Ts> &...rest) {
+    clone_pack<data_T, res_T>(in_data, res);
+    clone_pack<data_T>(in_data, rest...);
 }
 
-template <class data_T, class res_T, int N>
-void clone_stream(stream<data_T> &data, stream<res_T> &res1, stream<res_T> &res2, stream<res_T> &res3) {
+// Copies the input stream to any number of output streams, all outputs are written in the same pipelined loop
+template <class data_T, class res_T, int N, class... res_Ts>
+void clone_stream(stream<data_T> &data, stream<res_T> &res1, stream<res_Ts> &...res) {
 CloneLoop:
     #pragma ii 1
     for (int i = 0; i < N / data_T::size; i++) {
         data_T in_data = data.read();
-        res_T out_data1;
-        res_T out_data2;
-        res_T out_data3;
-
-    ClonePack:
-        #pragma unroll
-        for (int j = 0; j < data_T::size; j++) {
-            out_data1[j] = in_data[j];
-            out_data2[j] = in_data[j];
-            out_data3[j] = in_data[j];
-        }
-
-        res1.write(out_data1);
-        res2.write(out_data2);
-        res3.write(out_data3);
+        clone_pack<data_T>(in_data, res1, res...);
     }
 }
 
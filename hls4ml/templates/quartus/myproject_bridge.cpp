@@ -14,6 +14,8 @@ std::map<std::string, void *> *trace_outputs = NULL;
 size_t trace_type_size = sizeof(double);
 } // namespace nnet
 
+// hls-fpga-machine-learning insert layer profile
+
 extern "C" {
 
 struct trace_data {
@@ -61,6 +63,8 @@ void myproject_double(
 ) {
     // hls-fpga-machine-learning insert wrapper #double
 }
+
+// hls-fpga-machine-learning insert raw wrappers
 }
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef NNET_CONV2D_H_
 #define NNET_CONV2D_H_
 
+#include "nnet_activation_fused.h"
 #include "nnet_common.h"
 #include "nnet_conv2d_latency.h"
 #include "nnet_conv2d_resource.h"
@@ -36,6 +37,10 @@ struct conv2d_config {
     static const unsigned reuse_factor = 1;
     static const bool store_weights_in_bram = false;
     static const unsigned n_zeros = 0; // not used yet
+
+    // Activation fused into the output of the streaming implementation, see nnet_activation_fused.h
+    typedef void preact_t;
+    template <class x_T, class y_T> using activation = nnet::fused_activation::linear<x_T, y_T, void>;
 };
 
 template <class data_T, class res_T, typename CONFIG_T>
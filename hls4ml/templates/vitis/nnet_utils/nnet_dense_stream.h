@@ -49,8 +49,8 @@ void data_prepare(hls::stream<data_T> &data_stream, typename data_T::value_type
     }
 }
 
-template <class res_T, typename CONFIG_T>
-void res_write(typename res_T::value_type res[CONFIG_T::n_out], hls::stream<res_T> &res_stream) {
+template <class preact_T, class res_T, typename CONFIG_T>
+void res_write(preact_T res[CONFIG_T::n_out], hls::stream<res_T> &res_stream) {
     #pragma HLS INLINE
 
     if (CONFIG_T::n_out / res_T::size > 1) {
@@ -62,7 +62,8 @@ void res_write(typename res_T::value_type res[CONFIG_T::n_out], hls::stream<res_
         ResPackPipeline:
             for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
                 #pragma HLS UNROLL
-                res_pack[i_pack] = res[i_out * res_T::size + i_pack];
+                res_pack[i_pack] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(
+                    res[i_out * res_T::size + i_pack]);
             }
             res_stream.write(res_pack);
         }
@@ -72,7 +73,7 @@ void res_write(typename res_T::value_type res[CONFIG_T::n_out], hls::stream<res_
     ResPackSingle:
         for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
             #pragma HLS UNROLL
-            res_pack[i_pack] = res[i_pack];
+            res_pack[i_pack] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res[i_pack]);
         }
         res_stream.write(res_pack);
     }
@@ -87,17 +88,17 @@ void dense(hls::stream<data_T> &data_stream, hls::stream<res_T> &res_stream,
     typename data_T::value_type data[CONFIG_T::n_in];
     #pragma HLS ARRAY_PARTITION variable=data complete
 
-    typename res_T::value_type res[CONFIG_T::n_out];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res[CONFIG_T::n_out];
     #pragma HLS ARRAY_PARTITION variable=res complete
 
     data_prepare<data_T, CONFIG_T>(data_stream, data);
     if (CONFIG_T::strategy == nnet::latency) {
-        dense_latency_wrapper<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(data, res, weights, biases);
+        dense_latency_wrapper<typename data_T::value_type, preact_T, CONFIG_T>(data, res, weights, biases);
     } else {
-        dense_resource_wrapper<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(data, res, weights,
-                                                                                                  biases);
+        dense_resource_wrapper<typename data_T::value_type, preact_T, CONFIG_T>(data, res, weights, biases);
     }
-    res_write<res_T, CONFIG_T>(res, res_stream);
+    res_write<preact_T, res_T, CONFIG_T>(res, res_stream);
 }
 
 } // namespace nnet
@@ -759,6 +759,10 @@ struct ap_fixed_base : _AP_ROOT_TYPE<_AP_W, _AP_S> {
 
       overflow_adjust(underflow, overflow, lD, neg_src);
     }
+#ifdef HLS4ML_OVERFLOW_COUNTERS
+    // Instrumentation of the emulation library, resolved by argument-dependent lookup
+    record_conversion(op, *this);
+#endif
     return *this;
   } // operator= 
 
@@ -114,6 +114,7 @@ void sigmoid(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in]) {
     for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
         data_round = data[ii] * CONFIG_T::table_size / 16;
         index = data_round + 8 * CONFIG_T::table_size / 16;
+        record_table_index(index, CONFIG_T::table_size);
         if (index < 0)
             index = 0;
         if (index > CONFIG_T::table_size - 1)
@@ -332,6 +333,7 @@ void softmax_legacy(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in]) {
             else {
                 data_round = (data_cache[jj] - data_cache[ii]) * CONFIG_T::table_size / 16;
                 index = data_round + 8 * CONFIG_T::table_size / 16;
+                record_table_index(index, CONFIG_T::table_size);
                 if (index < 0)
                     index = 0;
                 if (index > CONFIG_T::table_size - 1)
@@ -345,6 +347,7 @@ void softmax_legacy(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in]) {
     // Second loop to invert
     for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
         int exp_res_index = exp_res[ii] * CONFIG_T::table_size / 64;
+        record_table_index(exp_res_index, CONFIG_T::table_size);
         if (exp_res_index < 0)
             exp_res_index = 0;
         if (exp_res_index > CONFIG_T::table_size - 1)
@@ -433,6 +436,7 @@ template <class data_T, class res_T, typename CONFIG_T> void tanh(data_T data[CO
         data_round = data[ii] * CONFIG_T::table_size / 8;
         index = data_round + 4 * CONFIG_T::table_size / 8;
         // std::cout << "Input: "  << data[ii] << " Round: " << data_round << " Index: " << index << std::endl;
+        record_table_index(index, CONFIG_T::table_size);
         if (index < 0)
             index = 0;
         if (index > CONFIG_T::table_size - 1)
@@ -549,6 +553,7 @@ void softplus(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in]) {
     for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
         data_round = data[ii] * CONFIG_T::table_size / 16;
         index = data_round + 8 * CONFIG_T::table_size / 16;
+        record_table_index(index, CONFIG_T::table_size);
         if (index < 0)
             index = 0;
         if (index > CONFIG_T::table_size - 1)
@@ -598,6 +603,7 @@ void softsign(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in]) {
     for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
         data_round = data[ii] * CONFIG_T::table_size / 16;
         index = data_round + 8 * CONFIG_T::table_size / 16;
+        record_table_index(index, CONFIG_T::table_size);
         if (index < 0)
             index = 0;
         if (index > CONFIG_T::table_size - 1)
@@ -650,6 +656,7 @@ void elu(data_T data[CONFIG_T::n_in], const res_T alpha, res_T res[CONFIG_T::n_i
             res[ii] = datareg;
         } else {
             index = datareg * CONFIG_T::table_size / -8;
+            record_table_index(index, CONFIG_T::table_size);
             if (index > CONFIG_T::table_size - 1)
                 index = CONFIG_T::table_size - 1;
             res[ii] = alpha * elu_table[index];
@@ -706,6 +713,7 @@ template <class data_T, class res_T, typename CONFIG_T> void selu(data_T data[CO
             res[ii] = res_T(1.0507009873554804934193349852946) * datareg;
         } else {
             index = datareg * CONFIG_T::table_size / -8;
+            record_table_index(index, CONFIG_T::table_size);
             if (index > CONFIG_T::table_size - 1)
                 index = CONFIG_T::table_size - 1;
             res[ii] = selu_table[index];
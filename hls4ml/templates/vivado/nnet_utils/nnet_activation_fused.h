@@ -0,0 +1,134 @@
+#ifndef NNET_ACTIVATION_FUSED_H_
+#define NNET_ACTIVATION_FUSED_H_
+
+#include "nnet_activation.h"
+#include "nnet_common.h"
+
+namespace nnet {
+
+// Element-wise activations applied in the output stage of the streaming dense and convolution layers, replacing a
+// separate activation layer and the FIFO in front of it. The results are identical to the functions in nnet_activation.h
+namespace fused_activation {
+
+// Type of the layer result before the activation is applied. Layers without a fused activation leave preact_t as void,
+// in which case the layer writes its result type directly.
+template <class preact_T, class res_T> struct preact_type { typedef preact_T type; };
+template <class res_T> struct preact_type<void, res_T> { typedef res_T type; };
+
+template <class data_T, class res_T, typename CONFIG_T> struct linear {
+    static res_T activation(data_T x) { return x; }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> struct relu {
+    static res_T activation(data_T x) {
+        if (x > 0)
+            return x;
+        else
+            return 0;
+    }
+};
+
+template <class data_T, class res_T, int MAX_INT, typename CONFIG_T> struct relu_max {
+    static res_T activation(data_T x) {
+        if (x < 0)
+            return 0;
+        else if (x > MAX_INT)
+            return MAX_INT;
+        else
+            return x;
+    }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> using relu6 = relu_max<data_T, res_T, 6, CONFIG_T>;
+
+template <class data_T, class res_T, typename CONFIG_T> using relu1 = relu_max<data_T, res_T, 1, CONFIG_T>;
+
+template <class data_T, class res_T, typename CONFIG_T> struct leaky_relu {
+    static res_T activation(data_T x) {
+        data_T alpha = CONFIG_T::alpha;
+        if (x > 0)
+            return x;
+        else
+            return alpha * x;
+    }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> struct sigmoid {
+    static res_T activation(data_T x) {
+        // Initialize the lookup table
+#ifdef __HLS_SYN__
+        bool initialized = false;
+        typename CONFIG_T::table_t sigmoid_table[CONFIG_T::table_size];
+#else
+        static bool initialized = false;
+        static typename CONFIG_T::table_t sigmoid_table[CONFIG_T::table_size];
+#endif
+        if (!initialized) {
+            init_sigmoid_table<CONFIG_T, CONFIG_T::table_size>(sigmoid_table);
+            initialized = true;
+        }
+
+        int data_round = x * CONFIG_T::table_size / 16;
+        int index = data_round + 8 * CONFIG_T::table_size / 16;
+        record_table_index(index, CONFIG_T::table_size);
+        if (index < 0)
+            index = 0;
+        if (index > CONFIG_T::table_size - 1)
+            index = CONFIG_T::table_size - 1;
+        return (res_T)sigmoid_table[index];
+    }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> struct tanh {
+    static res_T activation(data_T x) {
+        // Initialize the lookup table
+#ifdef __HLS_SYN__
+        bool initialized = false;
+        typename CONFIG_T::table_t tanh_table[CONFIG_T::table_size];
+#else
+        static bool initialized = false;
+        static typename CONFIG_T::table_t tanh_table[CONFIG_T::table_size];
+#endif
+        if (!initialized) {
+            init_tanh_table<CONFIG_T, CONFIG_T::table_size>(tanh_table);
+            initialized = true;
+        }
+
+        int data_round = x * CONFIG_T::table_size / 8;
+        int index = data_round + 4 * CONFIG_T::table_size / 8;
+        record_table_index(index, CONFIG_T::table_size);
+        if (index < 0)
+            index = 0;
+        if (index > CONFIG_T::table_size - 1)
+            index = CONFIG_T::table_size - 1;
+        return (res_T)tanh_table[index];
+    }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> struct hard_sigmoid {
+    static res_T activation(data_T x) {
+        auto datareg = CONFIG_T::slope * x + CONFIG_T::shift;
+        if (datareg > 1)
+            datareg = 1;
+        else if (datareg < 0)
+            datareg = 0;
+        return datareg;
+    }
+};
+
+template <class data_T, class res_T, typename CONFIG_T> struct hard_tanh {
+    static res_T activation(data_T x) {
+        auto sigmoid = CONFIG_T::slope * x + CONFIG_T::shift;
+        if (sigmoid > 1)
+            sigmoid = 1;
+        else if (sigmoid < 0)
+            sigmoid = 0;
+        return 2 * sigmoid - 1;
+    }
+};
+
+} // namespace fused_activation
+
+} // namespace nnet
+
+#endif
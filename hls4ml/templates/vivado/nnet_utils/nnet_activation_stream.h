@@ -89,6 +89,7 @@ SigmoidActLoop:
             #pragma HLS UNROLL
             int data_round = in_data[j] * CONFIG_T::table_size / 16;
             int index = data_round + 8 * CONFIG_T::table_size / 16;
+            record_table_index(index, CONFIG_T::table_size);
             if (index < 0)
                 index = 0;
             else if (index > CONFIG_T::table_size - 1)
@@ -293,6 +294,7 @@ SoftmaxInitLoop:
                 } else {
                     int data_round = (data_cache[j] - data_cache[i]) * CONFIG_T::table_size / 16;
                     int index = data_round + 8 * CONFIG_T::table_size / 16;
+                    record_table_index(index, CONFIG_T::table_size);
                     if (index < 0)
                         index = 0;
                     if (index > CONFIG_T::table_size - 1)
@@ -312,6 +314,7 @@ SoftmaxInitLoop:
             #pragma HLS UNROLL
 
             int exp_res_index = exp_res[j] * CONFIG_T::table_size / 64;
+            record_table_index(exp_res_index, CONFIG_T::table_size);
             if (exp_res_index < 0)
                 exp_res_index = 0;
             if (exp_res_index > CONFIG_T::table_size - 1)
@@ -401,6 +404,7 @@ TanHActLoop:
             #pragma HLS UNROLL
             int data_round = in_data[j] * CONFIG_T::table_size / 8;
             int index = data_round + 4 * CONFIG_T::table_size / 8;
+            record_table_index(index, CONFIG_T::table_size);
             if (index < 0)
                 index = 0;
             else if (index > CONFIG_T::table_size - 1)
@@ -551,6 +555,7 @@ SoftplusActLoop:
             #pragma HLS UNROLL
             int data_round = in_data[j] * CONFIG_T::table_size / 16;
             int index = data_round + 8 * CONFIG_T::table_size / 16;
+            record_table_index(index, CONFIG_T::table_size);
             if (index < 0)
                 index = 0;
             else if (index > CONFIG_T::table_size - 1)
@@ -592,6 +597,7 @@ SoftsignActLoop:
             #pragma HLS UNROLL
             int data_round = in_data[j] * CONFIG_T::table_size / 16;
             int index = data_round + 8 * CONFIG_T::table_size / 16;
+            record_table_index(index, CONFIG_T::table_size);
             if (index < 0)
                 index = 0;
             else if (index > CONFIG_T::table_size - 1)
@@ -637,6 +643,7 @@ EluActLoop:
                 out_data[j] = datareg;
             } else {
                 int index = datareg * CONFIG_T::table_size / -8;
+                record_table_index(index, CONFIG_T::table_size);
                 if (index > CONFIG_T::table_size - 1)
                     index = CONFIG_T::table_size - 1;
                 out_data[j] = alpha * elu_table[index];
@@ -685,6 +692,7 @@ SeluActLoop:
                 out_data[j] = (typename data_T::value_type)1.0507009873554804934193349852946 * datareg;
             } else {
                 int index = datareg * CONFIG_T::table_size / -8;
+                record_table_index(index, CONFIG_T::table_size);
                 if (index > CONFIG_T::table_size - 1)
                     index = CONFIG_T::table_size - 1;
                 out_data[j] = selu_table[index];
@@ -119,6 +119,63 @@ void normalize_ternary_tanh(data_T data[CONFIG_T::n_in], ap_int<2> res[CONFIG_T:
     }
 }
 
+// ****************************************************
+//       Merged Batch Normalization and n-bit Quantized Activation
+// ****************************************************
+struct batchnorm_quantized_threshold_config {
+    // Layer Sizes
+    static const unsigned n_in = 10;
+    static const unsigned n_filt = -1;
+    static const unsigned n_scale_bias = 10;
+
+    // Thresholds per channel (2^n - 1) and raw value of the lowest output level
+    static const unsigned n_thresholds = 3;
+    static const int code_lo = 0;
+    typedef ap_fixed<17, 7> threshold_t;
+    typedef ap_uint<1> direction_t;
+
+    // Resource reuse info
+    static const unsigned io_type = io_parallel;
+    static const unsigned reuse_factor = 1;
+    static const unsigned n_zeros = 0;
+};
+
+// Output level of one input: the number of thresholds of the channel that are reached, counted downwards if the
+// direction of the channel is 0 (negative scale). The level is written as the raw bits of the output.
+template <class data_T, class res_T, typename CONFIG_T>
+res_T quantized_threshold_level(data_T x, typename CONFIG_T::threshold_t threshold[CONFIG_T::n_thresholds],
+                                typename CONFIG_T::direction_t direction) {
+    #pragma HLS INLINE
+    ap_uint<8> count = 0;
+ThresholdCompare:
+    for (int it = 0; it < CONFIG_T::n_thresholds; it++) {
+        #pragma HLS UNROLL
+        if (x >= threshold[it])
+            count++;
+    }
+    int level = direction ? (int)count : (int)CONFIG_T::n_thresholds - (int)count;
+
+    res_T res;
+    res.range(res_T::width - 1, 0) = ap_int<res_T::width>(CONFIG_T::code_lo + level);
+    return res;
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void normalize_quantized_threshold(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in],
+                                   typename CONFIG_T::threshold_t threshold[CONFIG_T::n_scale_bias * CONFIG_T::n_thresholds],
+                                   typename CONFIG_T::direction_t direction[CONFIG_T::n_scale_bias]) {
+    #pragma HLS function_instantiate variable=threshold,direction
+    #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+    #pragma HLS ARRAY_PARTITION variable=threshold complete
+    #pragma HLS ARRAY_PARTITION variable=direction complete
+
+    for (int ii = 0; ii < CONFIG_T::n_in; ii++) {
+        int norm_index = CONFIG_T::n_filt == -1 ? ii : ii % CONFIG_T::n_filt;
+        res[ii] = quantized_threshold_level<data_T, res_T, CONFIG_T>(
+            data[ii], &threshold[norm_index * CONFIG_T::n_thresholds], direction[norm_index]);
+    }
+}
+
 } // namespace nnet
 
 #endif
@@ -2,6 +2,7 @@
 #define NNET_BATCHNORM_STREAM_H_
 
 #include "hls_stream.h"
+#include "nnet_batchnorm.h"
 #include "nnet_common.h"
 #include "nnet_mult.h"
 #include "nnet_types.h"
@@ -118,6 +119,38 @@ TernaryNormLoop:
     }
 }
 
+template <class data_T, class res_T, typename CONFIG_T>
+void normalize_quantized_threshold(hls::stream<data_T> &data, hls::stream<res_T> &res,
+                                   typename CONFIG_T::threshold_t threshold[CONFIG_T::n_scale_bias * CONFIG_T::n_thresholds],
+                                   typename CONFIG_T::direction_t direction[CONFIG_T::n_scale_bias]) {
+    #pragma HLS ARRAY_PARTITION variable=threshold complete
+    #pragma HLS ARRAY_PARTITION variable=direction complete
+
+ThresholdNormLoop:
+    for (int i = 0; i < CONFIG_T::n_in / data_T::size; i++) {
+        #pragma HLS PIPELINE
+
+        data_T in_data = data.read();
+        res_T out_data;
+        PRAGMA_DATA_PACK(out_data)
+
+    BatchNormPack:
+        for (int j = 0; j < data_T::size; j++) {
+            #pragma HLS UNROLL
+            int norm_index;
+            if (CONFIG_T::n_filt == -1) {
+                norm_index = i * data_T::size + j;
+            } else {
+                norm_index = j % CONFIG_T::n_filt;
+            }
+            out_data[j] = quantized_threshold_level<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(
+                in_data[j], &threshold[norm_index * CONFIG_T::n_thresholds], direction[norm_index]);
+        }
+
+        res.write(out_data);
+    }
+}
+
 } // namespace nnet
 
 #endif
@@ -25,6 +25,35 @@ template <class data_T, typename CONFIG_T> class FillConv2DBuffer {
     }
 };
 
+// Fills the buffer of one partition from a table of input indices, partition x pixel x tap, with -1 for padding.
+// Used by the generated fill_buffer_<index> classes instead of the explicit per-partition assignments (BufferFill: Table).
+// The partition is selected in an unrolled loop over the constant rows of the table, so the entries fold to fixed input
+// indices in HLS.
+template <class data_T, unsigned n_data, unsigned n_partitions, unsigned n_pixels, unsigned n_taps>
+void fill_buffer_from_table(data_T data[n_data], data_T buffer[n_pixels][n_taps],
+                            const int table[n_partitions][n_pixels][n_taps], const unsigned partition) {
+PartitionLoop:
+    for (unsigned p = 0; p < n_partitions; p++) {
+        #pragma HLS UNROLL
+        if (partition == p) {
+        PixelLoop:
+            for (unsigned i_pxl = 0; i_pxl < n_pixels; i_pxl++) {
+                #pragma HLS UNROLL
+            TapLoop:
+                for (unsigned i_tap = 0; i_tap < n_taps; i_tap++) {
+                    #pragma HLS UNROLL
+                    const int index = table[p][i_pxl][i_tap];
+                    if (index < 0) {
+                        buffer[i_pxl][i_tap] = 0;
+                    } else {
+                        buffer[i_pxl][i_tap] = data[index];
+                    }
+                }
+            }
+        }
+    }
+}
+
 // hls4ml insert code
 
 } // namespace nnet
@@ -0,0 +1,166 @@
+#ifndef NNET_CONV2D_POOL_STREAM_H_
+#define NNET_CONV2D_POOL_STREAM_H_
+
+#include "ap_shift_reg.h"
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_conv2d_stream.h"
+#include "nnet_conv_stream.h"
+#include "nnet_pooling.h"
+
+namespace nnet {
+
+// Conv 2D followed by a non-overlapping pooling layer (pool size equal to the stride, no padding). The convolution outputs
+// are reduced into the pooling window as they are produced, so only the pooled pixels are written to the output stream
+// and the line buffers of the pooling layer are not needed. The pooling parameters are in CONFIG_T::pool_config.
+template <class data_T, class res_T, typename CONFIG_T>
+void compute_output_buffer_2d_pool(
+    const data_T &in_elem,
+    ap_shift_reg<typename data_T::value_type, CONFIG_T::in_width> line_buffer[MAX(CONFIG_T::filt_height - 1, 1)]
+                                                                             [CONFIG_T::n_chan],
+    hls::stream<res_T> &res_stream,
+    typename CONFIG_T::weight_t weights[CONFIG_T::kernel_size * CONFIG_T::n_chan * CONFIG_T::n_filt],
+    typename CONFIG_T::bias_t biases[CONFIG_T::n_filt]) {
+    #pragma HLS INLINE OFF
+
+    typedef typename CONFIG_T::pool_config pool_config;
+    typedef typename pool_config::accum_t pool_accum_T;
+
+    // Thresholds
+    const static int lShiftX = CONFIG_T::filt_width - 1;
+    const static int lShiftY = CONFIG_T::filt_height - 1;
+
+    // Counters
+    static int pX = 0; // Pixel X
+    static int pY = 0; // Pixel Y
+
+    static int sX = 0; // Stride X
+    static int sY = 0; // Stride Y
+
+    static unsigned oX = 0; // Convolution output X
+    static unsigned oY = 0; // Convolution output Y
+
+    static typename data_T::value_type kernel_data[CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan];
+    #pragma HLS ARRAY_PARTITION variable = kernel_data complete
+
+    // Partial results of the pooling windows in the current row of pooled pixels
+    static pool_accum_T pool_row[pool_config::out_width * CONFIG_T::n_filt];
+    #pragma HLS ARRAY_PARTITION variable = pool_row cyclic factor = CONFIG_T::n_filt
+
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename CONFIG_T::conv_out_t>::type preact_T;
+    preact_T res_out[CONFIG_T::n_filt];
+    #pragma HLS ARRAY_PARTITION variable = res_out complete dim = 0
+
+    res_T res_pack;
+    PRAGMA_DATA_PACK(res_pack)
+
+    // Add pixel to buffer
+    nnet::shift_line_buffer<data_T, CONFIG_T>(in_elem, line_buffer, kernel_data);
+
+    // Check to see if we have a full kernel
+    if ((sX - lShiftX) == 0 && (sY - lShiftY) == 0 && pY > lShiftY - 1 && pX > lShiftX - 1) {
+
+        // Dense multiply
+        if (CONFIG_T::strategy == nnet::latency) {
+            dense_latency<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
+                kernel_data, res_out, weights, biases);
+        } else {
+            dense_resource<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
+                kernel_data, res_out, weights, biases);
+        }
+
+        // Outputs beyond the last complete pooling window are dropped, as in the pooling layer
+        const unsigned wX = oX / pool_config::pool_width;
+        const bool in_pool = wX < pool_config::out_width && oY / pool_config::pool_height < pool_config::out_height;
+        const bool first = (oX % pool_config::pool_width) == 0 && (oY % pool_config::pool_height) == 0;
+        const bool last = (oX % pool_config::pool_width) == pool_config::pool_width - 1 &&
+                          (oY % pool_config::pool_height) == pool_config::pool_height - 1;
+
+        if (in_pool) {
+        PoolLoop:
+            for (unsigned i_ic = 0; i_ic < CONFIG_T::n_filt; i_ic++) {
+                #pragma HLS UNROLL
+                typename CONFIG_T::conv_out_t conv_out =
+                    CONFIG_T::template activation<preact_T, typename CONFIG_T::conv_out_t>::activation(res_out[i_ic]);
+                pool_accum_T pool_in = conv_out;
+                pool_accum_T pool_acc = pool_row[wX * CONFIG_T::n_filt + i_ic];
+
+                if (first) {
+                    pool_acc = pool_in;
+                } else if (pool_config::pool_op == Max) {
+                    pool_acc = pool_in >= pool_acc ? pool_in : pool_acc;
+                } else {
+                    pool_acc = pool_acc + pool_in;
+                }
+                pool_row[wX * CONFIG_T::n_filt + i_ic] = pool_acc;
+
+                if (pool_config::pool_op == Max) {
+                    res_pack[i_ic] = pool_acc;
+                } else {
+                    res_pack[i_ic] = (pool_accum_T)(pool_acc / (pool_config::pool_height * pool_config::pool_width));
+                }
+            }
+
+            // Write output to stream when the pooling window is complete
+            if (last) {
+                res_stream.write(res_pack);
+            }
+        }
+
+        if (oX + 1 == CONFIG_T::out_width) {
+            oX = 0;
+            oY = (oY + 1 == CONFIG_T::out_height) ? 0 : oY + 1;
+        } else {
+            oX = oX + 1;
+        }
+    }
+
+    // Counter Housekeeping
+    if (pX + 1 == CONFIG_T::in_width) // Includes padding, end of line (padded)
+    {
+        pX = 0;
+        sX = 0;
+        if (pY + 1 == CONFIG_T::in_height) { // Reached bottom of image
+            pY = 0;
+            sY = 0;
+        } else {
+            pY = pY + 1;
+            // Update stride (threshold) ? subtract stride : increment stride
+            sY = ((sY - lShiftY) == 0) ? sY - CONFIG_T::stride_height + 1 : sY + 1;
+        }
+    } else {
+        pX = pX + 1;
+        // Update stride (threshold) ? subtract stride : increment stride
+        sX = ((sX - lShiftX) == 0) ? sX - CONFIG_T::stride_width + 1 : sX + 1;
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void conv_2d_pool_cl(
+    hls::stream<data_T> &data, hls::stream<res_T> &res,
+    typename CONFIG_T::weight_t weights[CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan * CONFIG_T::n_filt],
+    typename CONFIG_T::bias_t biases[CONFIG_T::n_filt]) {
+    assert(CONFIG_T::pad_top == 0 && CONFIG_T::pad_bottom == 0 && CONFIG_T::pad_left == 0 && CONFIG_T::pad_right == 0);
+    assert(CONFIG_T::implementation == conv_implementation::linebuffer && CONFIG_T::filt_height > 1);
+    assert(CONFIG_T::pool_config::pool_height == CONFIG_T::pool_config::stride_height &&
+           CONFIG_T::pool_config::pool_width == CONFIG_T::pool_config::stride_width);
+
+    static ap_shift_reg<typename data_T::value_type, CONFIG_T::in_width> line_buffer[MAX(CONFIG_T::filt_height - 1, 1)]
+                                                                                    [CONFIG_T::n_chan];
+    #pragma HLS ARRAY_PARTITION variable = line_buffer complete dim = 2
+
+ReadInputHeight:
+    for (unsigned i_ih = 0; i_ih < CONFIG_T::in_height; i_ih++) {
+    ReadInputWidth:
+        for (unsigned i_iw = 0; i_iw < CONFIG_T::in_width; i_iw++) {
+            #pragma HLS LOOP_FLATTEN
+            if (CONFIG_T::strategy == nnet::latency) {
+                #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            }
+            compute_output_buffer_2d_pool<data_T, res_T, CONFIG_T>(data.read(), line_buffer, res, weights, biases);
+        }
+    }
+}
+
+} // namespace nnet
+#endif
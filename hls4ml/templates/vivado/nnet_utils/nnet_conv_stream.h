@@ -85,7 +85,8 @@ void mult_buffer(hls::stream<typename data_T::value_type> data_window[CONFIG_T::
 
     typename data_T::value_type data[CONFIG_T::kernel_size * CONFIG_T::n_chan];
     #pragma HLS ARRAY_PARTITION variable = data complete
-    typename res_T::value_type res[CONFIG_T::n_filt];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res[CONFIG_T::n_filt];
     #pragma HLS ARRAY_PARTITION variable = res complete
 
 InitData:
@@ -96,20 +97,19 @@ InitData:
 
     #pragma HLS INLINE recursive
     if (CONFIG_T::strategy == nnet::latency) {
-        dense_latency<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
-            data, res, weights, biases);
+        dense_latency<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(data, res, weights, biases);
     } else {
-        dense_resource<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
-            data, res, weights, biases);
+        dense_resource<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(data, res, weights, biases);
     }
 
 CastLoop:
     for (unsigned jj = 0; jj < CONFIG_T::n_filt; jj++) {
         #pragma HLS UNROLL
         if (res_T::size / CONFIG_T::n_filt == 1) {
-            res_pack[jj] = res[jj];
+            res_pack[jj] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res[jj]);
         } else {
-            res_pack[outputs_ready * CONFIG_T::n_filt + jj] = res[jj];
+            res_pack[outputs_ready * CONFIG_T::n_filt + jj] =
+                CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res[jj]);
         }
     }
 
@@ -276,7 +276,8 @@ void compute_output_buffer_2d(
     static typename data_T::value_type kernel_data[CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan];
     #pragma HLS ARRAY_PARTITION variable = kernel_data complete
 
-    typename res_T::value_type res_out[CONFIG_T::n_filt];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res_out[CONFIG_T::n_filt];
     #pragma HLS ARRAY_PARTITION variable = res_out complete dim = 0
 
     res_T res_pack;
@@ -291,10 +292,10 @@ void compute_output_buffer_2d(
         // Dense multiply
         // #pragma HLS INLINE recursive
         if (CONFIG_T::strategy == nnet::latency) {
-            dense_latency<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
+            dense_latency<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
                 kernel_data, res_out, weights, biases);
         } else {
-            dense_resource<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
+            dense_resource<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
                 kernel_data, res_out, weights, biases);
         }
 
@@ -302,7 +303,7 @@ void compute_output_buffer_2d(
     CastLoop:
         for (unsigned i_ic = 0; i_ic < CONFIG_T::n_filt; i_ic++) {
             #pragma HLS UNROLL
-            res_pack[i_ic] = res_out[i_ic];
+            res_pack[i_ic] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res_out[i_ic]);
         }
 
         // Write output to stream when output ready
@@ -347,7 +348,8 @@ void compute_output_buffer_1d(
     static typename data_T::value_type kernel_data[CONFIG_T::filt_width * CONFIG_T::n_chan];
     #pragma HLS ARRAY_PARTITION variable = kernel_data complete
 
-    typename res_T::value_type res_out[CONFIG_T::n_filt];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res_out[CONFIG_T::n_filt];
     #pragma HLS ARRAY_PARTITION variable = res_out complete dim = 0
 
     res_T res_pack;
@@ -362,10 +364,10 @@ void compute_output_buffer_1d(
         // Dense multiply
         #pragma HLS INLINE recursive
         if (CONFIG_T::strategy == nnet::latency) {
-            dense_latency<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
+            dense_latency<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
                 kernel_data, res_out, weights, biases);
         } else {
-            dense_resource<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
+            dense_resource<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(
                 kernel_data, res_out, weights, biases);
         }
 
@@ -373,7 +375,7 @@ void compute_output_buffer_1d(
     CastLoop:
         for (unsigned i_ic = 0; i_ic < CONFIG_T::n_filt; i_ic++) {
             #pragma HLS UNROLL
-            res_pack[i_ic] = res_out[i_ic];
+            res_pack[i_ic] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res_out[i_ic]);
         }
 
         // Write output to stream when output ready
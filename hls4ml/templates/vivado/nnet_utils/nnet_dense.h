@@ -2,6 +2,7 @@
 #define NNET_DENSE_H_
 
 #include "hls_stream.h"
+#include "nnet_activation_fused.h"
 #include "nnet_common.h"
 #include "nnet_dense_latency.h"
 #include "nnet_dense_resource.h"
@@ -30,6 +31,10 @@ struct dense_config {
     // partitioning arrays cyclically to go with roll factors?
     // Product function to use
     template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+
+    // Activation fused into the output of the streaming implementation, see nnet_activation_fused.h
+    typedef void preact_t;
+    template <class x_T, class y_T> using activation = nnet::fused_activation::linear<x_T, y_T, void>;
 };
 
 template <class data_T, class res_T, typename CONFIG_T>
@@ -0,0 +1,170 @@
+#ifndef NNET_DENSE_BLOCK_SPARSE_H_
+#define NNET_DENSE_BLOCK_SPARSE_H_
+
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_dense.h"
+#include "nnet_mult.h"
+#include "nnet_types.h"
+#include <math.h>
+
+namespace nnet {
+
+struct dense_block_sparse_config : dense_config {
+    typedef ap_uint<1> index_t;
+
+    // Shape of the blocks of the (n_in, n_out) weight matrix, only the non-zero blocks are stored
+    static const unsigned block_in = 1;
+    static const unsigned block_out = 1;
+    // Number of stored blocks, a multiple of the reuse factor
+    static const unsigned n_blocks = 1;
+};
+
+// Dense layer with the weights stored as blocks, the blocks that are zero are removed at conversion. Every cycle of the
+// reuse loop processes n_blocks / reuse_factor blocks: word ir of the reshaped weights holds the blocks ir, ir + RF, ...
+// so element e of block ib * RF + ir is stored at (ib * block_in * block_out + e) * RF + ir.
+template <class data_T, class res_T, typename CONFIG_T>
+void dense_block_sparse(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_out],
+                        typename CONFIG_T::weight_t weights[CONFIG_T::n_blocks * CONFIG_T::block_in * CONFIG_T::block_out],
+                        typename CONFIG_T::bias_t biases[CONFIG_T::n_out],
+                        typename CONFIG_T::index_t block_in_index[CONFIG_T::n_blocks],
+                        typename CONFIG_T::index_t block_out_index[CONFIG_T::n_blocks]) {
+
+    const int rufactor = CONFIG_T::reuse_factor;
+    const int block_limit = CONFIG_T::n_blocks / CONFIG_T::reuse_factor;
+    const int block_size = CONFIG_T::block_in * CONFIG_T::block_out;
+    const int weight_factor = block_limit * block_size;
+    const int n_in_blocks = CONFIG_T::n_in / CONFIG_T::block_in;
+    const int n_out_blocks = CONFIG_T::n_out / CONFIG_T::block_out;
+
+    #pragma HLS function_instantiate variable=weights,biases,block_in_index,block_out_index
+    #pragma HLS ARRAY_RESHAPE   variable=weights block factor=weight_factor
+    #pragma HLS ARRAY_RESHAPE   variable=block_in_index block factor=block_limit
+    #pragma HLS ARRAY_RESHAPE   variable=block_out_index block factor=block_limit
+    #pragma HLS ARRAY_PARTITION variable=biases complete
+
+    typename CONFIG_T::accum_t acc[CONFIG_T::n_out];
+    #pragma HLS ARRAY_PARTITION variable=acc complete
+
+InitAccum:
+    for (int iacc = 0; iacc < CONFIG_T::n_out; iacc++) {
+        #pragma HLS UNROLL
+        acc[iacc] = (typename CONFIG_T::accum_t)biases[iacc];
+    }
+
+ReuseLoop:
+    for (int ir = 0; ir < rufactor; ir++) {
+        #pragma HLS PIPELINE II=1 rewind
+
+        typename CONFIG_T::accum_t mult[CONFIG_T::n_out];
+        #pragma HLS ARRAY_PARTITION variable=mult complete
+
+    ResetMult:
+        for (int imult = 0; imult < CONFIG_T::n_out; imult++) {
+            #pragma HLS UNROLL
+            mult[imult] = 0;
+        }
+
+    BlockLoop:
+        for (int ib = 0; ib < block_limit; ib++) {
+            #pragma HLS UNROLL
+            int b = ib * rufactor + ir;
+            typename CONFIG_T::index_t in_block = block_in_index[b];
+            typename CONFIG_T::index_t out_block = block_out_index[b];
+
+            // Select the inputs of the block
+            data_T block_data[CONFIG_T::block_in];
+            #pragma HLS ARRAY_PARTITION variable=block_data complete
+        BlockInput:
+            for (int i = 0; i < CONFIG_T::block_in; i++) {
+                #pragma HLS UNROLL
+                block_data[i] = data[i];
+                for (int k = 1; k < n_in_blocks; k++) {
+                    #pragma HLS UNROLL
+                    if (k == in_block)
+                        block_data[i] = data[k * CONFIG_T::block_in + i];
+                }
+            }
+
+        BlockOutput:
+            for (int o = 0; o < CONFIG_T::block_out; o++) {
+                #pragma HLS UNROLL
+                typename CONFIG_T::accum_t sum = 0;
+            BlockMult:
+                for (int i = 0; i < CONFIG_T::block_in; i++) {
+                    #pragma HLS UNROLL
+                    sum += CONFIG_T::template product<data_T, typename CONFIG_T::weight_t>::product(
+                        block_data[i], weights[(ib * block_size + i * CONFIG_T::block_out + o) * rufactor + ir]);
+                }
+                for (int k = 0; k < n_out_blocks; k++) {
+                    #pragma HLS UNROLL
+                    if (k == out_block)
+                        mult[k * CONFIG_T::block_out + o] += sum;
+                }
+            }
+        }
+
+    AccumMult:
+        for (int iacc = 0; iacc < CONFIG_T::n_out; iacc++) {
+            #pragma HLS UNROLL
+            acc[iacc] += mult[iacc];
+        }
+    }
+
+// Cast to "res_t" type
+Result:
+    for (int ires = 0; ires < CONFIG_T::n_out; ires++) {
+        #pragma HLS UNROLL
+        res[ires] = cast<data_T, res_T, CONFIG_T>(acc[ires]);
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void dense_block_sparse(hls::stream<data_T> &data_stream, hls::stream<res_T> &res_stream,
+                        typename CONFIG_T::weight_t weights[CONFIG_T::n_blocks * CONFIG_T::block_in * CONFIG_T::block_out],
+                        typename CONFIG_T::bias_t biases[CONFIG_T::n_out],
+                        typename CONFIG_T::index_t block_in_index[CONFIG_T::n_blocks],
+                        typename CONFIG_T::index_t block_out_index[CONFIG_T::n_blocks]) {
+    typename data_T::value_type data[CONFIG_T::n_in];
+    #pragma HLS ARRAY_PARTITION variable=data complete
+
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res[CONFIG_T::n_out];
+    #pragma HLS ARRAY_PARTITION variable=res complete
+
+DataPrepare:
+    for (int i_in = 0; i_in < CONFIG_T::n_in / data_T::size; i_in++) {
+        if (CONFIG_T::n_in / data_T::size > 1) {
+            #pragma HLS PIPELINE
+        }
+        data_T data_pack = data_stream.read();
+    DataPack:
+        for (int i_pack = 0; i_pack < data_T::size; i_pack++) {
+            #pragma HLS UNROLL
+            data[i_in * data_T::size + i_pack] = data_pack[i_pack];
+        }
+    }
+
+    dense_block_sparse<typename data_T::value_type, preact_T, CONFIG_T>(data, res, weights, biases, block_in_index,
+                                                                        block_out_index);
+
+ResWrite:
+    for (unsigned i_out = 0; i_out < CONFIG_T::n_out / res_T::size; i_out++) {
+        if (CONFIG_T::n_out / res_T::size > 1) {
+            #pragma HLS PIPELINE
+        }
+        res_T res_pack;
+        PRAGMA_DATA_PACK(res_pack)
+    ResPack:
+        for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
+            #pragma HLS UNROLL
+            res_pack[i_pack] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(
+                res[i_out * res_T::size + i_pack]);
+        }
+        res_stream.write(res_pack);
+    }
+}
+
+} // namespace nnet
+
+#endif
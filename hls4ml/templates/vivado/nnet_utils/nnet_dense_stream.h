@@ -29,7 +29,8 @@ void dense(hls::stream<data_T> &data_stream, hls::stream<res_T> &res_stream,
     typename data_T::value_type data[CONFIG_T::n_in];
     #pragma HLS ARRAY_PARTITION variable=data complete
 
-    typename res_T::value_type res[CONFIG_T::n_out];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res[CONFIG_T::n_out];
     #pragma HLS ARRAY_PARTITION variable=res complete
 
 DataPrepare:
@@ -45,7 +46,7 @@ DataPrepare:
         }
     }
 
-    dense_wrapper<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(data, res, weights, biases);
+    dense_wrapper<typename data_T::value_type, preact_T, CONFIG_T>(data, res, weights, biases);
 
 ResWrite:
     for (unsigned i_out = 0; i_out < CONFIG_T::n_out / res_T::size; i_out++) {
@@ -57,7 +58,8 @@ ResWrite:
     ResPack:
         for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
             #pragma HLS UNROLL
-            res_pack[i_pack] = res[i_out * res_T::size + i_pack];
+            res_pack[i_pack] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(
+                res[i_out * res_T::size + i_pack]);
         }
         res_stream.write(res_pack);
     }
@@ -641,7 +641,7 @@ garnet_stack(data_T const data[CONFIG_T::n_vertices * CONFIG_T::n_in_features],
     typedef typename CONFIG_T::template sublayer_t<ilast> last_layer_t;
 
     garnet_utils::WeightsAndMeans<first_layer_t> arrays_first;
-    garnet_utils::Means<last_layer_t> arrays_last;
+    garnet_utils::WeightsAndMeans<last_layer_t> arrays_last;
 
     garnet_utils::aggregate<first_layer_t>(data, nvtx[0], arrays_first);
 
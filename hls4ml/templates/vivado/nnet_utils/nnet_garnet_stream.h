@@ -0,0 +1,216 @@
+#ifndef NNET_GARNET_STREAM_H_
+#define NNET_GARNET_STREAM_H_
+
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_garnet.h"
+#include "nnet_types.h"
+
+namespace nnet {
+namespace garnet_utils {
+
+// Edge weights of the vertices, kept until the vertices are distributed. Only the n_aggregators weights of one vertex
+// are accessed per cycle, so the array is split in n_aggregators banks of n_vertices entries, which map to BRAM.
+template <class CONFIG_T, class E = typename CONFIG_T::edge_weight_t>
+struct StreamWeightsAndMeans : public Means<CONFIG_T, E> {
+    typedef E edge_weight_t;
+
+    edge_weight_t edge_weights[CONFIG_T::n_vertices * CONFIG_T::n_aggregators];
+
+    StreamWeightsAndMeans() : Means<CONFIG_T, E>() {
+        #pragma HLS INLINE
+        #pragma HLS ARRAY_PARTITION variable=edge_weights cyclic factor=CONFIG_T::n_aggregators
+    }
+
+    void set_weight(unsigned iva, edge_weight_t const &weight) {
+        #pragma HLS INLINE
+        edge_weights[iva] = weight;
+    }
+};
+
+// The vertices are read one every reuse_factor cycles, so the multiplications of a vertex can share reuse_factor times
+// fewer multipliers. They are accumulated in groups of n_vertices / reuse_factor vertices, as in the io_parallel
+// implementation, so the normalization of the means (and the results) is the same. All n_vertices elements of the
+// stream are read, the vertices beyond nvtx are ignored.
+template <class CONFIG_T, class data_T, class nvtx_T, class arrays_T>
+void aggregate(hls::stream<data_T> &data, nvtx_T const nvtx, arrays_T &arrays) {
+    typedef typename data_T::value_type value_T;
+
+    unsigned const unroll_factor = CONFIG_T::n_vertices >> CONFIG_T::log2_reuse_factor;
+
+    Means<CONFIG_T, typename CONFIG_T::edge_weight_aggr_t> means_accum;
+
+VerticesOuter:
+    for (unsigned ivv = 0; ivv < CONFIG_T::reuse_factor; ++ivv) {
+        Means<CONFIG_T, typename CONFIG_T::edge_weight_aggr_t> means_local;
+
+    VerticesInner:
+        for (unsigned ir = 0; ir < unroll_factor; ++ir) {
+            #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            unsigned iv = ivv * unroll_factor + ir;
+
+            data_T data_pack = data.read();
+
+            value_T vertex[CONFIG_T::n_in_features];
+            #pragma HLS ARRAY_PARTITION variable=vertex complete
+
+        InFeatures:
+            for (unsigned ix = 0; ix < CONFIG_T::n_in_features; ++ix) {
+                #pragma HLS UNROLL
+                vertex[ix] = data_pack[ix];
+            }
+
+            if (iv < nvtx) {
+                SingleVertexDataGetter<CONFIG_T, value_T> data_getter(vertex);
+                compute_weights_aggregates<CONFIG_T>(data_getter, iv, means_local, arrays);
+            }
+        }
+
+        means_accum.add_means_normalized(means_local);
+    }
+
+    arrays.set_means_normalized(nvtx, means_accum);
+}
+
+// Writes one vertex every reuse_factor cycles, the vertices beyond nvtx are set to zero.
+template <class CONFIG_T, class nvtx_T, class arrays_T, class res_T>
+void distribute(nvtx_T const nvtx, arrays_T const &arrays, hls::stream<res_T> &res) {
+    typedef typename res_T::value_type value_T;
+
+    typename CONFIG_T::aggr_t output_base[CONFIG_T::n_out_features * CONFIG_T::n_aggregators];
+    #pragma HLS ARRAY_PARTITION variable=output_base complete
+
+    compute_output_base<CONFIG_T>(arrays, output_base);
+
+Vertices:
+    for (unsigned iv = 0; iv < CONFIG_T::n_vertices; ++iv) {
+        #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+
+        value_T vertex[CONFIG_T::n_out_features];
+        #pragma HLS ARRAY_PARTITION variable=vertex complete
+
+        if (iv < nvtx) {
+            SingleVertexResSetter<CONFIG_T, value_T> res_setter(vertex);
+            compute_vertex_output<CONFIG_T>(arrays, iv, output_base, res_setter);
+        } else {
+        ZeroFill:
+            for (unsigned io = 0; io < CONFIG_T::n_out_features; ++io) {
+                #pragma HLS UNROLL
+                vertex[io] = 0;
+            }
+        }
+
+        res_T res_pack;
+        PRAGMA_DATA_PACK(res_pack)
+    OutFeatures:
+        for (unsigned io = 0; io < CONFIG_T::n_out_features; ++io) {
+            #pragma HLS UNROLL
+            res_pack[io] = vertex[io];
+        }
+        res.write(res_pack);
+    }
+}
+
+template <class CONFIG_T, class output_biases_T, class arrays_T, class res_T>
+void set_output(output_biases_T const &output_transform_biases, arrays_T const &arrays, hls::stream<res_T> &res) {
+    typename res_T::value_type out[CONFIG_T::n_out_features];
+    #pragma HLS ARRAY_PARTITION variable=out complete
+
+    set_output<CONFIG_T>(output_transform_biases, arrays, out);
+
+ResWrite:
+    for (unsigned i_out = 0; i_out < CONFIG_T::n_out_features / res_T::size; ++i_out) {
+        #pragma HLS PIPELINE
+        res_T res_pack;
+        PRAGMA_DATA_PACK(res_pack)
+    ResPack:
+        for (unsigned i_pack = 0; i_pack < res_T::size; ++i_pack) {
+            #pragma HLS UNROLL
+            res_pack[i_pack] = out[i_out * res_T::size + i_pack];
+        }
+        res.write(res_pack);
+    }
+}
+} // namespace garnet_utils
+
+// The io_stream implementations read one vertex (n_in_features values) per element of the data stream, and the number of
+// vertices from the single element of the nvtx stream. The vertices are aggregated while they stream in, only their edge
+// weights are stored until the output is distributed.
+
+// vertices -> vertices
+template <class data_T, class nvtx_T, class res_T, typename CONFIG_T>
+typename std::enable_if<CONFIG_T::output_collapse == CONFIG_T::no_collapse>::type
+garnet(hls::stream<data_T> &data, hls::stream<nvtx_T> &nvtx, hls::stream<res_T> &res) {
+    typename nvtx_T::value_type const nvtx_value = nvtx.read()[0];
+
+    garnet_utils::StreamWeightsAndMeans<CONFIG_T> arrays;
+
+    garnet_utils::aggregate<CONFIG_T>(data, nvtx_value, arrays);
+
+    garnet_utils::distribute<CONFIG_T>(nvtx_value, arrays, res);
+}
+
+// vertices -> out features
+template <class data_T, class nvtx_T, class res_T, class CONFIG_T>
+typename std::enable_if<CONFIG_T::output_collapse == CONFIG_T::collapse_mean>::type
+garnet(hls::stream<data_T> &data, hls::stream<nvtx_T> &nvtx, hls::stream<res_T> &res) {
+    typedef typename nvtx_T::value_type nvtx_value_T;
+    nvtx_value_T const nvtx_value = nvtx.read()[0];
+
+    garnet_utils::Means<CONFIG_T> arrays;
+
+    garnet_utils::aggregate<CONFIG_T>(data, nvtx_value, arrays);
+
+    garnet_utils::OutputBiasNormalizer<CONFIG_T, nvtx_value_T> normalize_bias(nvtx_value);
+
+    garnet_utils::set_output<CONFIG_T>(normalize_bias, arrays, res);
+}
+
+// vertices -> vertices
+template <class data_T, class nvtx_T, class res_T, class CONFIG_T>
+typename std::enable_if<CONFIG_T::output_collapse == CONFIG_T::no_collapse>::type
+garnet_stack(hls::stream<data_T> &data, hls::stream<nvtx_T> &nvtx, hls::stream<res_T> &res) {
+    typedef typename CONFIG_T::template sublayer_t<0> first_layer_t;
+    unsigned const ilast = CONFIG_T::n_sublayers - 1;
+    typedef typename CONFIG_T::template sublayer_t<ilast> last_layer_t;
+
+    typename nvtx_T::value_type const nvtx_value = nvtx.read()[0];
+
+    garnet_utils::WeightsAndMeans<first_layer_t> arrays_first;
+    garnet_utils::StreamWeightsAndMeans<last_layer_t> arrays_last;
+
+    garnet_utils::aggregate<first_layer_t>(data, nvtx_value, arrays_first);
+
+    garnet_utils::sublayer<first_layer_t, typename first_layer_t::next_layer_t, last_layer_t>(nvtx_value, arrays_first,
+                                                                                              arrays_last);
+
+    garnet_utils::distribute<last_layer_t>(nvtx_value, arrays_last, res);
+}
+
+// vertices -> out features
+template <class data_T, class nvtx_T, class res_T, class CONFIG_T>
+typename std::enable_if<CONFIG_T::output_collapse == CONFIG_T::collapse_mean>::type
+garnet_stack(hls::stream<data_T> &data, hls::stream<nvtx_T> &nvtx, hls::stream<res_T> &res) {
+    typedef typename CONFIG_T::template sublayer_t<0> first_layer_t;
+    unsigned const ilast = CONFIG_T::n_sublayers - 1;
+    typedef typename CONFIG_T::template sublayer_t<ilast> last_layer_t;
+
+    typedef typename nvtx_T::value_type nvtx_value_T;
+    nvtx_value_T const nvtx_value = nvtx.read()[0];
+
+    garnet_utils::WeightsAndMeans<first_layer_t> arrays_first;
+    garnet_utils::Means<last_layer_t> arrays_last;
+
+    garnet_utils::aggregate<first_layer_t>(data, nvtx_value, arrays_first);
+
+    garnet_utils::sublayer<first_layer_t, typename first_layer_t::next_layer_t, last_layer_t>(nvtx_value, arrays_first,
+                                                                                              arrays_last);
+
+    garnet_utils::OutputBiasNormalizer<last_layer_t, nvtx_value_T> normalize_bias(nvtx_value);
+
+    garnet_utils::set_output<last_layer_t>(normalize_bias, arrays_last, res);
+}
+
+} // namespace nnet
+
+#endif
@@ -2,9 +2,12 @@
 #define NNET_HELPERS_H
 
 #include "hls_stream.h"
+#include "nnet_overflow.h"
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <math.h>
 #include <stdio.h>
@@ -161,6 +164,47 @@ template <class srcType, class dstType, size_t SIZE> void convert_data(hls::stre
     }
 }
 
+// Raw conversion, the integers are the underlying bit patterns of the fixed-point values (no rounding/quantization)
+template <class dstType, class srcType> dstType fixed_to_raw(const srcType &x) {
+    const int W = srcType::width;
+    unsigned long long bits = x.range(W - 1, 0).to_uint64();
+    if (std::numeric_limits<dstType>::is_signed && W < 64 && ((bits >> (W - 1)) & 1)) {
+        bits |= ~0ULL << W; // Sign-extend
+    }
+    return dstType(bits);
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_from_raw(srcType *src, dstType *dst) {
+    for (size_t i = 0; i < SIZE; i++) {
+        dst[i].range(dstType::width - 1, 0) = (unsigned long long)src[i];
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_from_raw(srcType *src, hls::stream<dstType> &dst) {
+    for (size_t i = 0; i < SIZE / dstType::size; i++) {
+        dstType ctype;
+        for (size_t j = 0; j < dstType::size; j++) {
+            ctype[j].range(dstType::value_type::width - 1, 0) = (unsigned long long)src[i * dstType::size + j];
+        }
+        dst.write(ctype);
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_to_raw(srcType *src, dstType *dst) {
+    for (size_t i = 0; i < SIZE; i++) {
+        dst[i] = fixed_to_raw<dstType>(src[i]);
+    }
+}
+
+template <class srcType, class dstType, size_t SIZE> void convert_data_to_raw(hls::stream<srcType> &src, dstType *dst) {
+    for (size_t i = 0; i < SIZE / srcType::size; i++) {
+        srcType ctype = src.read();
+        for (size_t j = 0; j < srcType::size; j++) {
+            dst[i * srcType::size + j] = fixed_to_raw<dstType>(ctype[j]);
+        }
+    }
+}
+
 extern bool trace_enabled;
 extern std::map<std::string, void *> *trace_outputs;
 extern size_t trace_type_size;
@@ -377,6 +421,29 @@ constexpr int floorlog2(int x) { return (x < 2) ? 0 : 1 + floorlog2(x / 2); }
 
 constexpr int pow2(int x) { return x == 0 ? 1 : 2 * pow2(x - 1); }
 
+#ifndef __SYNTHESIS__
+
+// Per-layer profiling, the table is defined in the bridge of projects compiled with LayerProfiling enabled
+struct layer_profile_data {
+    const char *name;
+    unsigned long long calls;
+    unsigned long long time_ns;
+};
+
+extern layer_profile_data layer_profile[];
+
+inline unsigned long long profile_timestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+inline void profile_layer(unsigned index, unsigned long long start) {
+    layer_profile[index].time_ns += profile_timestamp() - start;
+    layer_profile[index].calls++;
+}
+
+#endif
+
 } // namespace nnet
 
 #endif
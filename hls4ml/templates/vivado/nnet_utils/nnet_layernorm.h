@@ -0,0 +1,154 @@
+#ifndef NNET_LAYERNORM_H_
+#define NNET_LAYERNORM_H_
+
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_dense.h"
+#include <math.h>
+
+namespace nnet {
+
+struct layernorm_config {
+    // Internal data type definitions
+    typedef float bias_t;
+    typedef float scale_t;
+    typedef float accum_t;
+    typedef ap_fixed<18, 2> table_t;
+
+    // Layer Sizes
+    static const unsigned n_in = 20;
+    static const unsigned seq_len = 1;
+    static const unsigned table_size = 1024;
+
+    // Resource reuse info
+    static const unsigned io_type = io_parallel;
+    static const unsigned reuse_factor = 1;
+    static const unsigned multiplier_limit = 20;
+    static const bool store_weights_in_bram = false;
+
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+// Table of 1/sqrt(m) for m in [1, 4). The top address bit selects [1, 2) or [2, 4), the remaining bits are the mantissa
+// bits below the leading one.
+template <typename CONFIG_T> void init_invert_sqrt_table(typename CONFIG_T::table_t table_out[CONFIG_T::table_size]) {
+    static constexpr int N = ceillog2(CONFIG_T::table_size);
+    for (unsigned i = 0; i < CONFIG_T::table_size; i++) {
+        unsigned upper = i >> (N - 1);
+        unsigned mantissa = i & ((1 << (N - 1)) - 1);
+        float m = (1.0 + (mantissa + 0.5) / (1 << (N - 1))) * (upper ? 2.0 : 1.0);
+        table_out[i] = 1.0 / std::sqrt(m);
+    }
+}
+
+// Normalizes one row of n_in elements in a single pass. The sums of x and x^2 are exact in accum_t, so that
+//   (x - mean) / sqrt(var + eps) = (n * x - sum(x)) / sqrt(n * sum(x^2) - sum(x)^2 + n^2 * eps)
+// needs no division. The inverse square root of v = m * 4^k, m in [1, 4), is 1/sqrt(m) from the table shifted by k bits.
+template <class data_T, class res_T, typename CONFIG_T>
+void layernorm_1d(data_T data[CONFIG_T::n_in], res_T res[CONFIG_T::n_in], typename CONFIG_T::scale_t scale[CONFIG_T::n_in],
+                  typename CONFIG_T::bias_t bias[CONFIG_T::n_in],
+                  typename CONFIG_T::table_t invert_sqrt_table[CONFIG_T::table_size]) {
+    #pragma HLS INLINE
+
+    typedef typename CONFIG_T::accum_t accum_t;
+    static const int W = accum_t::width;
+    static const int F = accum_t::width - accum_t::iwidth;
+    static constexpr int N = ceillog2(CONFIG_T::table_size);
+    assert(W >= N);
+
+    accum_t sum = 0;
+    accum_t sum_sq = 0;
+Accumulate:
+    for (int i = 0; i < CONFIG_T::n_in; i++) {
+        #pragma HLS UNROLL
+        sum += data[i];
+        sum_sq += data[i] * data[i];
+    }
+
+    accum_t var_n2 = CONFIG_T::n_in * sum_sq - sum * sum;
+    var_n2 += (accum_t)(CONFIG_T::epsilon * CONFIG_T::n_in * CONFIG_T::n_in);
+
+    // Leading one of the (non-negative) variance
+    ap_uint<W> var_bits = var_n2.range(W - 1, 0);
+    int msb = -1;
+LeadingOne:
+    for (int b = 0; b < W; b++) {
+        #pragma HLS UNROLL
+        if (var_bits[b])
+            msb = b;
+    }
+
+    if (msb < 0) {
+        // All inputs are equal and there is no epsilon, the normalized values are 0
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            #pragma HLS UNROLL
+            res[i] = bias[i];
+        }
+        return;
+    }
+
+    int exponent = msb - F; // var_n2 is in [2^exponent, 2^(exponent + 1))
+    int odd = exponent & 1;
+    int shift = (exponent - odd) / 2;
+    ap_uint<W> var_norm = var_bits << (W - 1 - msb);
+    unsigned index = (odd << (N - 1)) | var_norm(W - 2, W - N).to_uint();
+    typename CONFIG_T::table_t inv_sqrt_m = invert_sqrt_table[index];
+
+Normalize:
+    for (int i = 0; i < CONFIG_T::n_in; i++) {
+        #pragma HLS UNROLL
+        accum_t diff = CONFIG_T::n_in * data[i] - sum;
+        accum_t norm = diff * inv_sqrt_m;
+        if (shift >= 0) {
+            norm = norm >> shift;
+        } else {
+            norm = norm << -shift;
+        }
+        res[i] = CONFIG_T::template product<accum_t, typename CONFIG_T::scale_t>::product(norm, scale[i]) + bias[i];
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void layernormalize(data_T data[CONFIG_T::seq_len * CONFIG_T::n_in], res_T res[CONFIG_T::seq_len * CONFIG_T::n_in],
+                    typename CONFIG_T::scale_t scale[CONFIG_T::n_in], typename CONFIG_T::bias_t bias[CONFIG_T::n_in]) {
+    #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+    #pragma HLS ARRAY_PARTITION variable=scale complete
+    #pragma HLS ARRAY_PARTITION variable=bias complete
+
+    // Limits the multipliers of the normalization, the multiplications of the sums are not shared
+    #pragma HLS ALLOCATION operation instances=mul limit=CONFIG_T::multiplier_limit
+
+#ifdef __HLS_SYN__
+    bool initialized = false;
+    typename CONFIG_T::table_t invert_sqrt_table[CONFIG_T::table_size];
+#else
+    static bool initialized = false;
+    static typename CONFIG_T::table_t invert_sqrt_table[CONFIG_T::table_size];
+#endif
+    if (!initialized) {
+        init_invert_sqrt_table<CONFIG_T>(invert_sqrt_table);
+        initialized = true;
+    }
+
+    data_T in_row[CONFIG_T::n_in];
+    res_T out_row[CONFIG_T::n_in];
+    #pragma HLS ARRAY_PARTITION variable=in_row complete
+    #pragma HLS ARRAY_PARTITION variable=out_row complete
+
+LayerNormLoop:
+    for (int j = 0; j < CONFIG_T::seq_len; j++) {
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            #pragma HLS UNROLL
+            in_row[i] = data[j * CONFIG_T::n_in + i];
+        }
+        layernorm_1d<data_T, res_T, CONFIG_T>(in_row, out_row, scale, bias, invert_sqrt_table);
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            #pragma HLS UNROLL
+            res[j * CONFIG_T::n_in + i] = out_row[i];
+        }
+    }
+}
+
+} // namespace nnet
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef NNET_LAYERNORM_STREAM_H_
+#define NNET_LAYERNORM_STREAM_H_
+
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_layernorm.h"
+#include "nnet_types.h"
+
+namespace nnet {
+
+// Each element of the stream is one row of n_in elements, normalized as soon as it is read
+template <class data_T, class res_T, typename CONFIG_T>
+void layernormalize(hls::stream<data_T> &data, hls::stream<res_T> &res, typename CONFIG_T::scale_t scale[CONFIG_T::n_in],
+                    typename CONFIG_T::bias_t bias[CONFIG_T::n_in]) {
+    assert(data_T::size == CONFIG_T::n_in && res_T::size == CONFIG_T::n_in);
+
+    #pragma HLS ARRAY_PARTITION variable=scale complete
+    #pragma HLS ARRAY_PARTITION variable=bias complete
+
+#ifdef __HLS_SYN__
+    bool initialized = false;
+    typename CONFIG_T::table_t invert_sqrt_table[CONFIG_T::table_size];
+#else
+    static bool initialized = false;
+    static typename CONFIG_T::table_t invert_sqrt_table[CONFIG_T::table_size];
+#endif
+    if (!initialized) {
+        init_invert_sqrt_table<CONFIG_T>(invert_sqrt_table);
+        initialized = true;
+    }
+
+LayerNormLoop:
+    for (int j = 0; j < CONFIG_T::seq_len; j++) {
+        #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+        #pragma HLS ALLOCATION operation instances=mul limit=CONFIG_T::multiplier_limit
+
+        data_T in_data = data.read();
+        typename data_T::value_type in_row[CONFIG_T::n_in];
+        typename res_T::value_type out_row[CONFIG_T::n_in];
+        #pragma HLS ARRAY_PARTITION variable=in_row complete
+        #pragma HLS ARRAY_PARTITION variable=out_row complete
+
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            #pragma HLS UNROLL
+            in_row[i] = in_data[i];
+        }
+
+        layernorm_1d<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(in_row, out_row, scale, bias,
+                                                                                        invert_sqrt_table);
+
+        res_T out_data;
+        PRAGMA_DATA_PACK(out_data)
+        for (int i = 0; i < CONFIG_T::n_in; i++) {
+            #pragma HLS UNROLL
+            out_data[i] = out_row[i];
+        }
+        res.write(out_data);
+    }
+}
+
+} // namespace nnet
+
+#endif
@@ -32,6 +32,22 @@ struct concat_config {
     static const unsigned axis = -1;
 };
 
+// Sizes of the inputs of an N-ary concatenation along the concatenation axis
+template <unsigned... N> struct concat_sizes {};
+template <unsigned N0, unsigned... Ns> struct concat_sizes<N0, Ns...> {
+    static const unsigned head = N0;
+    typedef concat_sizes<Ns...> tail;
+};
+
+struct concat_n_config {
+    // Product of the dimensions before and after the concatenation axis
+    static const unsigned n_outer = 1;
+    static const unsigned n_inner = 1;
+    // Size of the output along the concatenation axis
+    static const unsigned n_axis = 10;
+    typedef concat_sizes<5, 5> axis_sizes;
+};
+
 template <class input1_T, class input2_T, class res_T, typename CONFIG_T>
 void add(input1_T data1[CONFIG_T::n_elem], input2_T data2[CONFIG_T::n_elem], res_T res[CONFIG_T::n_elem]) {
     #pragma HLS PIPELINE
@@ -251,6 +267,118 @@ void concatenate3d(input1_T data1[CONFIG_T::n_elem1_0 * CONFIG_T::n_elem1_1 * CO
     }
 }
 
+// *************************************************
+//       N-ary merge
+// *************************************************
+
+// Merges of three or more inputs in a single layer, instead of a chain of binary merge layers. The inputs are passed
+// after the result. add, multiply and average accumulate in CONFIG_T::accum_t, maximum and minimum in the result type.
+namespace merge_n {
+
+struct op_add {
+    template <class acc_T, class x_T> static acc_T merge(acc_T acc, x_T x) { return acc + x; }
+    template <class acc_T> static acc_T result(acc_T acc, unsigned n) { return acc; }
+};
+
+struct op_multiply {
+    template <class acc_T, class x_T> static acc_T merge(acc_T acc, x_T x) { return acc * x; }
+    template <class acc_T> static acc_T result(acc_T acc, unsigned n) { return acc; }
+};
+
+struct op_average {
+    template <class acc_T, class x_T> static acc_T merge(acc_T acc, x_T x) { return acc + x; }
+    template <class acc_T> static acc_T result(acc_T acc, unsigned n) { return acc / n; }
+};
+
+struct op_maximum {
+    template <class acc_T, class x_T> static acc_T merge(acc_T acc, x_T x) {
+        acc_T y = x;
+        return (acc > y) ? acc : y;
+    }
+    template <class acc_T> static acc_T result(acc_T acc, unsigned n) { return acc; }
+};
+
+struct op_minimum {
+    template <class acc_T, class x_T> static acc_T merge(acc_T acc, x_T x) {
+        acc_T y = x;
+        return (acc < y) ? acc : y;
+    }
+    template <class acc_T> static acc_T result(acc_T acc, unsigned n) { return acc; }
+};
+
+template <class acc_T, class Op, class input_T> acc_T merge_elem(acc_T acc, const unsigned i, input_T *data) {
+    #pragma HLS INLINE
+    return Op::merge(acc, data[i]);
+}
+
+template <class acc_T, class Op, class input_T, class... inputs_T>
+acc_T merge_elem(acc_T acc, const unsigned i, input_T *data, inputs_T *...rest) {
+    #pragma HLS INLINE
+    return merge_elem<acc_T, Op>(Op::merge(acc, data[i]), i, rest...);
+}
+
+template <class acc_T, class Op, class res_T, typename CONFIG_T, class input_T, class... inputs_T>
+void merge(res_T res[CONFIG_T::n_elem], input_T *data, inputs_T *...rest) {
+    #pragma HLS PIPELINE
+
+    for (int ii = 0; ii < CONFIG_T::n_elem; ii++) {
+        acc_T acc = data[ii];
+        res[ii] = Op::result(merge_elem<acc_T, Op>(acc, ii, rest...), 1 + sizeof...(rest));
+    }
+}
+
+template <class res_T, typename CONFIG_T, unsigned offset, class sizes, class input_T>
+void concat(res_T res[CONFIG_T::n_outer * CONFIG_T::n_axis * CONFIG_T::n_inner], input_T *data) {
+    #pragma HLS INLINE
+    const unsigned n_chunk = sizes::head * CONFIG_T::n_inner;
+
+    for (int ii = 0; ii < CONFIG_T::n_outer; ii++) {
+        for (int jj = 0; jj < n_chunk; jj++) {
+            res[ii * CONFIG_T::n_axis * CONFIG_T::n_inner + offset + jj] = data[ii * n_chunk + jj];
+        }
+    }
+}
+
+template <class res_T, typename CONFIG_T, unsigned offset, class sizes, class input_T, class... inputs_T>
+void concat(res_T res[CONFIG_T::n_outer * CONFIG_T::n_axis * CONFIG_T::n_inner], input_T *data, inputs_T *...rest) {
+    #pragma HLS INLINE
+    concat<res_T, CONFIG_T, offset, sizes>(res, data);
+    concat<res_T, CONFIG_T, offset + sizes::head * CONFIG_T::n_inner, typename sizes::tail>(res, rest...);
+}
+
+} // namespace merge_n
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void add_n(res_T res[CONFIG_T::n_elem], input_T *...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_add, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void multiply_n(res_T res[CONFIG_T::n_elem], input_T *...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_multiply, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void average_n(res_T res[CONFIG_T::n_elem], input_T *...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_average, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void maximum_n(res_T res[CONFIG_T::n_elem], input_T *...data) {
+    merge_n::merge<res_T, merge_n::op_maximum, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void minimum_n(res_T res[CONFIG_T::n_elem], input_T *...data) {
+    merge_n::merge<res_T, merge_n::op_minimum, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void concatenate_n(res_T res[CONFIG_T::n_outer * CONFIG_T::n_axis * CONFIG_T::n_inner], input_T *...data) {
+    #pragma HLS PIPELINE
+    merge_n::concat<res_T, CONFIG_T, 0, typename CONFIG_T::axis_sizes>(res, data...);
+}
+
 } // namespace nnet
 
 #endif
@@ -3,6 +3,7 @@
 
 #include "hls_stream.h"
 #include "nnet_common.h"
+#include "nnet_merge.h"
 #include <math.h>
 
 namespace nnet {
@@ -365,6 +366,160 @@ ConcatLoop2:
     }
     res.write(out_data);
 }
+
+// *************************************************
+//       N-ary merge
+// *************************************************
+
+// The inputs are read in lockstep, one pack from every input per iteration. The output pack may hold several input packs,
+// it is written once it is complete.
+namespace merge_n {
+
+template <class acc_T, class input_T> void read_first(acc_T acc[input_T::size], hls::stream<input_T> &data) {
+    #pragma HLS INLINE
+    input_T in_data = data.read();
+    for (int j = 0; j < input_T::size; j++) {
+        #pragma HLS UNROLL
+        acc[j] = in_data[j];
+    }
+}
+
+template <class acc_T, class Op, class input_T> void read_merge(acc_T acc[input_T::size], hls::stream<input_T> &data) {
+    #pragma HLS INLINE
+    input_T in_data = data.read();
+    for (int j = 0; j < input_T::size; j++) {
+        #pragma HLS UNROLL
+        acc[j] = Op::merge(acc[j], in_data[j]);
+    }
+}
+
+template <class acc_T, class Op, class input_T, class... inputs_T>
+void read_merge(acc_T acc[input_T::size], hls::stream<input_T> &data, hls::stream<inputs_T> &...rest) {
+    #pragma HLS INLINE
+    read_merge<acc_T, Op>(acc, data);
+    read_merge<acc_T, Op>(acc, rest...);
+}
+
+template <class acc_T, class Op, class res_T, typename CONFIG_T, class input_T, class... inputs_T>
+void merge(hls::stream<res_T> &res, hls::stream<input_T> &data, hls::stream<inputs_T> &...rest) {
+    assert(res_T::size % input_T::size == 0);
+    const unsigned n_packs = res_T::size / input_T::size;
+
+    res_T out_data;
+    PRAGMA_DATA_PACK(out_data)
+
+MergeLoop:
+    for (int i = 0; i < CONFIG_T::n_elem / input_T::size; i++) {
+        #pragma HLS PIPELINE
+
+        acc_T acc[input_T::size];
+        #pragma HLS ARRAY_PARTITION variable = acc complete
+        read_first<acc_T>(acc, data);
+        read_merge<acc_T, Op>(acc, rest...);
+
+    MergePack:
+        for (int j = 0; j < input_T::size; j++) {
+            #pragma HLS UNROLL
+            out_data[(i % n_packs) * input_T::size + j] = Op::result(acc[j], 1 + sizeof...(rest));
+        }
+
+        if (i % n_packs == n_packs - 1) {
+            res.write(out_data);
+        }
+    }
+}
+
+template <unsigned offset, class res_T, class input_T> void concat_pack(res_T &out_data, hls::stream<input_T> &data) {
+    #pragma HLS INLINE
+    input_T in_data = data.read();
+    for (int k = 0; k < input_T::size; k++) {
+        #pragma HLS UNROLL
+        out_data[offset + k] = in_data[k];
+    }
+}
+
+template <unsigned offset, class res_T, class input_T, class... inputs_T>
+void concat_pack(res_T &out_data, hls::stream<input_T> &data, hls::stream<inputs_T> &...rest) {
+    #pragma HLS INLINE
+    concat_pack<offset>(out_data, data);
+    concat_pack<offset + input_T::size>(out_data, rest...);
+}
+
+template <typename CONFIG_T, class sizes, class res_T, class input_T>
+void concat_forward(hls::stream<res_T> &res, hls::stream<input_T> &data) {
+ConcatForward:
+    for (int i = 0; i < sizes::head * CONFIG_T::n_inner / input_T::size; i++) {
+        #pragma HLS PIPELINE II=1
+
+        input_T in_data = data.read();
+        res_T out_data;
+        PRAGMA_DATA_PACK(out_data)
+
+    ConcatForwardPack:
+        for (int k = 0; k < input_T::size; k++) {
+            #pragma HLS UNROLL
+            out_data[k] = in_data[k];
+        }
+
+        res.write(out_data);
+    }
+}
+
+template <typename CONFIG_T, class sizes, class res_T, class input_T, class... inputs_T>
+void concat_forward(hls::stream<res_T> &res, hls::stream<input_T> &data, hls::stream<inputs_T> &...rest) {
+    concat_forward<CONFIG_T, sizes>(res, data);
+    concat_forward<CONFIG_T, typename sizes::tail>(res, rest...);
+}
+
+} // namespace merge_n
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void add_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_add, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void multiply_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_multiply, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void average_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    merge_n::merge<typename CONFIG_T::accum_t, merge_n::op_average, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void maximum_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    merge_n::merge<typename res_T::value_type, merge_n::op_maximum, res_T, CONFIG_T>(res, data...);
+}
+
+template <class res_T, typename CONFIG_T, class... input_T>
+void minimum_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    merge_n::merge<typename res_T::value_type, merge_n::op_minimum, res_T, CONFIG_T>(res, data...);
+}
+
+// Concatenation along the last axis packs one pack of every input into the output pack, along any other axis the input
+// packs are forwarded one input after the other
+template <class res_T, typename CONFIG_T, class... input_T>
+void concatenate_n(hls::stream<res_T> &res, hls::stream<input_T> &...data) {
+    if (CONFIG_T::n_inner == 1) {
+    ConcatLoop:
+        for (int i = 0; i < CONFIG_T::n_outer; i++) {
+            #pragma HLS PIPELINE II=1
+
+            res_T out_data;
+            PRAGMA_DATA_PACK(out_data)
+            merge_n::concat_pack<0>(out_data, data...);
+            res.write(out_data);
+        }
+    } else {
+    ConcatOuterLoop:
+        for (int i = 0; i < CONFIG_T::n_outer; i++) {
+            merge_n::concat_forward<CONFIG_T, typename CONFIG_T::axis_sizes>(res, data...);
+        }
+    }
+}
+
 } // namespace nnet
 
 #endif
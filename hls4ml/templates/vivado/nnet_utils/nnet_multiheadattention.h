@@ -0,0 +1,207 @@
+#ifndef NNET_MULTIHEADATTENTION_H_
+#define NNET_MULTIHEADATTENTION_H_
+
+#include "hls_stream.h"
+#include "nnet_activation.h"
+#include "nnet_common.h"
+#include "nnet_dense.h"
+#include "nnet_mult.h"
+
+namespace nnet {
+
+struct multiheadattention_config {
+    // Internal data type definitions
+    typedef float accum_t;
+    typedef float query_t;
+    typedef float key_t;
+    typedef float value_t;
+    typedef float score_t;
+    typedef float attn_weight_t;
+    typedef float head_output_t;
+
+    // Layer Sizes
+    static const unsigned num_heads = 2;
+    static const unsigned head_dim_key = 8;
+    static const unsigned head_dim_value = 8;
+    static const unsigned feature_dim = 16;
+    static const unsigned feature_dim_kv = 16;
+    static const unsigned output_dim = 16;
+    static const unsigned seq_len = 16;
+    static const unsigned seq_len_kv = 16;
+
+    // Resource reuse info
+    static const unsigned io_type = io_parallel;
+    static const unsigned reuse_factor = 1;
+    static const bool store_weights_in_bram = false;
+
+    // The projections are configured by the dense configs config_query, config_key, config_value and
+    // config_attention_output, the softmax over the scores by config_softmax
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+// Keys and values of every head for the whole key/value sequence. Each head has its own weights, stored head-major.
+template <class data_T, typename CONFIG_T>
+void mha_project_kv(data_T data_kv[CONFIG_T::seq_len_kv * CONFIG_T::feature_dim_kv],
+                    typename CONFIG_T::key_t key[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_key],
+                    typename CONFIG_T::value_t value[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_value],
+                    typename CONFIG_T::config_key::weight_t
+                        key_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+                    typename CONFIG_T::config_key::bias_t key_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+                    typename CONFIG_T::config_value::weight_t
+                        value_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+                    typename CONFIG_T::config_value::bias_t value_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_value]) {
+    #pragma HLS INLINE
+
+    data_T kv_row[CONFIG_T::feature_dim_kv];
+    #pragma HLS ARRAY_PARTITION variable=kv_row complete
+
+KVRowLoop:
+    for (unsigned j = 0; j < CONFIG_T::seq_len_kv; j++) {
+        for (unsigned i = 0; i < CONFIG_T::feature_dim_kv; i++) {
+            #pragma HLS UNROLL
+            kv_row[i] = data_kv[j * CONFIG_T::feature_dim_kv + i];
+        }
+    KVHeadLoop:
+        for (unsigned h = 0; h < CONFIG_T::num_heads; h++) {
+            #pragma HLS UNROLL
+            dense<data_T, typename CONFIG_T::key_t, typename CONFIG_T::config_key>(
+                kv_row, key[h][j], &key_weight[h * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+                &key_bias[h * CONFIG_T::head_dim_key]);
+            dense<data_T, typename CONFIG_T::value_t, typename CONFIG_T::config_value>(
+                kv_row, value[h][j], &value_weight[h * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+                &value_bias[h * CONFIG_T::head_dim_value]);
+        }
+    }
+}
+
+// Attention of one query row. Per head, the query is projected, scored against every key, the scores go through the
+// lookup-table softmax and weight the sum of the values. The heads are concatenated and go through the output projection.
+template <class data_T, class res_T, typename CONFIG_T>
+void mha_attend_row(
+    data_T q_row[CONFIG_T::feature_dim], res_T res_row[CONFIG_T::output_dim],
+    typename CONFIG_T::key_t key[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_key],
+    typename CONFIG_T::value_t value[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_query::weight_t query_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_query::bias_t query_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_attention_output::weight_t
+        attention_output_weight[CONFIG_T::num_heads * CONFIG_T::head_dim_value * CONFIG_T::output_dim],
+    typename CONFIG_T::config_attention_output::bias_t attention_output_bias[CONFIG_T::output_dim]) {
+    #pragma HLS INLINE
+
+    typename CONFIG_T::head_output_t head_output[CONFIG_T::num_heads * CONFIG_T::head_dim_value];
+    #pragma HLS ARRAY_PARTITION variable=head_output complete
+
+HeadLoop:
+    for (unsigned h = 0; h < CONFIG_T::num_heads; h++) {
+        #pragma HLS UNROLL
+        typename CONFIG_T::query_t query[CONFIG_T::head_dim_key];
+        typename CONFIG_T::score_t score[CONFIG_T::seq_len_kv];
+        typename CONFIG_T::attn_weight_t attn_weight[CONFIG_T::seq_len_kv];
+        #pragma HLS ARRAY_PARTITION variable=query complete
+        #pragma HLS ARRAY_PARTITION variable=score complete
+        #pragma HLS ARRAY_PARTITION variable=attn_weight complete
+
+        // The query projection includes the 1/sqrt(head_dim_key) scaling of the scores
+        dense<data_T, typename CONFIG_T::query_t, typename CONFIG_T::config_query>(
+            q_row, query, &query_weight[h * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+            &query_bias[h * CONFIG_T::head_dim_key]);
+
+    ScoreLoop:
+        for (unsigned j = 0; j < CONFIG_T::seq_len_kv; j++) {
+            #pragma HLS UNROLL
+            typename CONFIG_T::accum_t acc = 0;
+            for (unsigned d = 0; d < CONFIG_T::head_dim_key; d++) {
+                #pragma HLS UNROLL
+                acc += CONFIG_T::template product<typename CONFIG_T::query_t, typename CONFIG_T::key_t>::product(
+                    query[d], key[h][j][d]);
+            }
+            score[j] = acc;
+        }
+
+        softmax<typename CONFIG_T::score_t, typename CONFIG_T::attn_weight_t, typename CONFIG_T::config_softmax>(score,
+                                                                                                                attn_weight);
+
+    WeightedSumLoop:
+        for (unsigned d = 0; d < CONFIG_T::head_dim_value; d++) {
+            #pragma HLS UNROLL
+            typename CONFIG_T::accum_t acc = 0;
+            for (unsigned j = 0; j < CONFIG_T::seq_len_kv; j++) {
+                #pragma HLS UNROLL
+                acc += CONFIG_T::template product<typename CONFIG_T::attn_weight_t, typename CONFIG_T::value_t>::product(
+                    attn_weight[j], value[h][j][d]);
+            }
+            head_output[h * CONFIG_T::head_dim_value + d] = acc;
+        }
+    }
+
+    dense<typename CONFIG_T::head_output_t, res_T, typename CONFIG_T::config_attention_output>(
+        head_output, res_row, attention_output_weight, attention_output_bias);
+}
+
+template <class data_T, class data_kv_T, class res_T, typename CONFIG_T>
+void multiheadattention(
+    data_T data_q[CONFIG_T::seq_len * CONFIG_T::feature_dim], data_kv_T data_kv[CONFIG_T::seq_len_kv * CONFIG_T::feature_dim_kv],
+    res_T res[CONFIG_T::seq_len * CONFIG_T::output_dim],
+    typename CONFIG_T::config_query::weight_t query_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_query::bias_t query_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::weight_t key_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::bias_t key_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_value::weight_t
+        value_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_value::bias_t value_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_attention_output::weight_t
+        attention_output_weight[CONFIG_T::num_heads * CONFIG_T::head_dim_value * CONFIG_T::output_dim],
+    typename CONFIG_T::config_attention_output::bias_t attention_output_bias[CONFIG_T::output_dim]) {
+
+    typename CONFIG_T::key_t key[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_key];
+    typename CONFIG_T::value_t value[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_value];
+    #pragma HLS ARRAY_PARTITION variable=key complete dim=0
+    #pragma HLS ARRAY_PARTITION variable=value complete dim=0
+
+    mha_project_kv<data_kv_T, CONFIG_T>(data_kv, key, value, key_weight, key_bias, value_weight, value_bias);
+
+    data_T q_row[CONFIG_T::feature_dim];
+    res_T res_row[CONFIG_T::output_dim];
+    #pragma HLS ARRAY_PARTITION variable=q_row complete
+    #pragma HLS ARRAY_PARTITION variable=res_row complete
+
+QueryLoop:
+    for (unsigned i = 0; i < CONFIG_T::seq_len; i++) {
+        #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+        for (unsigned k = 0; k < CONFIG_T::feature_dim; k++) {
+            #pragma HLS UNROLL
+            q_row[k] = data_q[i * CONFIG_T::feature_dim + k];
+        }
+        mha_attend_row<data_T, res_T, CONFIG_T>(q_row, res_row, key, value, query_weight, query_bias, attention_output_weight,
+                                                attention_output_bias);
+        for (unsigned k = 0; k < CONFIG_T::output_dim; k++) {
+            #pragma HLS UNROLL
+            res[i * CONFIG_T::output_dim + k] = res_row[k];
+        }
+    }
+}
+
+// Self-attention, the input is the query, the key and the value
+template <class data_T, class res_T, typename CONFIG_T>
+void multiheadattention(
+    data_T data[CONFIG_T::seq_len * CONFIG_T::feature_dim], res_T res[CONFIG_T::seq_len * CONFIG_T::output_dim],
+    typename CONFIG_T::config_query::weight_t query_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_query::bias_t query_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::weight_t key_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::bias_t key_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_value::weight_t
+        value_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_value::bias_t value_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_attention_output::weight_t
+        attention_output_weight[CONFIG_T::num_heads * CONFIG_T::head_dim_value * CONFIG_T::output_dim],
+    typename CONFIG_T::config_attention_output::bias_t attention_output_bias[CONFIG_T::output_dim]) {
+    #pragma HLS INLINE
+
+    multiheadattention<data_T, data_T, res_T, CONFIG_T>(data, data, res, query_weight, query_bias, key_weight, key_bias,
+                                                        value_weight, value_bias, attention_output_weight,
+                                                        attention_output_bias);
+}
+
+} // namespace nnet
+
+#endif
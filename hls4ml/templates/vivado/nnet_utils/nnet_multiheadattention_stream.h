@@ -0,0 +1,134 @@
+#ifndef NNET_MULTIHEADATTENTION_STREAM_H_
+#define NNET_MULTIHEADATTENTION_STREAM_H_
+
+#include "hls_stream.h"
+#include "nnet_common.h"
+#include "nnet_multiheadattention.h"
+#include "nnet_types.h"
+
+namespace nnet {
+
+// Each element of the streams is one token. The keys and values of the whole sequence are needed before the first
+// output, after which the outputs are streamed as the query tokens arrive.
+template <class data_T, class data_kv_T, class res_T, typename CONFIG_T>
+void multiheadattention(
+    hls::stream<data_T> &data_q, hls::stream<data_kv_T> &data_kv, hls::stream<res_T> &res,
+    typename CONFIG_T::config_query::weight_t query_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_query::bias_t query_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::weight_t key_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::bias_t key_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_value::weight_t
+        value_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_value::bias_t value_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_attention_output::weight_t
+        attention_output_weight[CONFIG_T::num_heads * CONFIG_T::head_dim_value * CONFIG_T::output_dim],
+    typename CONFIG_T::config_attention_output::bias_t attention_output_bias[CONFIG_T::output_dim]) {
+    assert(data_T::size == CONFIG_T::feature_dim && data_kv_T::size == CONFIG_T::feature_dim_kv);
+    assert(res_T::size == CONFIG_T::output_dim);
+
+    typename data_kv_T::value_type kv_buffer[CONFIG_T::seq_len_kv * CONFIG_T::feature_dim_kv];
+    #pragma HLS ARRAY_PARTITION variable=kv_buffer complete
+
+ReadKVLoop:
+    for (unsigned j = 0; j < CONFIG_T::seq_len_kv; j++) {
+        #pragma HLS PIPELINE
+        data_kv_T in_data = data_kv.read();
+        for (unsigned i = 0; i < CONFIG_T::feature_dim_kv; i++) {
+            #pragma HLS UNROLL
+            kv_buffer[j * CONFIG_T::feature_dim_kv + i] = in_data[i];
+        }
+    }
+
+    typename CONFIG_T::key_t key[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_key];
+    typename CONFIG_T::value_t value[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_value];
+    #pragma HLS ARRAY_PARTITION variable=key complete dim=0
+    #pragma HLS ARRAY_PARTITION variable=value complete dim=0
+
+    mha_project_kv<typename data_kv_T::value_type, CONFIG_T>(kv_buffer, key, value, key_weight, key_bias, value_weight,
+                                                             value_bias);
+
+QueryLoop:
+    for (unsigned i = 0; i < CONFIG_T::seq_len; i++) {
+        #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+        data_T in_data = data_q.read();
+        typename data_T::value_type q_row[CONFIG_T::feature_dim];
+        typename res_T::value_type res_row[CONFIG_T::output_dim];
+        #pragma HLS ARRAY_PARTITION variable=q_row complete
+        #pragma HLS ARRAY_PARTITION variable=res_row complete
+        for (unsigned k = 0; k < CONFIG_T::feature_dim; k++) {
+            #pragma HLS UNROLL
+            q_row[k] = in_data[k];
+        }
+
+        mha_attend_row<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(
+            q_row, res_row, key, value, query_weight, query_bias, attention_output_weight, attention_output_bias);
+
+        res_T out_data;
+        PRAGMA_DATA_PACK(out_data)
+        for (unsigned k = 0; k < CONFIG_T::output_dim; k++) {
+            #pragma HLS UNROLL
+            out_data[k] = res_row[k];
+        }
+        res.write(out_data);
+    }
+}
+
+// Self-attention, the tokens are buffered once and used as the query, the key and the value
+template <class data_T, class res_T, typename CONFIG_T>
+void multiheadattention(
+    hls::stream<data_T> &data, hls::stream<res_T> &res,
+    typename CONFIG_T::config_query::weight_t query_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_query::bias_t query_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::weight_t key_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_key::bias_t key_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_key],
+    typename CONFIG_T::config_value::weight_t
+        value_weight[CONFIG_T::num_heads * CONFIG_T::feature_dim_kv * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_value::bias_t value_bias[CONFIG_T::num_heads * CONFIG_T::head_dim_value],
+    typename CONFIG_T::config_attention_output::weight_t
+        attention_output_weight[CONFIG_T::num_heads * CONFIG_T::head_dim_value * CONFIG_T::output_dim],
+    typename CONFIG_T::config_attention_output::bias_t attention_output_bias[CONFIG_T::output_dim]) {
+    assert(data_T::size == CONFIG_T::feature_dim && res_T::size == CONFIG_T::output_dim);
+
+    typename data_T::value_type buffer[CONFIG_T::seq_len * CONFIG_T::feature_dim];
+    #pragma HLS ARRAY_PARTITION variable=buffer complete
+
+ReadLoop:
+    for (unsigned j = 0; j < CONFIG_T::seq_len; j++) {
+        #pragma HLS PIPELINE
+        data_T in_data = data.read();
+        for (unsigned i = 0; i < CONFIG_T::feature_dim; i++) {
+            #pragma HLS UNROLL
+            buffer[j * CONFIG_T::feature_dim + i] = in_data[i];
+        }
+    }
+
+    typename CONFIG_T::key_t key[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_key];
+    typename CONFIG_T::value_t value[CONFIG_T::num_heads][CONFIG_T::seq_len_kv][CONFIG_T::head_dim_value];
+    #pragma HLS ARRAY_PARTITION variable=key complete dim=0
+    #pragma HLS ARRAY_PARTITION variable=value complete dim=0
+
+    mha_project_kv<typename data_T::value_type, CONFIG_T>(buffer, key, value, key_weight, key_bias, value_weight, value_bias);
+
+QueryLoop:
+    for (unsigned i = 0; i < CONFIG_T::seq_len; i++) {
+        #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+        typename res_T::value_type res_row[CONFIG_T::output_dim];
+        #pragma HLS ARRAY_PARTITION variable=res_row complete
+
+        mha_attend_row<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(
+            &buffer[i * CONFIG_T::feature_dim], res_row, key, value, query_weight, query_bias, attention_output_weight,
+            attention_output_bias);
+
+        res_T out_data;
+        PRAGMA_DATA_PACK(out_data)
+        for (unsigned k = 0; k < CONFIG_T::output_dim; k++) {
+            #pragma HLS UNROLL
+            out_data[k] = res_row[k];
+        }
+        res.write(out_data);
+    }
+}
+
+} // namespace nnet
+
+#endif
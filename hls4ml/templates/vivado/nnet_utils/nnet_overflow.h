@@ -0,0 +1,129 @@
+#ifndef NNET_OVERFLOW_H_
+#define NNET_OVERFLOW_H_
+
+#include "ap_fixed.h"
+
+#ifdef HLS4ML_OVERFLOW_COUNTERS
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#endif
+
+namespace nnet {
+
+#ifdef HLS4ML_OVERFLOW_COUNTERS
+
+// Overflow counters of the emulation library, built with -DHLS4ML_OVERFLOW_COUNTERS when OverflowCounters is enabled.
+// Every fixed-point conversion in a layer is recorded per destination type, table indices have a width of 0.
+struct overflow_counter_data {
+    unsigned layer;
+    int width;
+    int integer;
+    int is_signed;
+    int rounding_mode;
+    int saturation_mode;
+    unsigned long long assignments;
+    unsigned long long overflows;
+    unsigned long long saturations;
+    unsigned long long roundings;
+    double min;
+    double max;
+};
+
+struct overflow_counter_state {
+    std::vector<overflow_counter_data> counters;
+    int layer;
+    bool recording;
+};
+
+inline overflow_counter_state &overflow_counters() {
+    static overflow_counter_state state = {std::vector<overflow_counter_data>(), -1, false};
+    return state;
+}
+
+inline void overflow_counters_begin(unsigned layer) { overflow_counters().layer = layer; }
+
+inline void overflow_counters_end() { overflow_counters().layer = -1; }
+
+inline void record_overflow_event(int width, int integer, int is_signed, int rounding_mode, int saturation_mode,
+                                  double value, bool overflow, bool saturation, bool rounding) {
+    overflow_counter_state &state = overflow_counters();
+    overflow_counter_data *counter = NULL;
+    for (unsigned i = 0; i < state.counters.size(); i++) {
+        overflow_counter_data &c = state.counters[i];
+        if (c.layer == (unsigned)state.layer && c.width == width && c.integer == integer && c.is_signed == is_signed &&
+            c.rounding_mode == rounding_mode && c.saturation_mode == saturation_mode) {
+            counter = &c;
+            break;
+        }
+    }
+    if (counter == NULL) {
+        overflow_counter_data c = {};
+        c.layer = state.layer;
+        c.width = width;
+        c.integer = integer;
+        c.is_signed = is_signed;
+        c.rounding_mode = rounding_mode;
+        c.saturation_mode = saturation_mode;
+        c.min = std::numeric_limits<double>::infinity();
+        c.max = -std::numeric_limits<double>::infinity();
+        state.counters.push_back(c);
+        counter = &state.counters.back();
+    }
+
+    counter->assignments++;
+    counter->overflows += overflow && !saturation;
+    counter->saturations += saturation;
+    counter->roundings += rounding;
+    counter->min = std::min(counter->min, value);
+    counter->max = std::max(counter->max, value);
+}
+
+template <class index_T> inline void record_table_index(index_T index, int table_size) {
+    overflow_counter_state &state = overflow_counters();
+    if (state.layer < 0 || state.recording) {
+        return;
+    }
+    // Out of range indices are clamped to the table
+    bool saturation = index < 0 || index > table_size - 1;
+    record_overflow_event(0, 0, 1, 0, 0, (double)index, saturation, saturation, false);
+}
+
+#else
+
+template <class index_T> inline void record_table_index(index_T index, int table_size) {}
+
+#endif
+
+} // namespace nnet
+
+#ifdef HLS4ML_OVERFLOW_COUNTERS
+
+// Called by ap_fixed_base::operator= with the source and the converted value
+template <int W2, int I2, bool S2, ap_q_mode Q2, ap_o_mode O2, int N2, int W, int I, bool S, ap_q_mode Q, ap_o_mode O,
+          int N>
+void record_conversion(const ap_fixed_base<W2, I2, S2, Q2, O2, N2> &src, const ap_fixed_base<W, I, S, Q, O, N> &dst) {
+    nnet::overflow_counter_state &state = nnet::overflow_counters();
+    // The conversions done by the arithmetic below are not recorded
+    if (state.layer < 0 || state.recording) {
+        return;
+    }
+    state.recording = true;
+
+    double value = src.to_double();
+    double error = std::fabs(dst.to_double() - value);
+    double lsb = std::ldexp(1.0, I - W);
+    double low = S ? -std::ldexp(1.0, I - 1) : 0.0;
+    double high = std::ldexp(1.0, S ? I - 1 : I);
+    bool overflow = value < low || value >= high || error >= lsb;
+    bool saturation = overflow && O != AP_WRAP && O != AP_WRAP_SM;
+    bool rounding = !overflow && error > 0;
+    nnet::record_overflow_event(W, I, S, Q, O, value, overflow, saturation, rounding);
+
+    state.recording = false;
+}
+
+#endif
+
+#endif
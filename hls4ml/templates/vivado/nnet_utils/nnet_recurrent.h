@@ -22,6 +22,9 @@ struct lstm_config {
     static const unsigned n_4state = 8;
     static const unsigned table_size = 1024;
 
+    // Number of independent sequences processed by the interleaved stacks
+    static const unsigned n_interleave = 1;
+
     // Resource reuse info
     static const unsigned io_type = io_parallel;
     static const unsigned reuse_factor = 1;
@@ -108,16 +111,14 @@ void lstm(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG
     }
 }
 
+// Single LSTM timestep on an explicit state, the state is updated in place. Shared by lstm_static and the interleaved
+// stacks, which keep the state of several sequences.
 template <class data_T, class res_T, typename CONFIG_T>
-void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG_T::n_state],
-                 res_T s_newstate[CONFIG_T::n_state],
-                 typename CONFIG_T::weight_t param[CONFIG_T::n_state * 4 * CONFIG_T::n_in],
-                 typename CONFIG_T::weight_t param_r[CONFIG_T::n_state * 4 * CONFIG_T::n_state],
-                 typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 4],
-                 typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 4]) {
-    static res_T h_state[CONFIG_T::n_state];
-    static res_T s_state[CONFIG_T::n_state];
-    // Initialize the state variable -- will maintain state between function calls
+void lstm_cell(data_T data[CONFIG_T::n_in], res_T h_state[CONFIG_T::n_state], res_T s_state[CONFIG_T::n_state],
+               typename CONFIG_T::weight_t param[CONFIG_T::n_state * 4 * CONFIG_T::n_in],
+               typename CONFIG_T::weight_t param_r[CONFIG_T::n_state * 4 * CONFIG_T::n_state],
+               typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 4],
+               typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 4]) {
     typename CONFIG_T::accum_t tmpres[CONFIG_T::n_state * 4];
     typename CONFIG_T::accum_t tmpres_state[CONFIG_T::n_state * 4];
     typename CONFIG_T::accum_t tmpres_ifo[CONFIG_T::n_state * 3];   // activated i,f,o matrices (keras notation)
@@ -126,8 +127,6 @@ void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate
     typename CONFIG_T::accum_t inputacc_c[CONFIG_T::n_state];       // c-matrix (keras notation)
     typename CONFIG_T::accum_t s_actstate[CONFIG_T::n_state];
 
-    #pragma HLS ARRAY_PARTITION variable=h_newstate   complete
-    #pragma HLS ARRAY_PARTITION variable=s_newstate   complete
     #pragma HLS ARRAY_PARTITION variable=h_state      complete
     #pragma HLS ARRAY_PARTITION variable=s_state      complete
     #pragma HLS ARRAY_PARTITION variable=tmpres       complete
@@ -138,14 +137,6 @@ void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate
     #pragma HLS ARRAY_PARTITION variable=inputacc_c   complete
     #pragma HLS ARRAY_PARTITION variable=s_actstate   complete
 
-    if (reset_state) {
-        for (int i_state = 0; i_state < (CONFIG_T::n_state); i_state++) {
-            #pragma HLS UNROLL
-            s_state[i_state] = 0;
-            h_state[i_state] = 0;
-        }
-    }
-
     nnet::dense<data_T, typename CONFIG_T::accum_t, typename CONFIG_T::mult_config1>(data, tmpres, param, param_b);
     nnet::dense<res_T, typename CONFIG_T::accum_t, typename CONFIG_T::mult_config2>(h_state, tmpres_state, param_r,
                                                                                     param_br);
@@ -174,7 +165,6 @@ void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate
     for (int iacc = 0; iacc < (CONFIG_T::n_state); iacc++) {
         #pragma HLS UNROLL
         s_state[iacc] = tmpres_c[iacc] * tmpres_ifo[iacc] + s_state[iacc] * tmpres_ifo[iacc + (CONFIG_T::n_state)];
-        s_newstate[iacc] = s_state[iacc];
     }
     // Operation: h=act(s)*o
     CONFIG_T::template activation<data_T, typename CONFIG_T::weight_t, typename CONFIG_T::ACT_CONFIG_T>::activation(
@@ -183,6 +173,38 @@ void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate
     for (int iacc = 0; iacc < CONFIG_T::n_state; iacc++) {
         #pragma HLS UNROLL
         h_state[iacc] = tmpres_ifo[iacc + 2 * (CONFIG_T::n_state)] * s_actstate[iacc];
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void lstm_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG_T::n_state],
+                 res_T s_newstate[CONFIG_T::n_state],
+                 typename CONFIG_T::weight_t param[CONFIG_T::n_state * 4 * CONFIG_T::n_in],
+                 typename CONFIG_T::weight_t param_r[CONFIG_T::n_state * 4 * CONFIG_T::n_state],
+                 typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 4],
+                 typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 4]) {
+    static res_T h_state[CONFIG_T::n_state];
+    static res_T s_state[CONFIG_T::n_state];
+    // Initialize the state variable -- will maintain state between function calls
+
+    #pragma HLS ARRAY_PARTITION variable=h_newstate   complete
+    #pragma HLS ARRAY_PARTITION variable=s_newstate   complete
+    #pragma HLS ARRAY_PARTITION variable=h_state      complete
+    #pragma HLS ARRAY_PARTITION variable=s_state      complete
+
+    if (reset_state) {
+        for (int i_state = 0; i_state < (CONFIG_T::n_state); i_state++) {
+            #pragma HLS UNROLL
+            s_state[i_state] = 0;
+            h_state[i_state] = 0;
+        }
+    }
+
+    nnet::lstm_cell<data_T, res_T, CONFIG_T>(data, h_state, s_state, param, param_r, param_b, param_br);
+
+    for (int iacc = 0; iacc < CONFIG_T::n_state; iacc++) {
+        #pragma HLS UNROLL
+        s_newstate[iacc] = s_state[iacc];
         h_newstate[iacc] = h_state[iacc];
     }
 }
@@ -295,6 +317,162 @@ DataPropagation:
     }
 }
 
+// Interleaved LSTM stacks: CONFIG_T::n_interleave independent sequences share one pipelined cell. The timesteps of
+// the sequences are processed round-robin (step t of every sequence, then step t + 1), so consecutive iterations of the
+// pipeline never depend on each other and a new timestep can start every reuse_factor cycles, as long as n_interleave
+// is at least the latency of the cell. The state of a sequence is only carried over n_interleave iterations, which is
+// the distance given to HLS for the dependence on the states. Each sequence gives the same result as lstm_stack with
+// use_static.
+// The sequences are stored one after the other in data and res.
+template <class data_T, class res_T, typename CONFIG_T>
+void lstm_stack_interleaved(data_T data[CONFIG_T::n_interleave * CONFIG_T::n_sequence * CONFIG_T::n_in],
+                            res_T res[CONFIG_T::n_interleave * CONFIG_T::n_sequence_out * CONFIG_T::n_state],
+                            typename CONFIG_T::weight_t param[CONFIG_T::n_state * 4 * CONFIG_T::n_in],
+                            typename CONFIG_T::weight_t param_r[CONFIG_T::n_state * 4 * CONFIG_T::n_state],
+                            typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 4],
+                            typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 4]) {
+
+    res_T h_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    res_T s_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    #pragma HLS ARRAY_PARTITION variable=h_state complete dim=2
+    #pragma HLS ARRAY_PARTITION variable=s_state complete dim=2
+
+ResetState:
+    for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+        for (int ii = 0; ii < CONFIG_T::n_state; ii++) {
+            #pragma HLS UNROLL
+            h_state[i_seq][ii] = 0;
+            s_state[i_seq][ii] = 0;
+        }
+    }
+
+SequenceLoop:
+    for (int iloop = 0; iloop < CONFIG_T::n_sequence; iloop++) {
+    InterleaveLoop:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            #pragma HLS DEPENDENCE variable=h_state inter distance=CONFIG_T::n_interleave true
+            #pragma HLS DEPENDENCE variable=s_state inter distance=CONFIG_T::n_interleave true
+            data_T data_in[CONFIG_T::n_in];
+            res_T h_cur[CONFIG_T::n_state];
+            res_T s_cur[CONFIG_T::n_state];
+            #pragma HLS ARRAY_PARTITION variable=data_in complete
+            #pragma HLS ARRAY_PARTITION variable=h_cur complete
+            #pragma HLS ARRAY_PARTITION variable=s_cur complete
+
+            for (int j = 0; j < CONFIG_T::n_in; j++) {
+                #pragma HLS UNROLL
+                data_in[j] = data[(i_seq * CONFIG_T::n_sequence + iloop) * CONFIG_T::n_in + j];
+            }
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_cur[j] = h_state[i_seq][j];
+                s_cur[j] = s_state[i_seq][j];
+            }
+
+            nnet::lstm_cell<data_T, res_T, CONFIG_T>(data_in, h_cur, s_cur, param, param_r, param_b, param_br);
+
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_state[i_seq][j] = h_cur[j];
+                s_state[i_seq][j] = s_cur[j];
+                if (CONFIG_T::n_sequence_out > 1)
+                    res[(i_seq * CONFIG_T::n_sequence_out + iloop) * CONFIG_T::n_state + j] = h_cur[j];
+            }
+        }
+    }
+
+    if (CONFIG_T::n_sequence_out == 1)
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            for (int i = 0; i < CONFIG_T::n_state; i++) {
+                #pragma HLS UNROLL
+                res[i_seq * CONFIG_T::n_state + i] = h_state[i_seq][i];
+            }
+        }
+}
+
+// The streams carry the sequences interleaved by timestep: step t of sequence 0 to n_interleave - 1, then step t + 1.
+// Without return_sequences the final states are written in the order of the sequences.
+template <class data_T, class res_T, typename CONFIG_T>
+void lstm_stack_interleaved(hls::stream<data_T> &data_stream, hls::stream<res_T> &res_stream,
+                            typename CONFIG_T::weight_t param[CONFIG_T::n_state * 4 * CONFIG_T::n_in],
+                            typename CONFIG_T::weight_t param_r[CONFIG_T::n_state * 4 * CONFIG_T::n_state],
+                            typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 4],
+                            typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 4]) {
+    assert(data_T::size == CONFIG_T::n_in && res_T::size == CONFIG_T::n_state);
+
+    typename res_T::value_type h_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    typename res_T::value_type s_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    #pragma HLS ARRAY_PARTITION variable=h_state complete dim=2
+    #pragma HLS ARRAY_PARTITION variable=s_state complete dim=2
+
+ResetState:
+    for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+        for (int ii = 0; ii < CONFIG_T::n_state; ii++) {
+            #pragma HLS UNROLL
+            h_state[i_seq][ii] = 0;
+            s_state[i_seq][ii] = 0;
+        }
+    }
+
+DataPropagation:
+    for (int iloop = 0; iloop < CONFIG_T::n_sequence; iloop++) {
+    InterleaveLoop:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            #pragma HLS DEPENDENCE variable=h_state inter distance=CONFIG_T::n_interleave true
+            #pragma HLS DEPENDENCE variable=s_state inter distance=CONFIG_T::n_interleave true
+            typename data_T::value_type data_in[CONFIG_T::n_in];
+            typename res_T::value_type h_cur[CONFIG_T::n_state];
+            typename res_T::value_type s_cur[CONFIG_T::n_state];
+            #pragma HLS ARRAY_PARTITION variable=data_in complete
+            #pragma HLS ARRAY_PARTITION variable=h_cur complete
+            #pragma HLS ARRAY_PARTITION variable=s_cur complete
+
+            data_T data_pack = data_stream.read();
+        DataPack:
+            for (int i_pack = 0; i_pack < data_T::size; i_pack++) {
+                #pragma HLS UNROLL
+                data_in[i_pack] = data_pack[i_pack];
+            }
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_cur[j] = h_state[i_seq][j];
+                s_cur[j] = s_state[i_seq][j];
+            }
+
+            nnet::lstm_cell<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(
+                data_in, h_cur, s_cur, param, param_r, param_b, param_br);
+
+            res_T res_pack;
+            PRAGMA_DATA_PACK(res_pack)
+        ResPack_sequences:
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_state[i_seq][j] = h_cur[j];
+                s_state[i_seq][j] = s_cur[j];
+                res_pack[j] = h_cur[j];
+            }
+            if (CONFIG_T::n_sequence_out > 1)
+                res_stream.write(res_pack);
+        }
+    }
+
+    if (CONFIG_T::n_sequence_out == 1) {
+    ResPack:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE
+            res_T res_pack;
+            PRAGMA_DATA_PACK(res_pack)
+            for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
+                #pragma HLS UNROLL
+                res_pack[i_pack] = h_state[i_seq][i_pack];
+            }
+            res_stream.write(res_pack);
+        }
+    }
+}
+
 // Struct for the GRU template
 
 struct gru_config {
@@ -311,6 +489,9 @@ struct gru_config {
     static const unsigned n_4state = 8;
     static const unsigned table_size = 1024;
 
+    // Number of independent sequences processed by the interleaved stacks
+    static const unsigned n_interleave = 1;
+
     // Resource reuse info
     static const unsigned io_type = io_parallel;
     static const unsigned reuse_factor = 1;
@@ -389,15 +570,13 @@ void gru(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG_
     }
 }
 
+// Single GRU timestep on an explicit state, the state is updated in place. Shared by gru_static and the interleaved stacks.
 template <class data_T, class res_T, typename CONFIG_T>
-void gru_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG_T::n_state],
-                typename CONFIG_T::weight_t param[CONFIG_T::n_state * 3 * CONFIG_T::n_in],
-                typename CONFIG_T::weight_t param_zr[CONFIG_T::n_state * 3 * CONFIG_T::n_state],
-                typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 3],
-                typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 3]) {
-    // Initialize the state variable -- will maintain state between function calls
-
-    static res_T h_state[CONFIG_T::n_state];
+void gru_cell(data_T data[CONFIG_T::n_in], res_T h_state[CONFIG_T::n_state],
+              typename CONFIG_T::weight_t param[CONFIG_T::n_state * 3 * CONFIG_T::n_in],
+              typename CONFIG_T::weight_t param_zr[CONFIG_T::n_state * 3 * CONFIG_T::n_state],
+              typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 3],
+              typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 3]) {
     typename CONFIG_T::accum_t tmpres[CONFIG_T::n_state * 3];
     typename CONFIG_T::accum_t tmpres_state_zr[CONFIG_T::n_state * 3];
     typename CONFIG_T::accum_t tmpres_state_h[CONFIG_T::n_state];
@@ -407,7 +586,6 @@ void gru_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[
     typename CONFIG_T::accum_t inputacc_h[CONFIG_T::n_state];      // c-matrix (keras notation)
 
     #pragma HLS ARRAY_PARTITION variable=h_state         complete
-    #pragma HLS ARRAY_PARTITION variable=h_newstate      complete
     #pragma HLS ARRAY_PARTITION variable=tmpres          complete
     #pragma HLS ARRAY_PARTITION variable=tmpres_state_zr complete
     #pragma HLS ARRAY_PARTITION variable=tmpres_state_h  complete
@@ -416,13 +594,6 @@ void gru_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[
     #pragma HLS ARRAY_PARTITION variable=inputacc_zr     complete
     #pragma HLS ARRAY_PARTITION variable=inputacc_h      complete
 
-    if (reset_state) {
-        for (int i_h_state = 0; i_h_state < (CONFIG_T::n_state); i_h_state++) {
-            #pragma HLS UNROLL
-            h_state[i_h_state] = 0;
-        }
-    }
-
     nnet::dense<data_T, typename CONFIG_T::accum_t, typename CONFIG_T::mult_config1>(data, tmpres, param, param_b);
     nnet::dense<res_T, typename CONFIG_T::accum_t, typename CONFIG_T::mult_config2>(h_state, tmpres_state_zr, param_zr,
                                                                                     param_br);
@@ -462,6 +633,33 @@ void gru_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[
     for (int iacc = 0; iacc < (CONFIG_T::n_state); iacc++) {
         #pragma HLS UNROLL
         h_state[iacc] = (res_T)(tmpres_h[iacc] * (1 - tmpres_zr[iacc]) + h_state[iacc] * tmpres_zr[iacc]);
+    }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void gru_static(bool reset_state, data_T data[CONFIG_T::n_in], res_T h_newstate[CONFIG_T::n_state],
+                typename CONFIG_T::weight_t param[CONFIG_T::n_state * 3 * CONFIG_T::n_in],
+                typename CONFIG_T::weight_t param_zr[CONFIG_T::n_state * 3 * CONFIG_T::n_state],
+                typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 3],
+                typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 3]) {
+    // Initialize the state variable -- will maintain state between function calls
+
+    static res_T h_state[CONFIG_T::n_state];
+
+    #pragma HLS ARRAY_PARTITION variable=h_state         complete
+    #pragma HLS ARRAY_PARTITION variable=h_newstate      complete
+
+    if (reset_state) {
+        for (int i_h_state = 0; i_h_state < (CONFIG_T::n_state); i_h_state++) {
+            #pragma HLS UNROLL
+            h_state[i_h_state] = 0;
+        }
+    }
+
+    nnet::gru_cell<data_T, res_T, CONFIG_T>(data, h_state, param, param_zr, param_b, param_br);
+
+    for (int iacc = 0; iacc < (CONFIG_T::n_state); iacc++) {
+        #pragma HLS UNROLL
         h_newstate[iacc] = h_state[iacc];
     }
 }
@@ -566,6 +764,138 @@ DataPropagation:
     }
 }
 
+// Interleaved GRU stacks, the layout of the data is the same as in lstm_stack_interleaved
+template <class data_T, class res_T, typename CONFIG_T>
+void gru_stack_interleaved(data_T data[CONFIG_T::n_interleave * CONFIG_T::n_sequence * CONFIG_T::n_in],
+                           res_T res[CONFIG_T::n_interleave * CONFIG_T::n_sequence_out * CONFIG_T::n_state],
+                           typename CONFIG_T::weight_t param[CONFIG_T::n_state * 3 * CONFIG_T::n_in],
+                           typename CONFIG_T::weight_t param_zr[CONFIG_T::n_state * 3 * CONFIG_T::n_state],
+                           typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 3],
+                           typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 3]) {
+
+    res_T h_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    #pragma HLS ARRAY_PARTITION variable=h_state complete dim=2
+
+ResetState:
+    for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+        for (int ii = 0; ii < CONFIG_T::n_state; ii++) {
+            #pragma HLS UNROLL
+            h_state[i_seq][ii] = 0;
+        }
+    }
+
+SequenceLoop:
+    for (int iloop = 0; iloop < CONFIG_T::n_sequence; iloop++) {
+    InterleaveLoop:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            #pragma HLS DEPENDENCE variable=h_state inter distance=CONFIG_T::n_interleave true
+            data_T data_in[CONFIG_T::n_in];
+            res_T h_cur[CONFIG_T::n_state];
+            #pragma HLS ARRAY_PARTITION variable=data_in complete
+            #pragma HLS ARRAY_PARTITION variable=h_cur complete
+
+            for (int j = 0; j < CONFIG_T::n_in; j++) {
+                #pragma HLS UNROLL
+                data_in[j] = data[(i_seq * CONFIG_T::n_sequence + iloop) * CONFIG_T::n_in + j];
+            }
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_cur[j] = h_state[i_seq][j];
+            }
+
+            nnet::gru_cell<data_T, res_T, CONFIG_T>(data_in, h_cur, param, param_zr, param_b, param_br);
+
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_state[i_seq][j] = h_cur[j];
+                if (CONFIG_T::n_sequence_out > 1)
+                    res[(i_seq * CONFIG_T::n_sequence_out + iloop) * CONFIG_T::n_state + j] = h_cur[j];
+            }
+        }
+    }
+
+    if (CONFIG_T::n_sequence_out == 1)
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            for (int i = 0; i < CONFIG_T::n_state; i++) {
+                #pragma HLS UNROLL
+                res[i_seq * CONFIG_T::n_state + i] = h_state[i_seq][i];
+            }
+        }
+}
+
+template <class data_T, class res_T, typename CONFIG_T>
+void gru_stack_interleaved(hls::stream<data_T> &data_stream, hls::stream<res_T> &res_stream,
+                           typename CONFIG_T::weight_t param[CONFIG_T::n_state * 3 * CONFIG_T::n_in],
+                           typename CONFIG_T::weight_t param_zr[CONFIG_T::n_state * 3 * CONFIG_T::n_state],
+                           typename CONFIG_T::bias_t param_b[CONFIG_T::n_state * 3],
+                           typename CONFIG_T::bias_t param_br[CONFIG_T::n_state * 3]) {
+    assert(data_T::size == CONFIG_T::n_in && res_T::size == CONFIG_T::n_state);
+
+    typename res_T::value_type h_state[CONFIG_T::n_interleave][CONFIG_T::n_state];
+    #pragma HLS ARRAY_PARTITION variable=h_state complete dim=2
+
+ResetState:
+    for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+        for (int ii = 0; ii < CONFIG_T::n_state; ii++) {
+            #pragma HLS UNROLL
+            h_state[i_seq][ii] = 0;
+        }
+    }
+
+DataPropagation:
+    for (int iloop = 0; iloop < CONFIG_T::n_sequence; iloop++) {
+    InterleaveLoop:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE II=CONFIG_T::reuse_factor
+            #pragma HLS DEPENDENCE variable=h_state inter distance=CONFIG_T::n_interleave true
+            typename data_T::value_type data_in[CONFIG_T::n_in];
+            typename res_T::value_type h_cur[CONFIG_T::n_state];
+            #pragma HLS ARRAY_PARTITION variable=data_in complete
+            #pragma HLS ARRAY_PARTITION variable=h_cur complete
+
+            data_T data_pack = data_stream.read();
+        DataPack:
+            for (int i_pack = 0; i_pack < data_T::size; i_pack++) {
+                #pragma HLS UNROLL
+                data_in[i_pack] = data_pack[i_pack];
+            }
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_cur[j] = h_state[i_seq][j];
+            }
+
+            nnet::gru_cell<typename data_T::value_type, typename res_T::value_type, CONFIG_T>(data_in, h_cur, param,
+                                                                                              param_zr, param_b, param_br);
+
+            res_T res_pack;
+            PRAGMA_DATA_PACK(res_pack)
+        ResPack_sequences:
+            for (int j = 0; j < CONFIG_T::n_state; j++) {
+                #pragma HLS UNROLL
+                h_state[i_seq][j] = h_cur[j];
+                res_pack[j] = h_cur[j];
+            }
+            if (CONFIG_T::n_sequence_out > 1)
+                res_stream.write(res_pack);
+        }
+    }
+
+    if (CONFIG_T::n_sequence_out == 1) {
+    ResPack:
+        for (int i_seq = 0; i_seq < CONFIG_T::n_interleave; i_seq++) {
+            #pragma HLS PIPELINE
+            res_T res_pack;
+            PRAGMA_DATA_PACK(res_pack)
+            for (int i_pack = 0; i_pack < res_T::size; i_pack++) {
+                #pragma HLS UNROLL
+                res_pack[i_pack] = h_state[i_seq][i_pack];
+            }
+            res_stream.write(res_pack);
+        }
+    }
+}
+
 } // namespace nnet
 
 #endif
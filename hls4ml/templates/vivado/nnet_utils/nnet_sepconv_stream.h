@@ -141,7 +141,8 @@ void pointwise_mult_buffer(const data_T &data_pack, hls::stream<res_T> &res_stre
     typename data_T::value_type data[CONFIG_T::n_chan];
     #pragma HLS ARRAY_PARTITION variable=data complete
 
-    typename res_T::value_type res[CONFIG_T::n_filt];
+    typedef typename fused_activation::preact_type<typename CONFIG_T::preact_t, typename res_T::value_type>::type preact_T;
+    preact_T res[CONFIG_T::n_filt];
     #pragma HLS ARRAY_PARTITION variable=res complete
 
     res_T res_pack;
@@ -155,17 +156,15 @@ InitData:
 
     #pragma HLS INLINE recursive
     if (CONFIG_T::strategy == nnet::latency) {
-        dense_latency<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
-            data, res, weights, biases);
+        dense_latency<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(data, res, weights, biases);
     } else {
-        dense_resource<typename data_T::value_type, typename res_T::value_type, typename CONFIG_T::mult_config>(
-            data, res, weights, biases);
+        dense_resource<typename data_T::value_type, preact_T, typename CONFIG_T::mult_config>(data, res, weights, biases);
     }
 
 CastLoop:
     for (unsigned jj = 0; jj < CONFIG_T::n_filt; jj++) {
         #pragma HLS UNROLL
-        res_pack[jj] = res[jj];
+        res_pack[jj] = CONFIG_T::template activation<preact_T, typename res_T::value_type>::activation(res[jj]);
     }
 
     res_stream.write(res_pack);
@@ -16,55 +16,37 @@ struct broadcast_config {
     static const unsigned out_chan = 3;
 };
 
-template <class data_T, class res_T, int N>
-void clone_stream(hls::stream<data_T> &data, hls::stream<res_T> &res1, hls::stream<res_T> &res2) {
-CloneLoop:
-    for (int i = 0; i < N / data_T::size; i++) {
-        #pragma HLS PIPELINE
-
-        data_T in_data = data.read();
-        res_T out_data1;
-        res_T out_data2;
-        PRAGMA_DATA_PACK(out_data1)
-        PRAGMA_DATA_PACK(out_data2)
+// Writes a copy of the input pack to every output stream
+template <class data_T, class res_T> void clone_pack(const data_T &in_data, hls::stream<res_T> &res) {
+    #pragma HLS INLINE
+    res_T out_data;
+    PRAGMA_DATA_PACK(out_data)
+
+ClonePack:
+    for (int j = 0; j < data_T::size; j++) {
+        #pragma HLS UNROLL
+        out_data[j] = in_data[j];
+    }
 
-    ClonePack:
-        for (int j = 0; j < data_T::size; j++) {
-            #pragma HLS UNROLL
-            out_data1[j] = in_data[j];
-            out_data2[j] = in_data[j];
-        }
+    res.write(out_data);
+}
 
-        res1.write(out_data1);
-        res2.write(out_data2);
-    }
+template <class data_T, class res_T, class... res_Ts>
+void clone_pack(const data_T &in_data, hls::stream<res_T> &res, hls::stream<res_Ts> &...rest) {
+    #pragma HLS INLINE
+    clone_pack<data_T, res_T>(in_data, res);
+    clone_pack<data_T>(in_data, rest...);
 }
 
-template <class data_T, class res_T, int N>
-void clone_stream(hls::stream<data_T> &data, hls::stream<res_T> &res1, hls::stream<res_T> &res2, hls::stream<res_T> &res3) {
+// Copies the input stream to any number of output streams, all outputs are written in the same pipelined loop
+template <class data_T, class res_T, int N, class... res_Ts>
+void clone_stream(hls::stream<data_T> &data, hls::stream<res_T> &res1, hls::stream<res_Ts> &...res) {
 CloneLoop:
     for (int i = 0; i < N / data_T::size; i++) {
         #pragma HLS PIPELINE
 
         data_T in_data = data.read();
-        res_T out_data1;
-        res_T out_data2;
-        res_T out_data3;
-        PRAGMA_DATA_PACK(out_data1)
-        PRAGMA_DATA_PACK(out_data2)
-        PRAGMA_DATA_PACK(out_data3)
-
-    ClonePack:
-        for (int j = 0; j < data_T::size; j++) {
-            #pragma HLS UNROLL
-            out_data1[j] = in_data[j];
-            out_data2[j] = in_data[j];
-            out_data3[j] = in_data[j];
-        }
-
-        res1.write(out_data1);
-        res2.write(out_data2);
-        res3.write(out_data3);
+        clone_pack<data_T>(in_data, res1, res...);
     }
 }
 
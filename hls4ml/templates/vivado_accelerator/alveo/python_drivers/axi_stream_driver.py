@@ -1,6 +1,7 @@
 from datetime import datetime
 
 import numpy as np
+from buffered_driver import AlveoKernelDevice, BufferedPredictor, FixedPointCodec
 from pynq import Overlay, allocate
 
 
@@ -89,6 +90,31 @@ class NeuralNetworkOverlay(Overlay):
         self.output_buffer.flush()
         return result
 
+    def buffered_predictor(
+        self, x_shape, y_shape, chunk_size, input_precision=None, output_precision=None, trg_in=None, trg_out=None
+    ):
+        """Create a double-buffered predictor, which allocates its buffers once and overlaps the transfers and the
+        encoding of the next chunk of samples with the kernel call on the current one.
+
+        Args:
+            x_shape (tuple): Shape of one input sample.
+            y_shape (tuple): Shape of one output sample.
+            chunk_size (int): Number of samples per kernel call.
+            input_precision (str, optional): The `ap_fixed`/`ap_int` precision of the accelerator input, e.g.
+                'ap_fixed<16,6>', for vectorised encoding. Defaults to None, for 'float'.
+            output_precision (str, optional): The precision of the accelerator output, for vectorised decoding.
+                Defaults to None, for 'float'.
+            trg_in (optional): Input buffers target memory. Defaults to None.
+            trg_out (optional): Output buffers target memory. Defaults to None.
+
+        Returns:
+            BufferedPredictor: Use its ``predict(X, profile=True)`` to report the sustained inferences / s.
+        """
+        in_codec = FixedPointCodec.from_precision(input_precision) if input_precision is not None else None
+        out_codec = FixedPointCodec.from_precision(output_precision) if output_precision is not None else None
+        device = AlveoKernelDevice(self.krnl_rtl_1, trg_in, trg_out)
+        return BufferedPredictor(device, x_shape, y_shape, chunk_size, in_codec, out_codec)
+
     def free_overlay(self):
         self.free()
 
@@ -0,0 +1,286 @@
+import re
+import threading
+import time
+
+import numpy as np
+
+
+class FixedPointCodec:
+    """Vectorised conversion between floating-point values and the raw integers of an ``ap_fixed``/``ap_int`` type.
+
+    The conversion follows the rounding (``RND`` or truncation) and saturation (``SAT`` or wrapping) of the type, the
+    width must be 8, 16, 32 or 64 bits, as is the case for the accelerator input and output types.
+
+    Args:
+        width (int): Total number of bits.
+        integer (int): Number of integer bits, including the sign bit.
+        signed (bool, optional): Whether the type is signed. Defaults to True.
+        rounding (bool, optional): Round to the nearest value instead of truncating. Defaults to False.
+        saturation (bool, optional): Saturate instead of wrapping. Defaults to False.
+    """
+
+    def __init__(self, width, integer, signed=True, rounding=False, saturation=False):
+        if width not in [8, 16, 32, 64]:
+            raise Exception(f'Unsupported width {width}, must be 8, 16, 32 or 64 bits')
+        self.width = width
+        self.integer = integer
+        self.signed = signed
+        self.rounding = rounding
+        self.saturation = saturation
+        self.dtype = np.dtype(f'{"int" if signed else "uint"}{width}')
+        self.scale = 2.0 ** (width - integer)
+        info = np.iinfo(self.dtype)
+        self.min, self.max = info.min, info.max
+
+    @classmethod
+    def from_precision(cls, precision):
+        """Creates the codec of a precision string like ``'ap_fixed<16,6>'``, ``'ap_ufixed<8,0,AP_RND,AP_SAT>'`` or
+        ``'ap_int<16>'``."""
+        match = re.fullmatch(r'\s*ap_(u?)(fixed|int)<\s*(\d+)\s*(?:,\s*(-?\d+))?(.*)>\s*', precision)
+        if match is None:
+            raise Exception(f'Cannot parse precision {precision}')
+        unsigned, kind, width, integer, modes = match.groups()
+        width = int(width)
+        integer = width if kind == 'int' or integer is None else int(integer)
+        modes = [m.strip() for m in modes.split(',') if m.strip() != '']
+        rounding = len(modes) > 0 and modes[0] in ['AP_RND', 'AP_RND_CONV', 'AP_RND_INF', 'AP_RND_MIN_INF', 'AP_RND_ZERO']
+        saturation = len(modes) > 1 and modes[1] in ['AP_SAT', 'AP_SAT_ZERO', 'AP_SAT_SYM']
+        return cls(width, integer, signed=unsigned == '', rounding=rounding, saturation=saturation)
+
+    def encode(self, x, out, scratch):
+        """Converts ``x`` into ``out`` (of ``self.dtype``), using ``scratch`` (float64, same shape) for intermediates."""
+        np.multiply(x, self.scale, out=scratch)
+        if self.rounding:
+            scratch += 0.5
+        np.floor(scratch, out=scratch)
+        if self.saturation:
+            np.clip(scratch, self.min, self.max, out=scratch)
+            np.copyto(out, scratch, casting='unsafe')
+        else:
+            # Wrap around modulo 2**width, like the conversion to the type
+            offset = -float(self.min)
+            scratch += offset
+            np.remainder(scratch, 2.0**self.width, out=scratch)
+            scratch -= offset
+            np.copyto(out, scratch, casting='unsafe')
+
+    def decode(self, y, out):
+        """Converts the raw integers ``y`` into ``out`` (floating-point)."""
+        np.multiply(y, 1.0 / self.scale, out=out)
+
+
+class BufferedPredictor:
+    """Double-buffered predictions with the accelerator, on chunks of ``chunk_size`` samples.
+
+    The buffers are allocated once. While the accelerator processes one chunk, the next chunk is encoded and transferred
+    into the other input buffer, and the previous output is transferred back and decoded. The data movement is done by a
+    device (``ZynqDmaDevice``, ``AlveoKernelDevice`` or ``MockDevice``) with the methods:
+
+    - ``allocate(shape, dtype, output)``: a buffer shared with the accelerator, for its input or output
+    - ``sync_to_device(buffer)``: makes the host writes visible to the accelerator
+    - ``start(in_buffer, out_buffer, in_size, out_size)``: starts the accelerator on the first ``in_size`` input values
+      and returns a handle with a ``wait()`` method
+    - ``sync_from_device(buffer)``: makes the accelerator writes visible to the host
+
+    Args:
+        device: The device that moves the data.
+        x_shape (tuple): Shape of one input sample.
+        y_shape (tuple): Shape of one output sample.
+        chunk_size (int): Number of samples per accelerator call.
+        in_codec (FixedPointCodec, optional): Encoding of the inputs, ``None`` for floating-point inputs.
+            Defaults to None.
+        out_codec (FixedPointCodec, optional): Decoding of the outputs, ``None`` for floating-point outputs.
+            Defaults to None.
+        dtype (dtype, optional): The data type of floating-point inputs and outputs. Defaults to np.float32.
+        n_buffers (int, optional): Number of input and output buffers. Defaults to 2.
+    """
+
+    def __init__(self, device, x_shape, y_shape, chunk_size, in_codec=None, out_codec=None, dtype=np.float32, n_buffers=2):
+        self.device = device
+        self.x_shape = tuple(x_shape)
+        self.y_shape = tuple(y_shape)
+        self.chunk_size = chunk_size
+        self.in_codec = in_codec
+        self.out_codec = out_codec
+        self.dtype = np.dtype(dtype)
+        self.in_size = int(np.prod(self.x_shape))
+        self.out_size = int(np.prod(self.y_shape))
+
+        in_dtype = in_codec.dtype if in_codec is not None else self.dtype
+        out_dtype = out_codec.dtype if out_codec is not None else self.dtype
+        self.in_buffers = [device.allocate((chunk_size,) + self.x_shape, in_dtype, False) for _ in range(n_buffers)]
+        self.out_buffers = [device.allocate((chunk_size,) + self.y_shape, out_dtype, True) for _ in range(n_buffers)]
+        self.scratch = np.empty((chunk_size,) + self.x_shape, dtype=np.float64)
+        self.sustained_rate = None
+
+    def _prepare(self, X, i):
+        buffer = self.in_buffers[i % len(self.in_buffers)]
+        begin = i * self.chunk_size
+        n = min(self.chunk_size, len(X) - begin)
+        if self.in_codec is not None:
+            self.in_codec.encode(X[begin : begin + n], buffer[:n], self.scratch[:n])
+        else:
+            np.copyto(buffer[:n], X[begin : begin + n], casting='unsafe')
+        self.device.sync_to_device(buffer)
+        return n
+
+    def _start(self, i, n):
+        k = i % len(self.in_buffers)
+        return self.device.start(self.in_buffers[k], self.out_buffers[k], n * self.in_size, n * self.out_size)
+
+    def _finish(self, y, i, n):
+        buffer = self.out_buffers[i % len(self.out_buffers)]
+        self.device.sync_from_device(buffer)
+        begin = i * self.chunk_size
+        if self.out_codec is not None:
+            self.out_codec.decode(buffer[:n], y[begin : begin + n])
+        else:
+            np.copyto(y[begin : begin + n], buffer[:n])
+
+    def predict(self, X, out=None, profile=False):
+        """Obtain the predictions of the accelerator for all samples of ``X``.
+
+        Args:
+            X (ndarray): The input samples, of shape ``(N,) + x_shape``.
+            out (ndarray, optional): The array the predictions are written to, of shape ``(N,) + y_shape``. If None, a
+                new array is allocated. Defaults to None.
+            profile (bool, optional): Print the sustained throughput and return it with the predictions.
+                Defaults to False.
+
+        Returns:
+            ndarray: The predictions, or ``(predictions, seconds, inferences per second)`` if ``profile`` is set.
+        """
+        if out is None:
+            out = np.empty((len(X),) + self.y_shape, dtype=self.dtype)
+        n_chunks = (len(X) + self.chunk_size - 1) // self.chunk_size
+
+        timea = time.perf_counter()
+        if n_chunks > 0:
+            n = self._prepare(X, 0)
+            handle = self._start(0, n)
+            for i in range(n_chunks):
+                # The next chunk is prepared while the accelerator processes this one
+                if i + 1 < n_chunks:
+                    n_next = self._prepare(X, i + 1)
+                handle.wait()
+                if i + 1 < n_chunks:
+                    next_handle = self._start(i + 1, n_next)
+                self._finish(out, i, n)
+                if i + 1 < n_chunks:
+                    handle, n = next_handle, n_next
+        dts = time.perf_counter() - timea
+
+        self.sustained_rate = len(X) / dts if dts > 0 else float('inf')
+        if profile:
+            print(f"Classified {len(X)} samples in {dts} seconds ({self.sustained_rate} inferences / s)")
+            return out, dts, self.sustained_rate
+        return out
+
+
+class ZynqDmaDevice:
+    """Transfers with the AXI DMA of a Zynq overlay, the ``hier_0.axi_dma_0`` of the ``NeuralNetworkOverlay``."""
+
+    class _Handle:
+        def __init__(self, dma):
+            self.dma = dma
+
+        def wait(self):
+            self.dma.sendchannel.wait()
+            self.dma.recvchannel.wait()
+
+    def __init__(self, dma):
+        self.dma = dma
+
+    def allocate(self, shape, dtype, output):
+        from pynq import allocate
+
+        return allocate(shape=shape, dtype=dtype)
+
+    def sync_to_device(self, buffer):
+        buffer.flush()
+
+    def start(self, in_buffer, out_buffer, in_size, out_size):
+        self.dma.recvchannel.transfer(out_buffer, nbytes=out_size * out_buffer.itemsize)
+        self.dma.sendchannel.transfer(in_buffer, nbytes=in_size * in_buffer.itemsize)
+        return self._Handle(self.dma)
+
+    def sync_from_device(self, buffer):
+        buffer.invalidate()
+
+
+class AlveoKernelDevice:
+    """Calls of the ``krnl_rtl_1`` kernel of an Alveo overlay, with buffers in the given memory banks."""
+
+    def __init__(self, kernel, trg_in=None, trg_out=None):
+        self.kernel = kernel
+        self.trg_in = trg_in
+        self.trg_out = trg_out
+
+    def allocate(self, shape, dtype, output):
+        from pynq import allocate
+
+        return allocate(shape=shape, dtype=dtype, target=self.trg_out if output else self.trg_in)
+
+    def sync_to_device(self, buffer):
+        buffer.sync_to_device()
+
+    def start(self, in_buffer, out_buffer, in_size, out_size):
+        return self.kernel.start(in_buffer, out_buffer, in_size, out_size)
+
+    def sync_from_device(self, buffer):
+        buffer.sync_from_device()
+
+
+class MockDevice:
+    """A device without an accelerator, for testing on any machine. The accelerator is emulated by ``func``, applied in
+    a background thread to the flat input values of each call (after an optional ``latency`` in seconds), which must
+    return the flat output values. The operations are recorded in ``events`` as ``(name, buffer index)``."""
+
+    class _Handle:
+        def __init__(self, device, thread, index):
+            self.device = device
+            self.thread = thread
+            self.index = index
+
+        def wait(self):
+            self.thread.join()
+            self.device._record('wait', self.index)
+
+    def __init__(self, func, latency=0.0):
+        self.func = func
+        self.latency = latency
+        self.buffers = []
+        self.events = []
+        self.lock = threading.Lock()
+
+    def _record(self, name, index):
+        with self.lock:
+            self.events.append((name, index))
+
+    def _index(self, buffer):
+        base = buffer if buffer.base is None else buffer.base
+        return next(i for i, b in enumerate(self.buffers) if b is base)
+
+    def allocate(self, shape, dtype, output):
+        self.buffers.append(np.zeros(shape, dtype=dtype))
+        return self.buffers[-1]
+
+    def sync_to_device(self, buffer):
+        self._record('sync_to_device', self._index(buffer))
+
+    def start(self, in_buffer, out_buffer, in_size, out_size):
+        index = self._index(in_buffer)
+
+        def run():
+            if self.latency > 0:
+                time.sleep(self.latency)
+            out_buffer.reshape(-1)[:out_size] = self.func(in_buffer.reshape(-1)[:in_size])
+            self._record('done', index)
+
+        self._record('start', index)
+        thread = threading.Thread(target=run)
+        thread.start()
+        return self._Handle(self, thread, index)
+
+    def sync_from_device(self, buffer):
+        self._record('sync_from_device', self._index(buffer))
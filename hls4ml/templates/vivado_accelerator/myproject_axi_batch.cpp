@@ -0,0 +1,21 @@
+// hls-fpga-machine-learning insert include
+
+void compute_samples(hls::stream<batch_input_t> &in_local, hls::stream<batch_result_t> &out_local, unsigned n_samples) {
+ComputeSample:
+    for (unsigned s = 0; s < n_samples; s++) {
+        // hls-fpga-machine-learning insert call
+    }
+}
+
+// hls-fpga-machine-learning insert top
+{
+    // hls-fpga-machine-learning insert interface
+
+    #pragma HLS DATAFLOW
+
+    // hls-fpga-machine-learning insert local vars
+
+    read_samples(in, in_local, n_samples);
+    compute_samples(in_local, out_local, n_samples);
+    write_samples(out_local, out, n_samples);
+}
@@ -0,0 +1,112 @@
+#ifndef MYPROJECT_AXI_H_
+#define MYPROJECT_AXI_H_
+
+#include "hls_stream.h"
+#include <iostream>
+// hls-fpga-machine-learning insert include
+
+// Batched wrapper: a call processes n_samples samples, streamed back-to-back through myproject.
+//
+// Packing of the words: every word holds IN_PACK (OUT_PACK) values of input_axi_t (output_axi_t). Value i of a sample
+// is stored in word i / IN_PACK of the sample, in bits [k * IN_WIDTH, (k + 1) * IN_WIDTH) with k = i % IN_PACK, as the
+// raw bits of the fixed-point value. Every sample starts on a new word and takes IN_WORDS (OUT_WORDS) words, the unused
+// bits of the last word of a sample are zero. Sample s therefore starts at word s * IN_WORDS (s * OUT_WORDS).
+
+// hls-fpga-machine-learning insert definitions
+
+typedef struct axi_word {
+    word_t data;
+    ap_uint<1> last;
+} axi_word_t;
+
+template <class data_T, unsigned PACK> void unpack_word(const word_t &word, data_T values[PACK]) {
+    for (unsigned k = 0; k < PACK; k++) {
+        #pragma HLS UNROLL
+        values[k].range(data_T::width - 1, 0) = word.range((k + 1) * data_T::width - 1, k * data_T::width);
+    }
+}
+
+template <class data_T, unsigned PACK> word_t pack_word(const data_T values[PACK]) {
+    word_t word = 0;
+    for (unsigned k = 0; k < PACK; k++) {
+        #pragma HLS UNROLL
+        word.range((k + 1) * data_T::width - 1, k * data_T::width) = values[k].range(data_T::width - 1, 0);
+    }
+    return word;
+}
+
+inline word_t read_word(hls::stream<axi_word_t> &in, unsigned index) { return in.read().data; }
+
+inline word_t read_word(const word_t *in, unsigned index) { return in[index]; }
+
+inline void write_word(hls::stream<axi_word_t> &out, unsigned index, const word_t &word, bool last) {
+    axi_word_t beat;
+    beat.data = word;
+    beat.last = last;
+    out.write(beat);
+}
+
+inline void write_word(word_t *out, unsigned index, const word_t &word, bool last) { out[index] = word; }
+
+// Unpacks the words of the samples into the arrays of res_T (nnet::array) read by the network
+template <class in_T, class res_T> void read_samples(in_T &in, hls::stream<res_T> &res, unsigned n_samples) {
+    unsigned index = 0;
+ReadSample:
+    for (unsigned s = 0; s < n_samples; s++) {
+        input_axi_t values[IN_PACK];
+        #pragma HLS ARRAY_PARTITION variable=values complete
+        unsigned k = 0;
+    ReadArray:
+        for (unsigned i = 0; i < N_IN / res_T::size; i++) {
+            #pragma HLS PIPELINE
+            res_T ctype;
+        ReadValue:
+            for (unsigned j = 0; j < res_T::size; j++) {
+                if (k == 0) {
+                    unpack_word<input_axi_t, IN_PACK>(read_word(in, index++), values);
+                }
+                ctype[j] = typename res_T::value_type(values[k]);
+                k = (k == IN_PACK - 1) ? 0 : k + 1;
+            }
+            res.write(ctype);
+        }
+    }
+}
+
+// Packs the arrays of data_T (nnet::array) written by the network into the words of the samples
+template <class data_T, class out_T> void write_samples(hls::stream<data_T> &data, out_T &out, unsigned n_samples) {
+    unsigned index = 0;
+WriteSample:
+    for (unsigned s = 0; s < n_samples; s++) {
+        output_axi_t values[OUT_PACK];
+        #pragma HLS ARRAY_PARTITION variable=values complete
+        unsigned k = 0;
+    WriteArray:
+        for (unsigned i = 0; i < N_OUT / data_T::size; i++) {
+            #pragma HLS PIPELINE
+            data_T ctype = data.read();
+        WriteValue:
+            for (unsigned j = 0; j < data_T::size; j++) {
+                values[k] = output_axi_t(ctype[j]);
+                bool end_of_sample = (i * data_T::size + j == N_OUT - 1);
+                if (k == OUT_PACK - 1 || end_of_sample) {
+                    for (unsigned z = 0; z < OUT_PACK; z++) {
+                        #pragma HLS UNROLL
+                        if (z > k) {
+                            values[z] = 0;
+                        }
+                    }
+                    bool last = end_of_sample && (s == n_samples - 1);
+                    write_word(out, index++, pack_word<output_axi_t, OUT_PACK>(values), last);
+                    k = 0;
+                } else {
+                    k++;
+                }
+            }
+        }
+    }
+}
+
+// hls-fpga-machine-learning insert prototype
+
+#endif
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "firmware/myproject_axi.h"
+#include "firmware/nnet_utils/nnet_helpers.h"
+
+namespace nnet {
+bool trace_enabled = true;
+std::map<std::string, void *> *trace_outputs = NULL;
+size_t trace_type_size = sizeof(double);
+} // namespace nnet
+
+// Reads the samples of a tb_data file, one sample per line
+std::vector<std::vector<float>> read_samples_file(const std::string &file_name) {
+    std::vector<std::vector<float>> samples;
+    std::ifstream fin(file_name.c_str());
+    std::string line;
+    while (std::getline(fin, line)) {
+        std::istringstream iss(line);
+        std::vector<float> sample;
+        float value;
+        while (iss >> value) {
+            sample.push_back(value);
+        }
+        if (!sample.empty()) {
+            samples.push_back(sample);
+        }
+    }
+    return samples;
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::vector<float>> inputs = read_samples_file("tb_data/tb_input_features.dat");
+    std::vector<std::vector<float>> predictions = read_samples_file("tb_data/tb_output_predictions.dat");
+
+#ifdef RTL_SIM
+    std::string RESULTS_LOG = "tb_data/rtl_cosim_results.log";
+#else
+    std::string RESULTS_LOG = "tb_data/csim_results.log";
+#endif
+    std::ofstream fout(RESULTS_LOG);
+
+    if (inputs.empty()) {
+        std::cout << "INFO: Unable to open input file, using default input." << std::endl;
+        inputs.push_back(std::vector<float>(N_IN, 0.));
+    }
+    const unsigned n_samples = inputs.size();
+
+    // Pack all samples into the input words
+    std::vector<word_t> in_words(n_samples * IN_WORDS);
+    std::vector<word_t> out_words(n_samples * OUT_WORDS);
+    for (unsigned s = 0; s < n_samples; s++) {
+        for (unsigned w = 0; w < IN_WORDS; w++) {
+            input_axi_t values[IN_PACK];
+            for (unsigned k = 0; k < IN_PACK; k++) {
+                unsigned i = w * IN_PACK + k;
+                values[k] = (i < N_IN) ? input_axi_t(inputs[s][i]) : input_axi_t(0);
+            }
+            in_words[s * IN_WORDS + w] = pack_word<input_axi_t, IN_PACK>(values);
+        }
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    // hls-fpga-machine-learning insert top-level-function
+    auto stop = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(stop - start).count();
+    std::cout << "INFO: Processed " << n_samples << " samples in " << seconds << " s (" << n_samples / seconds
+              << " samples/s)" << std::endl;
+
+    // Unpack the output words and compare with the predictions
+    double max_diff = 0;
+    for (unsigned s = 0; s < n_samples; s++) {
+        for (unsigned w = 0; w < OUT_WORDS; w++) {
+            output_axi_t values[OUT_PACK];
+            unpack_word<output_axi_t, OUT_PACK>(out_words[s * OUT_WORDS + w], values);
+            for (unsigned k = 0; k < OUT_PACK && w * OUT_PACK + k < N_OUT; k++) {
+                unsigned i = w * OUT_PACK + k;
+                fout << values[k] << " ";
+                if (s < predictions.size() && i < predictions[s].size()) {
+                    max_diff = std::max(max_diff, std::fabs(values[k].to_double() - predictions[s][i]));
+                }
+            }
+        }
+        fout << std::endl;
+    }
+    if (!predictions.empty()) {
+        std::cout << "INFO: Largest difference to the predictions: " << max_diff << std::endl;
+    }
+
+    fout.close();
+    std::cout << "INFO: Saved inference results to file: " << RESULTS_LOG << std::endl;
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 from datetime import datetime
 
 import numpy as np
+from buffered_driver import BufferedPredictor, FixedPointCodec, ZynqDmaDevice
 from pynq import Overlay, allocate
 
 
@@ -21,6 +22,21 @@ class NeuralNetworkOverlay(Overlay):
         print(f"Classified {N} samples in {dts} seconds ({rate} inferences / s)")
         return dts, rate
 
+    def buffered_predictor(self, x_shape, y_shape, chunk_size, input_precision=None, output_precision=None):
+        """
+        Create a double-buffered predictor, which allocates its buffers once and overlaps the transfers and the
+        encoding of the next chunk of samples with the processing of the current one.
+        Parameters:
+        - x_shape, y_shape : the shapes of one input and output sample.
+        - chunk_size : the number of samples per DMA transfer.
+        - input_precision, output_precision : the `ap_fixed`/`ap_int` precision of the accelerator input and output,
+          e.g. 'ap_fixed<16,6>', for vectorised encoding/decoding. `None` for 'float'.
+        - return: a `BufferedPredictor`, use its `predict(X, profile=True)` to report the sustained inferences / s.
+        """
+        in_codec = FixedPointCodec.from_precision(input_precision) if input_precision is not None else None
+        out_codec = FixedPointCodec.from_precision(output_precision) if output_precision is not None else None
+        return BufferedPredictor(ZynqDmaDevice(self.hier_0.axi_dma_0), x_shape, y_shape, chunk_size, in_codec, out_codec)
+
     def predict(self, X, debug=False, profile=False, encode=None, decode=None):
         """
         Obtain the predictions of the NN implemented in the FPGA.
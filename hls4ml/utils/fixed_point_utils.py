@@ -1,6 +1,8 @@
 import math
 import sys
 
+from hls4ml.model.types import FixedPrecisionType, IntegerPrecisionType
+
 '''
 A helper class for handling fixed point methods
 Currently, very limited, allowing only:
@@ -136,3 +138,21 @@ def uint_to_binary(i, N):
 
 def ceil_log2(i):
     return i.bit_length() - 1
+
+
+'''
+    Returns the name of the smallest standard integer type holding the raw bits of the precision
+    Args:
+        - precision : FixedPrecisionType or IntegerPrecisionType
+    Returns:
+        - val : e.g., 'int8' or 'uint16', or None if the precision can't be represented with up to 64 bits
+'''
+
+
+def raw_int_type(precision):
+    if not isinstance(precision, (FixedPrecisionType, IntegerPrecisionType)):
+        return None
+    for bits in [8, 16, 32, 64]:
+        if precision.width <= bits:
+            return ('' if precision.signed else 'u') + f'int{bits}'
+    return None
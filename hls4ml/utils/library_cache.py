@@ -0,0 +1,183 @@
+import hashlib
+import os
+import platform
+import shutil
+import subprocess
+import tempfile
+from functools import lru_cache
+
+default_cache_dir = os.path.join(os.environ.get('XDG_CACHE_HOME', os.path.join('~', '.cache')), 'hls4ml')
+default_max_size = 2048  # MB
+default_max_entries = 1000
+
+
+def _env_flag(name, default=False):
+    value = os.environ.get(name)
+    if value is None:
+        return default
+    return value.strip().lower() in ['1', 'true', 'yes', 'on']
+
+
+@lru_cache(maxsize=None)
+def _compiler_version(compiler):
+    try:
+        return subprocess.run([compiler, '--version'], capture_output=True, check=True).stdout
+    except Exception:
+        return b'unknown'
+
+
+class LibraryCache:
+    """Persistent, content-addressed cache of the compiled emulation libraries.
+
+    Libraries are stored under a key computed from the generated sources (including weights), the build script
+    (compiler and flags) and the version of the compiler. Projects that generate identical code will therefore reuse the
+    same library instead of invoking the compiler again, including across sessions. The cache is bounded both in total
+    size and in the number of stored libraries, least recently used entries are evicted first.
+
+    The default settings can be changed with the following environment variables:
+
+    - ``HLS4ML_LIBRARY_CACHE``: Enable the cache for all projects (``1``) unless disabled in the config.
+    - ``HLS4ML_LIBRARY_CACHE_DIR``: Location of the cache (default ``~/.cache/hls4ml``).
+    - ``HLS4ML_LIBRARY_CACHE_SIZE``: Maximum size of the cache in MB (default 2048).
+    - ``HLS4ML_LIBRARY_CACHE_ENTRIES``: Maximum number of cached libraries (default 1000).
+
+    Args:
+        cache_dir (str, optional): Location of the cache. Defaults to None (use the environment or the default location).
+        max_size (int, optional): Maximum size of the cache in MB. Defaults to None.
+        max_entries (int, optional): Maximum number of cached libraries. Defaults to None.
+    """
+
+    def __init__(self, cache_dir=None, max_size=None, max_entries=None):
+        if cache_dir is None:
+            cache_dir = os.environ.get('HLS4ML_LIBRARY_CACHE_DIR', default_cache_dir)
+        if max_size is None:
+            max_size = float(os.environ.get('HLS4ML_LIBRARY_CACHE_SIZE', default_max_size))
+        if max_entries is None:
+            max_entries = int(os.environ.get('HLS4ML_LIBRARY_CACHE_ENTRIES', default_max_entries))
+
+        self.cache_dir = os.path.abspath(os.path.expanduser(cache_dir))
+        self.max_size = int(max_size * 1024 * 1024)
+        self.max_entries = max_entries
+
+    @staticmethod
+    def is_enabled(model):
+        """Checks if the cache should be used for the given model.
+
+        The ``LibraryCache`` key of the configuration takes precedence over the ``HLS4ML_LIBRARY_CACHE`` variable.
+        """
+        enabled = model.config.get_config_value('LibraryCache')
+        if enabled is None:
+            return _env_flag('HLS4ML_LIBRARY_CACHE')
+        return bool(enabled)
+
+    def compute_key(self, model):
+        """Computes the key of the library that would be built from the project written in the output directory.
+
+        Args:
+            model (ModelGraph): The model whose project has already been written.
+
+        Returns:
+            str: Hex digest of the project's sources and build settings.
+        """
+        output_dir = model.config.get_output_dir()
+        project_name = model.config.get_project_name()
+        stamp = model.config.get_config_value('Stamp').encode()
+
+        sources = [os.path.join(output_dir, 'build_lib.sh'), os.path.join(output_dir, f'{project_name}_bridge.cpp')]
+        for root, dirs, files in os.walk(os.path.join(output_dir, 'firmware')):
+            dirs.sort()
+            for name in sorted(files):
+                if not name.endswith('.so'):
+                    sources.append(os.path.join(root, name))
+
+        compiler = 'g++'
+        with open(sources[0]) as f:
+            for line in f:
+                if line.startswith('CC='):
+                    compiler = line.strip()[3:]
+                    break
+
+        sha = hashlib.sha256()
+        sha.update(platform.system().encode() + platform.machine().encode())
+        sha.update(_compiler_version(compiler))
+        for path in sources:
+            if not os.path.exists(path):
+                continue
+            with open(path, 'rb') as f:
+                # The stamp only makes the library name unique and is not relevant for the content
+                content = f.read().replace(stamp, b'mystamp')
+            sha.update(os.path.relpath(path, output_dir).encode())
+            sha.update(len(content).to_bytes(8, 'little'))
+            sha.update(content)
+
+        return sha.hexdigest()
+
+    def _entry_path(self, key):
+        return os.path.join(self.cache_dir, key + '.so')
+
+    def fetch(self, key, lib_name):
+        """Copies the cached library to ``lib_name`` if it exists in the cache.
+
+        Returns:
+            bool: True if the library was found in the cache.
+        """
+        entry = self._entry_path(key)
+        try:
+            shutil.copyfile(entry, lib_name)
+        except OSError:
+            return False
+        os.utime(entry)  # Mark as recently used
+        return True
+
+    def store(self, key, lib_name):
+        """Adds the compiled library to the cache and evicts the least recently used entries if over the limits."""
+        os.makedirs(self.cache_dir, exist_ok=True)
+        fd, tmp_path = tempfile.mkstemp(dir=self.cache_dir, suffix='.tmp')
+        os.close(fd)
+        try:
+            shutil.copyfile(lib_name, tmp_path)
+            # Atomic, so concurrent processes never load a partially written library
+            os.replace(tmp_path, self._entry_path(key))
+        except OSError:
+            if os.path.exists(tmp_path):
+                os.remove(tmp_path)
+            raise
+        self.evict()
+
+    def entries(self):
+        """Returns the list of cached libraries as (path, size, last use time), most recently used first."""
+        if not os.path.isdir(self.cache_dir):
+            return []
+        entries = []
+        for name in os.listdir(self.cache_dir):
+            if not name.endswith('.so'):
+                continue
+            path = os.path.join(self.cache_dir, name)
+            try:
+                stat = os.stat(path)
+            except OSError:
+                continue
+            entries.append((path, stat.st_size, stat.st_mtime))
+        return sorted(entries, key=lambda e: e[2], reverse=True)
+
+    def evict(self):
+        """Removes the least recently used libraries until the cache fits the size and entry limits."""
+        n_kept = 0
+        total_size = 0
+        for path, size, _ in self.entries():
+            if n_kept < self.max_entries and total_size + size <= self.max_size:
+                n_kept += 1
+                total_size += size
+                continue
+            try:
+                os.remove(path)
+            except OSError:
+                pass
+
+    def clear(self):
+        """Removes all cached libraries."""
+        for path, _, _ in self.entries():
+            try:
+                os.remove(path)
+            except OSError:
+                pass
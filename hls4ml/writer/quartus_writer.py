@@ -8,8 +8,9 @@ import numpy as np
 import yaml
 
 from hls4ml.backends import get_backend
-from hls4ml.model.layers import Conv1D, Conv2D, Conv2DBatchnorm, Dense
-from hls4ml.utils.fixed_point_utils import FixedPointEmulator, ceil_log2, uint_to_binary
+from hls4ml.backends.quartus.passes.core_templates import layernorm_table_name
+from hls4ml.model.layers import Conv1D, Conv2D, Conv2DBatchnorm, Dense, LayerNormalization
+from hls4ml.utils.fixed_point_utils import FixedPointEmulator, ceil_log2, raw_int_type, uint_to_binary
 from hls4ml.writer.writers import Writer
 
 config_filename = 'hls4ml_config.yml'
@@ -250,6 +251,7 @@ class QuartusWriter(Writer):
                 newline = line + '\n'
                 model_inputs = model.get_input_variables()
                 model_outputs = model.get_output_variables()
+                n_profiled = 0
                 for layer in model.get_layers():
                     if io_type != 'io_stream':
                         vars = layer.get_variables()
@@ -260,7 +262,16 @@ class QuartusWriter(Writer):
                                     newline += '    ' + def_cpp + ';\n'
                     func = layer.get_attr('function_cpp', None)
                     if func:
+                        if model.config.layer_profiling:
+                            newline += '#ifndef HLS_SYNTHESIS\n'
+                            newline += f'    unsigned long long {layer.name}_start = nnet::profile_timestamp();\n'
+                            newline += '#endif\n'
                         newline += '    ' + func + '\n'
+                        if model.config.layer_profiling:
+                            newline += '#ifndef HLS_SYNTHESIS\n'
+                            newline += f'    nnet::profile_layer({n_profiled}, {layer.name}_start);\n'
+                            newline += '#endif\n'
+                            n_profiled += 1
                         if model.config.trace_output and layer.get_attr('trace', False):
                             newline += '#ifndef HLS_SYNTHESIS\n'
                             for var in vars:
@@ -850,6 +861,98 @@ class QuartusWriter(Writer):
                         newline += indent + 'nnet::convert_data_back<{}, {}, {}>(outputs_ap.{}, {});\n'.format(
                             o.type.name, dtype, o.size_cpp(), o.member_name, o.member_name
                         )
+            elif '// hls-fpga-machine-learning insert layer profile' in line:
+                newline = ''
+                if model.config.layer_profiling:
+                    profiled = [layer.name for layer in model.get_layers() if layer.get_attr('function_cpp', None)]
+                    newline += 'namespace nnet {\n'
+                    newline += 'layer_profile_data layer_profile[] = {\n'
+                    for layer_name in profiled:
+                        newline += indent + f'{{"{layer_name}", 0, 0}},\n'
+                    newline += '};\n'
+                    newline += '} // namespace nnet\n\n'
+                    newline += 'extern "C" {\n\n'
+                    newline += f'size_t get_n_profiled_layers() {{ return {len(profiled)}; }}\n\n'
+                    newline += 'void reset_layer_profile() {\n'
+                    newline += indent + f'for (size_t i = 0; i < {len(profiled)}; i++) {{\n'
+                    newline += indent + indent + 'nnet::layer_profile[i].calls = 0;\n'
+                    newline += indent + indent + 'nnet::layer_profile[i].time_ns = 0;\n'
+                    newline += indent + '}\n'
+                    newline += '}\n\n'
+                    newline += 'void collect_layer_profile(nnet::layer_profile_data *profile) {\n'
+                    newline += indent + f'std::copy(nnet::layer_profile, nnet::layer_profile + {len(profiled)}, profile);\n'
+                    newline += '}\n'
+                    newline += '}\n'
+
+            elif '// hls-fpga-machine-learning insert raw wrappers' in line:
+                newline = ''
+                # Raw I/O is only possible for fixed-point/integer types up to 64 bits
+                raw_types = [raw_int_type(var.type.precision) for var in model_inputs + model_outputs]
+                raw_in_ctypes = ['int8_t', 'int16_t', 'int32_t', 'int64_t'] if None not in raw_types else []
+                output_ctypes = [raw_int_type(o.type.precision) + '_t' for o in model_outputs] if raw_in_ctypes else []
+
+                bram_params = ''
+                if model_brams:
+                    bram_params = ', ' + ','.join([b.name for b in model_brams])
+
+                for in_ctype in raw_in_ctypes:
+                    if io_type == 'io_stream':
+                        in_names = [i.name for i in model_inputs]
+                        out_names = [o.name for o in model_outputs]
+                    else:
+                        in_names = [i.member_name for i in model_inputs]
+                        out_names = [o.member_name for o in model_outputs]
+
+                    newline += '// Wrapper of top level function for Python bridge, using raw bits of fixed-point types\n'
+                    newline += f'void {model.config.get_project_name()}_{in_ctype[:-2]}(\n'
+                    inputs_str = ', '.join([f'{in_ctype} {n}[{i.size_cpp()}]' for i, n in zip(model_inputs, in_names)])
+                    outputs_str = ', '.join(
+                        [f'{c} {n}[{o.size_cpp()}]' for o, n, c in zip(model_outputs, out_names, output_ctypes)]
+                    )
+                    newline += indent + inputs_str + ',\n'
+                    newline += indent + outputs_str + '\n'
+                    newline += ') {\n'
+
+                    if io_type == 'io_stream':
+                        for i in model_inputs:
+                            newline += indent + f'stream_in<{i.type.name}> {i.name}_input;\n'
+                            newline += indent + 'nnet::convert_data_from_raw<{}, {}, {}>({}, {}_input);\n'.format(
+                                in_ctype, i.type.name, i.size_cpp(), i.name, i.name
+                            )
+
+                        for o in model_outputs:
+                            newline += '\n'
+                            newline += indent + f'stream_out<{o.type.name}> {o.name}_output;\n'
+
+                        input_params = ', '.join([f'{i.name}_input' for i in model_inputs])
+                        output_params = ', '.join([f'{o.name}_output' for o in model_outputs])
+                        newline += (
+                            indent + f'{model.config.get_project_name()}({input_params}, {output_params}{bram_params});\n'
+                        )
+                        newline += '\n'
+
+                        for o, ctype in zip(model_outputs, output_ctypes):
+                            newline += indent + 'nnet::convert_data_to_raw<{}, {}, {}>({}_output, {});\n'.format(
+                                o.type.name, ctype, o.size_cpp(), o.name, o.name
+                            )
+                    else:
+                        newline += indent + 'input_data inputs_ap;\n'
+                        for i in model_inputs:
+                            newline += indent + 'nnet::convert_data_from_raw<{}, {}, {}>({}, inputs_ap.{});\n'.format(
+                                in_ctype, i.type.name, i.size_cpp(), i.member_name, i.member_name
+                            )
+                        newline += '\n'
+
+                        newline += indent + 'output_data outputs_ap;\n'
+                        newline += indent + f'outputs_ap = {model.config.get_project_name()}(inputs_ap{bram_params});\n'
+                        newline += '\n'
+
+                        for o, ctype in zip(model_outputs, output_ctypes):
+                            newline += indent + 'nnet::convert_data_to_raw<{}, {}, {}>(outputs_ap.{}, {});\n'.format(
+                                o.type.name, ctype, o.size_cpp(), o.member_name, o.member_name
+                            )
+                    newline += '}\n\n'
+
             elif '// hls-fpga-machine-learning insert trace_outputs' in line:
                 newline = ''
                 for layer in model.get_layers():
@@ -1288,6 +1391,29 @@ class QuartusWriter(Writer):
         h_file.write('};\n')
         h_file.close()
 
+    def __write_invert_sqrt_tables(self, model, path):
+        # One table per LayerNormalization, included by the config of the layer as the table sizes may differ
+        for layer in model.get_layers():
+            if not isinstance(layer, LayerNormalization):
+                continue
+            table_size = int(layer.get_attr('table_size'))
+
+            h_file = open(f'{path}/{layernorm_table_name(layer)}.tb', 'w')
+
+            # 1/sqrt(m) for m in [1, 4), the top address bit selects [1, 2) or [2, 4), see nnet_layernorm.h
+            sep = ''
+            N = ceil_log2(table_size)
+            for i in range(table_size):
+                upper = i >> (N - 1)
+                mantissa = i & ((1 << (N - 1)) - 1)
+                m = (1.0 + (mantissa + 0.5) / (1 << (N - 1))) * (2.0 if upper else 1.0)
+                real_val = 1.0 / np.sqrt(m)
+                h_file.write(sep + str(real_val))
+                sep = ", "
+
+            h_file.write('\n')
+            h_file.close()
+
     def write_activation_tables(self, model):
         """Write the lookup tables for activation functions
 
@@ -1313,6 +1439,7 @@ class QuartusWriter(Writer):
         self.__write_invert_table_latency(model, dstpath)
         self.__write_exp_table_legacy(model, dstpath)
         self.__write_invert_table_legacy(model, dstpath)
+        self.__write_invert_sqrt_tables(model, dstpath)
 
     def write_yml(self, model):
         """Write the config to the YAML file
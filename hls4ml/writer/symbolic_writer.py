@@ -49,6 +49,24 @@ class SymbolicExpressionWriter(VivadoWriter):
             dstpath = f'{model.config.get_output_dir()}/firmware/{dst}'
             copyfile(srcpath, dstpath)
 
+    def _make_pipeline_pragma(self, model):
+        """The top function is pipelined with an initiation interval of the reuse factor of the expressions
+
+        Args:
+            model (ModelGraph): the hls4ml model.
+        """
+        reuse_factors = {
+            layer.get_attr('reuse_factor', 1) for layer in model.get_layers() if layer.class_name == 'SymbolicExpression'
+        }
+        if len(reuse_factors) > 1:
+            raise Exception(
+                f'All expressions of the pipelined top function must have the same reuse factor, got {reuse_factors}'
+            )
+        reuse_factor = reuse_factors.pop() if reuse_factors else 1
+        if reuse_factor > 1:
+            return f'#pragma HLS PIPELINE II={reuse_factor} \n'
+        return super()._make_pipeline_pragma(model)
+
     def write_build_script(self, model):
         """Write the TCL/Shell build scripts (project.tcl, build_prj.tcl, vivado_synth.tcl, build_lib.sh)
 
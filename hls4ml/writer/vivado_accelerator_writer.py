@@ -2,6 +2,7 @@ import os
 from distutils.dir_util import copy_tree
 from shutil import copyfile
 
+from hls4ml.backends.fpga.fpga_types import APTypeConverter
 from hls4ml.writer.vivado_writer import VivadoWriter
 
 
@@ -234,6 +235,113 @@ class VivadoAcceleratorWriter(VivadoWriter):
         f.close()
         fout.close()
 
+    def _batch_top_signature(self, model):
+        if self.vivado_accelerator_config.get_interface() == 'axi_stream':
+            args = 'hls::stream<axi_word_t> &in, hls::stream<axi_word_t> &out, unsigned n_samples'
+        else:
+            args = 'word_t *in, word_t *out, unsigned n_samples'
+        return f'void {model.config.get_project_name()}_axi({args})'
+
+    def write_axi_batch_wrapper(self, model):
+        '''Write a top level HLS C++ file to wrap the hls4ml project with a batched AXI interface, which processes a
+        runtime number of samples per call with the input and output values packed into words
+        Args:
+            model : The ModelGraph to write the wrapper for
+        '''
+        inp_axi_t, out_axi_t, inp, out = self.vivado_accelerator_config.get_corrected_types()
+        word_width = self.vivado_accelerator_config.get_word_width()
+        in_pack, out_pack = self.vivado_accelerator_config.get_packing()
+        io_type = model.config.get_config_value('IOType')
+        project_name = model.config.get_project_name()
+        indent = '    '
+
+        #######################
+        # myproject_axi.h
+        #######################
+
+        filedir = os.path.dirname(os.path.abspath(__file__))
+        f = open(os.path.join(filedir, '../templates/vivado_accelerator/myproject_axi_batch.h'))
+        fout = open(f'{model.config.get_output_dir()}/firmware/{project_name}_axi.h', 'w')
+
+        for line in f.readlines():
+            if 'MYPROJECT' in line:
+                newline = line.replace('MYPROJECT', format(project_name.upper()))
+            elif '// hls-fpga-machine-learning insert include' in line:
+                newline = f'#include "{project_name}.h"\n'
+            elif '// hls-fpga-machine-learning insert definitions' in line:
+                newline = ''
+                newline += f'static const unsigned N_IN = {inp.size()};\n'
+                newline += f'static const unsigned N_OUT = {out.size()};\n'
+                newline += f'typedef {APTypeConverter().convert(inp_axi_t).definition_cpp()} input_axi_t;\n'
+                newline += f'typedef {APTypeConverter().convert(out_axi_t).definition_cpp()} output_axi_t;\n'
+                newline += f'typedef ap_uint<{word_width}> word_t;\n'
+                newline += f'static const unsigned WORD_WIDTH = {word_width};\n'
+                newline += f'static const unsigned IN_WIDTH = {inp_axi_t.width};\n'
+                newline += f'static const unsigned IN_PACK = {in_pack};\n'
+                newline += f'static const unsigned IN_WORDS = {(inp.size() + in_pack - 1) // in_pack};\n'
+                newline += f'static const unsigned OUT_WIDTH = {out_axi_t.width};\n'
+                newline += f'static const unsigned OUT_PACK = {out_pack};\n'
+                newline += f'static const unsigned OUT_WORDS = {(out.size() + out_pack - 1) // out_pack};\n'
+                if io_type == 'io_parallel':
+                    newline += f'typedef nnet::array<{inp.type.name}, N_IN> batch_input_t;\n'
+                    newline += f'typedef nnet::array<{out.type.name}, N_OUT> batch_result_t;\n'
+                else:
+                    newline += f'typedef {inp.type.name} batch_input_t;\n'
+                    newline += f'typedef {out.type.name} batch_result_t;\n'
+            elif '// hls-fpga-machine-learning insert prototype' in line:
+                newline = self._batch_top_signature(model) + ';\n'
+            elif 'myproject' in line:
+                newline = line.replace('myproject', project_name)
+            else:
+                newline = line
+            fout.write(newline)
+        f.close()
+        fout.close()
+
+        #######################
+        # myproject_axi.cpp
+        #######################
+
+        f = open(os.path.join(filedir, '../templates/vivado_accelerator/myproject_axi_batch.cpp'))
+        fout = open(f'{model.config.get_output_dir()}/firmware/{project_name}_axi.cpp', 'w')
+
+        for line in f.readlines():
+            if '// hls-fpga-machine-learning insert include' in line:
+                newline = f'#include "{project_name}_axi.h"\n'
+            elif '// hls-fpga-machine-learning insert top' in line:
+                newline = self._batch_top_signature(model) + '\n'
+            elif '// hls-fpga-machine-learning insert call' in line:
+                if io_type == 'io_parallel':
+                    newline = ''
+                    newline += indent * 2 + 'batch_input_t in_sample = in_local.read();\n'
+                    newline += indent * 2 + 'batch_result_t out_sample;\n'
+                    newline += indent * 2 + f'{project_name}(in_sample.data, out_sample.data);\n'
+                    newline += indent * 2 + 'out_local.write(out_sample);\n'
+                else:
+                    newline = indent * 2 + f'{project_name}(in_local, out_local);\n'
+            elif '// hls-fpga-machine-learning insert interface' in line:
+                newline = ''
+                if self.vivado_accelerator_config.get_interface() == 'axi_master':
+                    newline += indent + '#pragma HLS INTERFACE m_axi port=in offset=slave bundle=IN_BUS\n'
+                    newline += indent + '#pragma HLS INTERFACE m_axi port=out offset=slave bundle=OUT_BUS\n'
+                else:
+                    newline += indent + '#pragma HLS INTERFACE axis port=in\n'
+                    newline += indent + '#pragma HLS INTERFACE axis port=out\n'
+                newline += indent + '#pragma HLS INTERFACE s_axilite port=n_samples bundle=CTRL_BUS\n'
+                newline += indent + '#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS\n'
+            elif '// hls-fpga-machine-learning insert local vars' in line:
+                newline = ''
+                newline += indent + 'hls::stream<batch_input_t> in_local("in_local");\n'
+                newline += indent + 'hls::stream<batch_result_t> out_local("out_local");\n'
+                if io_type == 'io_stream':
+                    newline += indent + f'#pragma HLS STREAM variable=in_local depth={inp.pragma[1]}\n'
+                    newline += indent + f'#pragma HLS STREAM variable=out_local depth={out.pragma[1]}\n'
+            else:
+                newline = line
+            fout.write(newline)
+        f.close()
+        fout.close()
+
     def modify_build_script(self, model):
         '''
         Modify the build_prj.tcl and build_lib.sh scripts to add the extra wrapper files and set the top function
@@ -273,6 +381,8 @@ class VivadoAcceleratorWriter(VivadoWriter):
         for line in f.readlines():
             line = line.replace('myproject', model.config.get_project_name())
             line = line.replace('mystamp', model.config.get_config_value('Stamp'))
+            if line.startswith('INCFLAGS=') and model.config.overflow_counters:
+                line = 'CFLAGS="${CFLAGS} -DHLS4ML_OVERFLOW_COUNTERS"\n' + line
 
             fout.write(line)
         f.close()
@@ -363,6 +473,41 @@ class VivadoAcceleratorWriter(VivadoWriter):
         fout.close()
         os.rename(newfile, oldfile)
 
+    def write_batch_test(self, model):
+        '''Write the testbench of the batched wrapper, which packs all samples of tb_data into words and processes them
+        with a single call
+        '''
+        project_name = model.config.get_project_name()
+        indent = '    '
+
+        filedir = os.path.dirname(os.path.abspath(__file__))
+        f = open(os.path.join(filedir, '../templates/vivado_accelerator/myproject_test_batch.cpp'))
+        fout = open(f'{model.config.get_output_dir()}/{project_name}_test.cpp', 'w')
+
+        for line in f.readlines():
+            if '// hls-fpga-machine-learning insert top-level-function' in line:
+                if self.vivado_accelerator_config.get_interface() == 'axi_stream':
+                    newline = ''
+                    newline += indent + 'hls::stream<axi_word_t> in_stream("in_stream");\n'
+                    newline += indent + 'hls::stream<axi_word_t> out_stream("out_stream");\n'
+                    newline += indent + 'for (unsigned i = 0; i < in_words.size(); i++) {\n'
+                    newline += indent * 2 + 'write_word(in_stream, i, in_words[i], i == in_words.size() - 1);\n'
+                    newline += indent + '}\n'
+                    newline += indent + f'{project_name}_axi(in_stream, out_stream, n_samples);\n'
+                    newline += indent + 'for (unsigned i = 0; i < out_words.size(); i++) {\n'
+                    newline += indent * 2 + 'out_words[i] = read_word(out_stream, i);\n'
+                    newline += indent + '}\n'
+                else:
+                    newline = indent + f'{project_name}_axi(in_words.data(), out_words.data(), n_samples);\n'
+            elif 'myproject' in line:
+                newline = line.replace('myproject', project_name)
+            else:
+                newline = line
+            fout.write(newline)
+
+        f.close()
+        fout.close()
+
     def write_board_script(self, model):
         '''
         Write the tcl scripts and kernel sources to create a Vivado IPI project for the VivadoAccelerator
@@ -406,6 +551,11 @@ class VivadoAcceleratorWriter(VivadoWriter):
             os.path.join(filedir, self.vivado_accelerator_config.get_driver_path()),
             ('{}/' + self.vivado_accelerator_config.get_driver_file()).format(model.config.get_output_dir()),
         )
+        if self.vivado_accelerator_config.get_driver() == 'python':
+            copyfile(
+                os.path.join(filedir, '../templates/vivado_accelerator/buffered_driver.py'),
+                f'{model.config.get_output_dir()}/buffered_driver.py',
+            )
 
     def write_new_tar(self, model):
         os.remove(model.config.get_output_dir() + '.tar.gz')
@@ -424,7 +574,11 @@ class VivadoAcceleratorWriter(VivadoWriter):
         super().write_hls(model)
         self.write_board_script(model)
         self.write_driver(model)
-        self.write_wrapper_test(model)
-        self.write_axi_wrapper(model)
+        if self.vivado_accelerator_config.get_batched():
+            self.write_batch_test(model)
+            self.write_axi_batch_wrapper(model)
+        else:
+            self.write_wrapper_test(model)
+            self.write_axi_wrapper(model)
         self.modify_build_script(model)
         self.write_new_tar(model)
@@ -7,6 +7,7 @@ from shutil import copyfile, copytree, rmtree
 import numpy as np
 import yaml
 
+from hls4ml.utils.fixed_point_utils import raw_int_type
 from hls4ml.writer.writers import Writer
 
 config_filename = 'hls4ml_config.yml'
@@ -102,6 +103,10 @@ class VivadoWriter(Writer):
         elif mode == 'stream':
             return f'#pragma HLS STREAM variable={variable.name} depth={depth}'
 
+    def _make_pipeline_pragma(self, model):
+        """The pipeline pragma of the top function in io_parallel, overridden by writers that set an initiation interval"""
+        return '#pragma HLS PIPELINE \n'
+
     def write_project_cpp(self, model):
         """Write the main architecture source file (myproject.cpp)
 
@@ -174,7 +179,7 @@ class VivadoWriter(Writer):
                     if model.config.pipeline_style.lower() == 'dataflow':
                         newline += indent + '#pragma HLS DATAFLOW \n'
                     else:
-                        newline += indent + '#pragma HLS PIPELINE \n'
+                        newline += indent + self._make_pipeline_pragma(model)
                 if io_type == 'io_stream':
                     newline += indent + '#pragma HLS INTERFACE axis port={},{} \n'.format(
                         ','.join(all_inputs), ','.join(all_outputs)
@@ -185,6 +190,8 @@ class VivadoWriter(Writer):
 
             elif '// hls-fpga-machine-learning insert layers' in line:
                 newline = line + '\n'
+                n_profiled = 0
+                n_counted = 0
                 for layer in model.get_layers():
                     vars = layer.get_variables()
                     for var in vars:
@@ -196,6 +203,14 @@ class VivadoWriter(Writer):
                                     newline += '    ' + self._make_array_pragma(var) + '\n'
                     func = layer.get_attr('function_cpp', None)
                     if func:
+                        if model.config.layer_profiling:
+                            newline += '#ifndef __SYNTHESIS__\n'
+                            newline += f'    unsigned long long {layer.name}_start = nnet::profile_timestamp();\n'
+                            newline += '#endif\n'
+                        if model.config.overflow_counters:
+                            newline += '#ifdef HLS4ML_OVERFLOW_COUNTERS\n'
+                            newline += f'    nnet::overflow_counters_begin({n_counted});\n'
+                            newline += '#endif\n'
                         if not isinstance(func, (list, set)):
                             func = [func]
                         if len(func) == 1:
@@ -204,6 +219,16 @@ class VivadoWriter(Writer):
                             newline += '    // ' + layer.name + '\n'
                             for line in func:
                                 newline += '    ' + line + '\n'
+                        if model.config.layer_profiling:
+                            newline += '#ifndef __SYNTHESIS__\n'
+                            newline += f'    nnet::profile_layer({n_profiled}, {layer.name}_start);\n'
+                            newline += '#endif\n'
+                            n_profiled += 1
+                        if model.config.overflow_counters:
+                            newline += '#ifdef HLS4ML_OVERFLOW_COUNTERS\n'
+                            newline += '    nnet::overflow_counters_end();\n'
+                            newline += '#endif\n'
+                            n_counted += 1
                         if model.config.trace_output and layer.get_attr('trace', False):
                             newline += '#ifndef __SYNTHESIS__\n'
                             for var in vars:
@@ -548,6 +573,84 @@ class VivadoWriter(Writer):
                     newline += indent + 'nnet::convert_data<{}, {}, {}>({}_ap, {});\n'.format(
                         o.type.name, dtype, o.size_cpp(), o.name, o.name
                     )
+            elif '// hls-fpga-machine-learning insert layer profile' in line:
+                newline = ''
+                if model.config.layer_profiling:
+                    profiled = [layer.name for layer in model.get_layers() if layer.get_attr('function_cpp', None)]
+                    newline += 'namespace nnet {\n'
+                    newline += 'layer_profile_data layer_profile[] = {\n'
+                    for layer_name in profiled:
+                        newline += indent + f'{{"{layer_name}", 0, 0}},\n'
+                    newline += '};\n'
+                    newline += '} // namespace nnet\n\n'
+                    newline += 'extern "C" {\n\n'
+                    newline += f'size_t get_n_profiled_layers() {{ return {len(profiled)}; }}\n\n'
+                    newline += 'void reset_layer_profile() {\n'
+                    newline += indent + f'for (size_t i = 0; i < {len(profiled)}; i++) {{\n'
+                    newline += indent + indent + 'nnet::layer_profile[i].calls = 0;\n'
+                    newline += indent + indent + 'nnet::layer_profile[i].time_ns = 0;\n'
+                    newline += indent + '}\n'
+                    newline += '}\n\n'
+                    newline += 'void collect_layer_profile(nnet::layer_profile_data *profile) {\n'
+                    newline += indent + f'std::copy(nnet::layer_profile, nnet::layer_profile + {len(profiled)}, profile);\n'
+                    newline += '}\n'
+                    newline += '}\n'
+
+            elif '// hls-fpga-machine-learning insert overflow counters' in line:
+                newline = ''
+                if model.config.overflow_counters:
+                    newline += 'extern "C" {\n\n'
+                    newline += 'size_t get_n_overflow_counters() { return nnet::overflow_counters().counters.size(); }\n\n'
+                    newline += 'void reset_overflow_counters() { nnet::overflow_counters().counters.clear(); }\n\n'
+                    newline += 'void collect_overflow_counters(nnet::overflow_counter_data *counters) {\n'
+                    newline += indent + 'std::copy(nnet::overflow_counters().counters.begin(), '
+                    newline += 'nnet::overflow_counters().counters.end(), counters);\n'
+                    newline += '}\n'
+                    newline += '}\n'
+
+            elif '// hls-fpga-machine-learning insert raw wrappers' in line:
+                newline = ''
+                # Raw I/O is only possible for fixed-point/integer types up to 64 bits
+                raw_types = [raw_int_type(var.type.precision) for var in model_inputs + model_outputs]
+                raw_in_ctypes = ['int8_t', 'int16_t', 'int32_t', 'int64_t'] if None not in raw_types else []
+                output_ctypes = [raw_int_type(o.type.precision) + '_t' for o in model_outputs] if raw_in_ctypes else []
+
+                for in_ctype in raw_in_ctypes:
+                    newline += '// Wrapper of top level function for Python bridge, using raw bits of fixed-point types\n'
+                    newline += f'void {model.config.get_project_name()}_{in_ctype[:-2]}(\n'
+                    inputs_str = ', '.join([f'{in_ctype} {i.name}[{i.size_cpp()}]' for i in model_inputs])
+                    outputs_str = ', '.join(
+                        [f'{ctype} {o.name}[{o.size_cpp()}]' for o, ctype in zip(model_outputs, output_ctypes)]
+                    )
+                    newline += indent + inputs_str + ',\n'
+                    newline += indent + outputs_str + '\n'
+                    newline += ') {\n'
+
+                    for i in model_inputs:
+                        newline += indent + '{var};\n'.format(var=i.definition_cpp(name_suffix='_ap'))
+                        newline += indent + 'nnet::convert_data_from_raw<{}, {}, {}>({}, {}_ap);\n'.format(
+                            in_ctype, i.type.name, i.size_cpp(), i.name, i.name
+                        )
+                    newline += '\n'
+
+                    for o in model_outputs:
+                        newline += indent + '{var};\n'.format(var=o.definition_cpp(name_suffix='_ap'))
+
+                    newline += '\n'
+
+                    input_vars = ','.join([i.name + '_ap' for i in model_inputs])
+                    bram_vars = ','.join([b.name for b in model_brams])
+                    output_vars = ','.join([o.name + '_ap' for o in model_outputs])
+                    all_vars = ','.join(filter(None, [input_vars, output_vars, bram_vars]))
+                    newline += indent + f'{model.config.get_project_name()}({all_vars});\n'
+                    newline += '\n'
+
+                    for o, ctype in zip(model_outputs, output_ctypes):
+                        newline += indent + 'nnet::convert_data_to_raw<{}, {}, {}>({}_ap, {});\n'.format(
+                            o.type.name, ctype, o.size_cpp(), o.name, o.name
+                        )
+                    newline += '}\n\n'
+
             elif '// hls-fpga-machine-learning insert trace_outputs' in line:
                 newline = ''
                 for layer in model.get_layers():
@@ -610,6 +713,8 @@ class VivadoWriter(Writer):
         for line in f.readlines():
             line = line.replace('myproject', model.config.get_project_name())
             line = line.replace('mystamp', model.config.get_config_value('Stamp'))
+            if line.startswith('INCFLAGS=') and model.config.overflow_counters:
+                line = 'CFLAGS="${CFLAGS} -DHLS4ML_OVERFLOW_COUNTERS"\n' + line
 
             fout.write(line)
         f.close()
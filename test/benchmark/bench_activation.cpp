@@ -0,0 +1,112 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_activation.h"
+#include "nnet_utils/nnet_activation_stream.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+template <unsigned N_IN, unsigned IO_TYPE, nnet::softmax_implementation IMPL = nnet::softmax_implementation::stable>
+struct activ_bench_config : nnet::activ_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned table_size = 1024;
+    static const unsigned io_type = IO_TYPE;
+    static const unsigned reuse_factor = 1;
+    static const unsigned axis = -1;
+    static const nnet::softmax_implementation implementation = IMPL;
+    typedef ap_fixed<18, 8> table_t;
+    typedef ap_fixed<18, 8, AP_RND, AP_SAT> exp_table_t;
+    typedef ap_fixed<18, 8, AP_RND, AP_SAT> inv_table_t;
+};
+
+// Wrappers selecting the activation function, as function templates can't be passed as template arguments
+#define ACTIVATION_KERNEL(NAME, FUNC)                                                                                       \
+    struct NAME##_kernel {                                                                                                 \
+        static const char *name() { return #NAME; }                                                                        \
+        template <class data_T, class res_T, class CONFIG_T> static void call(data_T *data, res_T *res) {                  \
+            nnet::FUNC<data_T, res_T, CONFIG_T>(data, res);                                                                \
+        }                                                                                                                  \
+        template <class data_T, class res_T, class CONFIG_T>                                                               \
+        static void call(hls::stream<data_T> &data, hls::stream<res_T> &res) {                                             \
+            nnet::FUNC<data_T, res_T, CONFIG_T>(data, res);                                                                \
+        }                                                                                                                  \
+    };
+
+ACTIVATION_KERNEL(relu, relu)
+ACTIVATION_KERNEL(sigmoid, sigmoid)
+ACTIVATION_KERNEL(tanh, tanh)
+ACTIVATION_KERNEL(softmax, softmax)
+
+#undef ACTIVATION_KERNEL
+
+template <class T, class KERNEL, unsigned N_IN, nnet::softmax_implementation IMPL>
+void add_activation(const std::string &variant) {
+    typedef activ_bench_config<N_IN, nnet::io_parallel, IMPL> config;
+
+    struct state {
+        std::vector<T> data = std::vector<T>(N_IN);
+        std::vector<T> res = std::vector<T>(N_IN);
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data, -4.0, 4.0);
+
+    register_benchmark(KERNEL::name(), variant, type_name<T>(), std::to_string(N_IN), N_IN, [s]() {
+        KERNEL::template call<T, T, config>(s->data.data(), s->res.data());
+        do_not_optimize(s->res[0]);
+    });
+}
+
+template <class T, class KERNEL, unsigned N_IN, nnet::softmax_implementation IMPL>
+void add_activation_stream(const std::string &variant) {
+    typedef activ_bench_config<N_IN, nnet::io_stream, IMPL> config;
+    typedef nnet::array<T, N_IN> data_T;
+
+    struct state {
+        std::vector<T> data = std::vector<T>(N_IN);
+        hls::stream<data_T> in;
+        hls::stream<data_T> out;
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data, -4.0, 4.0);
+
+    register_benchmark(KERNEL::name(), variant, type_name<T>(), std::to_string(N_IN), N_IN, [s]() {
+        write_stream(s->in, s->data);
+        KERNEL::template call<data_T, data_T, config>(s->in, s->out);
+        drain_stream(s->out);
+    });
+}
+
+template <class T, unsigned N_IN> void add_activation_sizes() {
+    const nnet::softmax_implementation stable = nnet::softmax_implementation::stable;
+    const nnet::softmax_implementation latency = nnet::softmax_implementation::latency;
+
+    add_activation<T, relu_kernel, N_IN, stable>("parallel");
+    add_activation<T, sigmoid_kernel, N_IN, stable>("parallel");
+    add_activation<T, tanh_kernel, N_IN, stable>("parallel");
+
+    add_activation_stream<T, relu_kernel, N_IN, stable>("stream");
+    add_activation_stream<T, sigmoid_kernel, N_IN, stable>("stream");
+
+    // The lookup tables of softmax are indexed with 10 bits of the input
+    if (T::width >= 10) {
+        add_activation<T, softmax_kernel, N_IN, stable>("stable");
+        add_activation<T, softmax_kernel, N_IN, latency>("latency");
+        add_activation_stream<T, softmax_kernel, N_IN, stable>("stable_stream");
+    }
+}
+
+template <class T> void add_activation_types() {
+    add_activation_sizes<T, 16>();
+    add_activation_sizes<T, 256>();
+}
+
+} // namespace
+
+void register_activation_benchmarks() {
+    add_activation_types<ap_fixed<8, 3>>();
+    add_activation_types<ap_fixed<16, 6>>();
+    add_activation_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
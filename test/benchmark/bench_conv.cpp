@@ -0,0 +1,251 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_conv1d.h"
+#include "nnet_utils/nnet_conv1d_stream.h"
+#include "nnet_utils/nnet_conv2d.h"
+#include "nnet_utils/nnet_conv2d_stream.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+// All convolutions use 3 (or 3x3) kernels with unit stride and no padding
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned STRATEGY, unsigned RF>
+struct conv_mult_bench_config : nnet::dense_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned n_out = N_OUT;
+    static const unsigned reuse_factor = RF;
+    static const unsigned strategy = STRATEGY;
+    static const unsigned n_zeros = 0;
+    static const unsigned multiplier_limit = DIV_ROUNDUP(n_in * n_out, reuse_factor) - n_zeros / reuse_factor;
+    typedef T accum_t;
+    typedef T bias_t;
+    typedef T weight_t;
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+// Generic im2col used in place of the generated fill_buffer functions of io_parallel convolutions
+template <class data_T, typename CONFIG_T> class FillConv1DBufferGeneric {
+  public:
+    static void fill_buffer(data_T data[CONFIG_T::in_width * CONFIG_T::n_chan],
+                            data_T buffer[CONFIG_T::n_pixels][CONFIG_T::filt_width * CONFIG_T::n_chan],
+                            const unsigned partition) {
+        for (unsigned p = 0; p < CONFIG_T::n_pixels; p++) {
+            unsigned ow = partition * CONFIG_T::n_pixels + p;
+            for (unsigned fw = 0; fw < CONFIG_T::filt_width; fw++) {
+                unsigned iw = ow * CONFIG_T::stride_width + fw;
+                for (unsigned c = 0; c < CONFIG_T::n_chan; c++) {
+                    buffer[p][fw * CONFIG_T::n_chan + c] = data[iw * CONFIG_T::n_chan + c];
+                }
+            }
+        }
+    }
+};
+
+template <class data_T, typename CONFIG_T> class FillConv2DBufferGeneric {
+  public:
+    static void
+    fill_buffer(data_T data[CONFIG_T::in_height * CONFIG_T::in_width * CONFIG_T::n_chan],
+                data_T buffer[CONFIG_T::n_pixels][CONFIG_T::filt_height * CONFIG_T::filt_width * CONFIG_T::n_chan],
+                const unsigned partition) {
+        for (unsigned p = 0; p < CONFIG_T::n_pixels; p++) {
+            unsigned oh = (partition * CONFIG_T::n_pixels + p) / CONFIG_T::out_width;
+            unsigned ow = (partition * CONFIG_T::n_pixels + p) % CONFIG_T::out_width;
+            for (unsigned fh = 0; fh < CONFIG_T::filt_height; fh++) {
+                unsigned ih = oh * CONFIG_T::stride_height + fh;
+                for (unsigned fw = 0; fw < CONFIG_T::filt_width; fw++) {
+                    unsigned iw = ow * CONFIG_T::stride_width + fw;
+                    for (unsigned c = 0; c < CONFIG_T::n_chan; c++) {
+                        buffer[p][(fh * CONFIG_T::filt_width + fw) * CONFIG_T::n_chan + c] =
+                            data[(ih * CONFIG_T::in_width + iw) * CONFIG_T::n_chan + c];
+                    }
+                }
+            }
+        }
+    }
+};
+
+template <class T, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF,
+          nnet::conv_implementation IMPL>
+struct conv1d_bench_config : nnet::conv1d_config {
+    static const unsigned pad_left = 0;
+    static const unsigned pad_right = 0;
+    static const unsigned in_width = IN_W;
+    static const unsigned n_chan = N_CHAN;
+    static const unsigned filt_width = 3;
+    static const unsigned kernel_size = filt_width;
+    static const unsigned n_filt = N_FILT;
+    static const unsigned stride_width = 1;
+    static const unsigned dilation = 1;
+    static const unsigned out_width = IN_W - filt_width + 1;
+    static const unsigned reuse_factor = RF;
+    static const unsigned n_zeros = 0;
+    static const unsigned multiplier_limit =
+        DIV_ROUNDUP(kernel_size * n_chan * n_filt, reuse_factor) - n_zeros / reuse_factor;
+    static const bool store_weights_in_bram = false;
+    static const unsigned strategy = STRATEGY;
+    static const nnet::conv_implementation implementation = IMPL;
+    static const unsigned min_width = 5;
+    static const ap_uint<filt_width> pixels[min_width];
+    static const unsigned n_partitions = out_width;
+    static const unsigned n_pixels = out_width / n_partitions;
+    template <class data_T, class CONFIG_T> using fill_buffer = FillConv1DBufferGeneric<data_T, CONFIG_T>;
+    typedef T accum_t;
+    typedef T bias_t;
+    typedef T weight_t;
+    typedef conv_mult_bench_config<T, kernel_size * N_CHAN, N_FILT, STRATEGY, RF> mult_config;
+    template <unsigned K, unsigned S, unsigned W> using scale_index = nnet::scale_index_regular<K, S, W>;
+};
+template <class T, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF,
+          nnet::conv_implementation IMPL>
+const ap_uint<3> conv1d_bench_config<T, IN_W, N_CHAN, N_FILT, STRATEGY, RF, IMPL>::pixels[] = {1, 3, 7, 6, 4};
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF,
+          nnet::conv_implementation IMPL>
+struct conv2d_bench_config : nnet::conv2d_config {
+    static const unsigned pad_top = 0;
+    static const unsigned pad_bottom = 0;
+    static const unsigned pad_left = 0;
+    static const unsigned pad_right = 0;
+    static const unsigned in_height = IN_H;
+    static const unsigned in_width = IN_W;
+    static const unsigned n_chan = N_CHAN;
+    static const unsigned filt_height = 3;
+    static const unsigned filt_width = 3;
+    static const unsigned kernel_size = filt_height * filt_width;
+    static const unsigned n_filt = N_FILT;
+    static const unsigned stride_height = 1;
+    static const unsigned stride_width = 1;
+    static const unsigned out_height = IN_H - filt_height + 1;
+    static const unsigned out_width = IN_W - filt_width + 1;
+    static const unsigned reuse_factor = RF;
+    static const unsigned n_zeros = 0;
+    static const unsigned multiplier_limit =
+        DIV_ROUNDUP(kernel_size * n_chan * n_filt, reuse_factor) - n_zeros / reuse_factor;
+    static const bool store_weights_in_bram = false;
+    static const unsigned strategy = STRATEGY;
+    static const nnet::conv_implementation implementation = IMPL;
+    static const unsigned min_height = 5;
+    static const unsigned min_width = 5;
+    static const ap_uint<filt_height * filt_width> pixels[min_height * min_width];
+    static const unsigned n_partitions = out_height * out_width;
+    static const unsigned n_pixels = out_height * out_width / n_partitions;
+    template <class data_T, class CONFIG_T> using fill_buffer = FillConv2DBufferGeneric<data_T, CONFIG_T>;
+    typedef T accum_t;
+    typedef T bias_t;
+    typedef T weight_t;
+    typedef conv_mult_bench_config<T, kernel_size * N_CHAN, N_FILT, STRATEGY, RF> mult_config;
+    template <unsigned K, unsigned S, unsigned W> using scale_index_height = nnet::scale_index_regular<K, S, W>;
+    template <unsigned K, unsigned S, unsigned W> using scale_index_width = nnet::scale_index_regular<K, S, W>;
+};
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF,
+          nnet::conv_implementation IMPL>
+const ap_uint<9> conv2d_bench_config<T, IN_H, IN_W, N_CHAN, N_FILT, STRATEGY, RF, IMPL>::pixels[] = {
+    1, 3, 7, 6, 4, 9, 27, 63, 54, 36, 73, 219, 511, 438, 292, 72, 216, 504, 432, 288, 64, 192, 448, 384, 256};
+
+template <class T, class CONFIG_T> struct conv_state {
+    static const unsigned n_weights = CONFIG_T::kernel_size * CONFIG_T::n_chan * CONFIG_T::n_filt;
+
+    std::vector<T> data;
+    std::vector<T> res;
+    std::vector<T> weights = std::vector<T>(n_weights);
+    std::vector<T> biases = std::vector<T>(CONFIG_T::n_filt);
+    hls::stream<nnet::array<T, CONFIG_T::n_chan>> in;
+    hls::stream<nnet::array<T, CONFIG_T::n_filt>> out;
+
+    conv_state(unsigned n_in, unsigned n_out) : data(n_in), res(n_out) {
+        fill_random(data);
+        fill_random(weights);
+        fill_random(biases);
+    }
+};
+
+template <class T, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF>
+void add_conv1d(const char *variant) {
+    typedef conv1d_bench_config<T, IN_W, N_CHAN, N_FILT, STRATEGY, RF, nnet::conv_implementation::linebuffer> config;
+    std::shared_ptr<conv_state<T, config>> s =
+        std::make_shared<conv_state<T, config>>(IN_W * N_CHAN, config::out_width * N_FILT);
+
+    register_benchmark("conv1d", variant, type_name<T>(), size_name(IN_W, N_CHAN, N_FILT),
+                       config::out_width * conv_state<T, config>::n_weights, [s]() {
+                           nnet::conv_1d_cl<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                          s->biases.data());
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, nnet::conv_implementation IMPL>
+void add_conv1d_stream(const char *variant) {
+    typedef conv1d_bench_config<T, IN_W, N_CHAN, N_FILT, nnet::latency, 1, IMPL> config;
+    typedef nnet::array<T, N_CHAN> data_T;
+    typedef nnet::array<T, N_FILT> res_T;
+    std::shared_ptr<conv_state<T, config>> s = std::make_shared<conv_state<T, config>>(IN_W * N_CHAN, 0);
+
+    register_benchmark("conv1d", variant, type_name<T>(), size_name(IN_W, N_CHAN, N_FILT),
+                       config::out_width * conv_state<T, config>::n_weights, [s]() {
+                           write_stream(s->in, s->data);
+                           nnet::conv_1d_cl<data_T, res_T, config>(s->in, s->out, s->weights.data(), s->biases.data());
+                           drain_stream(s->out);
+                       });
+}
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, unsigned STRATEGY, unsigned RF>
+void add_conv2d(const char *variant) {
+    typedef conv2d_bench_config<T, IN_H, IN_W, N_CHAN, N_FILT, STRATEGY, RF, nnet::conv_implementation::linebuffer> config;
+    const unsigned n_out = config::out_height * config::out_width;
+    std::shared_ptr<conv_state<T, config>> s = std::make_shared<conv_state<T, config>>(IN_H * IN_W * N_CHAN, n_out * N_FILT);
+
+    register_benchmark("conv2d", variant, type_name<T>(), size_name(IN_H, IN_W, N_CHAN) + "x" + std::to_string(N_FILT),
+                       n_out * conv_state<T, config>::n_weights, [s]() {
+                           nnet::conv_2d_cl<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                          s->biases.data());
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_CHAN, unsigned N_FILT, nnet::conv_implementation IMPL>
+void add_conv2d_stream(const char *variant) {
+    typedef conv2d_bench_config<T, IN_H, IN_W, N_CHAN, N_FILT, nnet::latency, 1, IMPL> config;
+    typedef nnet::array<T, N_CHAN> data_T;
+    typedef nnet::array<T, N_FILT> res_T;
+    const unsigned n_out = config::out_height * config::out_width;
+    std::shared_ptr<conv_state<T, config>> s = std::make_shared<conv_state<T, config>>(IN_H * IN_W * N_CHAN, 0);
+
+    register_benchmark("conv2d", variant, type_name<T>(), size_name(IN_H, IN_W, N_CHAN) + "x" + std::to_string(N_FILT),
+                       n_out * conv_state<T, config>::n_weights, [s]() {
+                           write_stream(s->in, s->data);
+                           nnet::conv_2d_cl<data_T, res_T, config>(s->in, s->out, s->weights.data(), s->biases.data());
+                           drain_stream(s->out);
+                       });
+}
+
+template <class T> void add_conv_types() {
+    add_conv1d<T, 32, 8, 16, nnet::latency, 1>("latency");
+    add_conv1d<T, 128, 16, 32, nnet::latency, 1>("latency");
+    add_conv1d<T, 32, 8, 16, nnet::resource, 8>("resource");
+    add_conv1d<T, 128, 16, 32, nnet::resource, 8>("resource");
+    add_conv1d_stream<T, 32, 8, 16, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_conv1d_stream<T, 128, 16, 32, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_conv1d_stream<T, 32, 8, 16, nnet::conv_implementation::encoded>("encoded");
+    add_conv1d_stream<T, 128, 16, 32, nnet::conv_implementation::encoded>("encoded");
+
+    add_conv2d<T, 8, 8, 4, 8, nnet::latency, 1>("latency");
+    add_conv2d<T, 16, 16, 8, 16, nnet::latency, 1>("latency");
+    add_conv2d<T, 8, 8, 4, 8, nnet::resource, 4>("resource");
+    add_conv2d<T, 16, 16, 8, 16, nnet::resource, 8>("resource");
+    add_conv2d_stream<T, 8, 8, 4, 8, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_conv2d_stream<T, 16, 16, 8, 16, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_conv2d_stream<T, 8, 8, 4, 8, nnet::conv_implementation::encoded>("encoded");
+    add_conv2d_stream<T, 16, 16, 8, 16, nnet::conv_implementation::encoded>("encoded");
+}
+
+} // namespace
+
+void register_conv_benchmarks() {
+    add_conv_types<ap_fixed<8, 3>>();
+    add_conv_types<ap_fixed<16, 6>>();
+    add_conv_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
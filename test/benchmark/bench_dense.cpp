@@ -0,0 +1,143 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_dense.h"
+#include "nnet_utils/nnet_dense_compressed.h"
+#include "nnet_utils/nnet_dense_stream.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned STRATEGY, unsigned RF>
+struct dense_bench_config : nnet::dense_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned n_out = N_OUT;
+    static const unsigned io_type = nnet::io_parallel;
+    static const unsigned strategy = STRATEGY;
+    static const unsigned reuse_factor = RF;
+    static const unsigned n_zeros = 0;
+    static const unsigned n_nonzeros = N_IN * N_OUT;
+    static const unsigned multiplier_limit = DIV_ROUNDUP(n_in * n_out, reuse_factor) - n_zeros / reuse_factor;
+    static const bool store_weights_in_bram = false;
+    typedef T accum_t;
+    typedef T bias_t;
+    typedef T weight_t;
+    typedef ap_uint<1> index_t;
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+// Same layout as the COO type generated for compressed layers
+template <class T> struct compressed_weight {
+    ap_uint<8> row_index;
+    ap_uint<8> col_index;
+    T weight;
+};
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned RF>
+struct dense_compressed_bench_config : dense_bench_config<T, N_IN, N_OUT, nnet::resource, RF> {
+    // Half of the weights are pruned
+    static const unsigned n_zeros = N_IN * N_OUT / 2;
+    static const unsigned n_nonzeros = N_IN * N_OUT - n_zeros;
+    typedef compressed_weight<T> weight_t;
+    typedef ap_uint<8> index_t;
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, T>;
+};
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned STRATEGY, unsigned RF> void add_dense(const char *variant) {
+    typedef dense_bench_config<T, N_IN, N_OUT, STRATEGY, RF> config;
+
+    struct state {
+        std::vector<T> data = std::vector<T>(N_IN);
+        std::vector<T> res = std::vector<T>(N_OUT);
+        std::vector<T> weights = std::vector<T>(N_IN * N_OUT);
+        std::vector<T> biases = std::vector<T>(N_OUT);
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data);
+    fill_random(s->weights);
+    fill_random(s->biases);
+
+    register_benchmark("dense", variant, type_name<T>(), size_name(N_IN, N_OUT), N_IN * N_OUT, [s]() {
+        nnet::dense<T, T, config>(s->data.data(), s->res.data(), s->weights.data(), s->biases.data());
+        do_not_optimize(s->res[0]);
+    });
+}
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned RF> void add_dense_compressed() {
+    typedef dense_compressed_bench_config<T, N_IN, N_OUT, RF> config;
+
+    struct state {
+        std::vector<T> data = std::vector<T>(N_IN);
+        std::vector<T> res = std::vector<T>(N_OUT);
+        std::vector<compressed_weight<T>> weights = std::vector<compressed_weight<T>>(config::n_nonzeros);
+        std::vector<T> biases = std::vector<T>(N_OUT);
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data);
+    fill_random(s->biases);
+    std::vector<T> values(config::n_nonzeros);
+    fill_random(values);
+    for (unsigned i = 0; i < config::n_nonzeros; i++) {
+        // Every other weight of the matrix is kept
+        unsigned index = 2 * i + (i / (N_OUT / 2)) % 2;
+        s->weights[i].row_index = index / N_OUT;
+        s->weights[i].col_index = index % N_OUT;
+        s->weights[i].weight = values[i];
+    }
+
+    register_benchmark("dense", "compressed", type_name<T>(), size_name(N_IN, N_OUT), config::n_nonzeros, [s]() {
+        nnet::dense_compressed<T, T, config>(s->data.data(), s->res.data(), s->weights.data(), s->biases.data());
+        do_not_optimize(s->res[0]);
+    });
+}
+
+template <class T, unsigned N_IN, unsigned N_OUT> void add_dense_stream() {
+    typedef dense_bench_config<T, N_IN, N_OUT, nnet::latency, 1> config;
+    typedef nnet::array<T, N_IN> data_T;
+    typedef nnet::array<T, N_OUT> res_T;
+
+    struct state {
+        std::vector<T> data = std::vector<T>(N_IN);
+        std::vector<T> weights = std::vector<T>(N_IN * N_OUT);
+        std::vector<T> biases = std::vector<T>(N_OUT);
+        hls::stream<data_T> in;
+        hls::stream<res_T> out;
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data);
+    fill_random(s->weights);
+    fill_random(s->biases);
+
+    register_benchmark("dense", "stream", type_name<T>(), size_name(N_IN, N_OUT), N_IN * N_OUT, [s]() {
+        write_stream(s->in, s->data);
+        nnet::dense<data_T, res_T, config>(s->in, s->out, s->weights.data(), s->biases.data());
+        drain_stream(s->out);
+    });
+}
+
+template <class T> void add_dense_types() {
+    add_dense<T, 16, 16, nnet::latency, 1>("latency");
+    add_dense<T, 64, 32, nnet::latency, 1>("latency");
+    add_dense<T, 128, 64, nnet::latency, 1>("latency");
+
+    add_dense<T, 16, 16, nnet::resource, 4>("resource");
+    add_dense<T, 64, 32, nnet::resource, 16>("resource");
+    add_dense<T, 128, 64, nnet::resource, 64>("resource");
+
+    add_dense_compressed<T, 16, 16, 4>();
+    add_dense_compressed<T, 64, 32, 16>();
+    add_dense_compressed<T, 128, 64, 64>();
+
+    add_dense_stream<T, 16, 16>();
+    add_dense_stream<T, 64, 32>();
+}
+
+} // namespace
+
+void register_dense_benchmarks() {
+    add_dense_types<ap_fixed<8, 3>>();
+    add_dense_types<ap_fixed<16, 6>>();
+    add_dense_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
@@ -0,0 +1,205 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_merge.h"
+#include "nnet_utils/nnet_merge_stream.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+// Merge of two (height, width, n_chan) tensors, concatenation is along the channels
+template <unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> struct merge_bench_config : nnet::concat_config {
+    static const unsigned n_elem = HEIGHT * WIDTH * N_CHAN;
+    static const unsigned n_elem1_0 = HEIGHT;
+    static const unsigned n_elem1_1 = WIDTH;
+    static const unsigned n_elem1_2 = N_CHAN;
+    static const unsigned n_elem2_0 = HEIGHT;
+    static const unsigned n_elem2_1 = WIDTH;
+    static const unsigned n_elem2_2 = N_CHAN;
+    static const int axis = -1;
+};
+
+#define MERGE_KERNEL(NAME, FUNC)                                                                                           \
+    struct NAME##_kernel {                                                                                                 \
+        static const char *name() { return #NAME; }                                                                        \
+        template <class input1_T, class input2_T, class res_T, class CONFIG_T>                                             \
+        static void call(input1_T *data1, input2_T *data2, res_T *res) {                                                   \
+            nnet::FUNC<input1_T, input2_T, res_T, CONFIG_T>(data1, data2, res);                                            \
+        }                                                                                                                  \
+        template <class input1_T, class input2_T, class res_T, class CONFIG_T>                                             \
+        static void call(hls::stream<input1_T> &data1, hls::stream<input2_T> &data2, hls::stream<res_T> &res) {            \
+            nnet::FUNC<input1_T, input2_T, res_T, CONFIG_T>(data1, data2, res);                                            \
+        }                                                                                                                  \
+    };
+
+MERGE_KERNEL(add, add)
+MERGE_KERNEL(multiply, multiply)
+MERGE_KERNEL(maximum, maximum)
+MERGE_KERNEL(concatenate, concatenate3d)
+
+#undef MERGE_KERNEL
+
+template <class T, class KERNEL, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> void add_merge() {
+    typedef merge_bench_config<HEIGHT, WIDTH, N_CHAN> config;
+
+    struct state {
+        std::vector<T> data1 = std::vector<T>(config::n_elem);
+        std::vector<T> data2 = std::vector<T>(config::n_elem);
+        std::vector<T> res = std::vector<T>(2 * config::n_elem);
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data1);
+    fill_random(s->data2);
+
+    register_benchmark(KERNEL::name(), "parallel", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        KERNEL::template call<T, T, T, config>(s->data1.data(), s->data2.data(), s->res.data());
+        do_not_optimize(s->res[0]);
+    });
+}
+
+template <class T, class KERNEL, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN, unsigned N_OUT_CHAN>
+void add_merge_stream() {
+    typedef merge_bench_config<HEIGHT, WIDTH, N_CHAN> config;
+    typedef nnet::array<T, N_CHAN> data_T;
+    typedef nnet::array<T, N_OUT_CHAN> res_T;
+
+    struct state {
+        std::vector<T> data1 = std::vector<T>(config::n_elem);
+        std::vector<T> data2 = std::vector<T>(config::n_elem);
+        hls::stream<data_T> in1;
+        hls::stream<data_T> in2;
+        hls::stream<res_T> out;
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    fill_random(s->data1);
+    fill_random(s->data2);
+
+    register_benchmark(KERNEL::name(), "stream", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        write_stream(s->in1, s->data1);
+        write_stream(s->in2, s->data2);
+        KERNEL::template call<data_T, data_T, res_T, config>(s->in1, s->in2, s->out);
+        drain_stream(s->out);
+    });
+}
+
+// Merge of four (height, width, n_chan) tensors, with the N-ary kernels and as a chain of binary kernels
+template <class T, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> struct merge_nary_bench_config : nnet::concat_n_config {
+    typedef T accum_t;
+    static const unsigned n_elem = HEIGHT * WIDTH * N_CHAN;
+    static const unsigned n_inputs = 4;
+    static const unsigned n_outer = HEIGHT * WIDTH;
+    static const unsigned n_inner = 1;
+    static const unsigned n_axis = 4 * N_CHAN;
+    typedef nnet::concat_sizes<N_CHAN, N_CHAN, N_CHAN, N_CHAN> axis_sizes;
+};
+
+template <class T, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> void add_merge_nary() {
+    typedef merge_nary_bench_config<T, HEIGHT, WIDTH, N_CHAN> config;
+    typedef merge_bench_config<HEIGHT, WIDTH, N_CHAN> binary_config;
+
+    struct state {
+        std::vector<T> data[4];
+        std::vector<T> tmp1 = std::vector<T>(config::n_elem);
+        std::vector<T> tmp2 = std::vector<T>(config::n_elem);
+        std::vector<T> res = std::vector<T>(4 * config::n_elem);
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    for (auto &data : s->data) {
+        data.resize(config::n_elem);
+        fill_random(data);
+    }
+
+    register_benchmark("add_n4", "parallel", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        nnet::add_n<T, config>(s->res.data(), s->data[0].data(), s->data[1].data(), s->data[2].data(),
+                                   s->data[3].data());
+        do_not_optimize(s->res[0]);
+    });
+    register_benchmark("add_chain4", "parallel", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        nnet::add<T, T, T, binary_config>(s->data[0].data(), s->data[1].data(), s->tmp1.data());
+        nnet::add<T, T, T, binary_config>(s->tmp1.data(), s->data[2].data(), s->tmp2.data());
+        nnet::add<T, T, T, binary_config>(s->tmp2.data(), s->data[3].data(), s->res.data());
+        do_not_optimize(s->res[0]);
+    });
+    register_benchmark("concatenate_n4", "parallel", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem,
+                       [s]() {
+                           nnet::concatenate_n<T, config>(s->res.data(), s->data[0].data(), s->data[1].data(),
+                                                          s->data[2].data(), s->data[3].data());
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> void add_merge_nary_stream() {
+    typedef merge_nary_bench_config<T, HEIGHT, WIDTH, N_CHAN> config;
+    typedef merge_bench_config<HEIGHT, WIDTH, N_CHAN> binary_config;
+    typedef nnet::array<T, N_CHAN> data_T;
+    typedef nnet::array<T, 4 * N_CHAN> concat_T;
+
+    struct state {
+        std::vector<T> data[4];
+        hls::stream<data_T> in[4];
+        hls::stream<data_T> tmp1;
+        hls::stream<data_T> tmp2;
+        hls::stream<data_T> out;
+        hls::stream<concat_T> concat_out;
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+    for (auto &data : s->data) {
+        data.resize(config::n_elem);
+        fill_random(data);
+    }
+
+    register_benchmark("add_n4", "stream", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        for (unsigned i = 0; i < 4; i++) {
+            write_stream(s->in[i], s->data[i]);
+        }
+        nnet::add_n<data_T, config>(s->out, s->in[0], s->in[1], s->in[2], s->in[3]);
+        drain_stream(s->out);
+    });
+    register_benchmark("add_chain4", "stream", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem, [s]() {
+        for (unsigned i = 0; i < 4; i++) {
+            write_stream(s->in[i], s->data[i]);
+        }
+        nnet::add<data_T, data_T, data_T, binary_config>(s->in[0], s->in[1], s->tmp1);
+        nnet::add<data_T, data_T, data_T, binary_config>(s->tmp1, s->in[2], s->tmp2);
+        nnet::add<data_T, data_T, data_T, binary_config>(s->tmp2, s->in[3], s->out);
+        drain_stream(s->out);
+    });
+    register_benchmark("concatenate_n4", "stream", type_name<T>(), size_name(HEIGHT, WIDTH, N_CHAN), config::n_elem,
+                       [s]() {
+                           for (unsigned i = 0; i < 4; i++) {
+                               write_stream(s->in[i], s->data[i]);
+                           }
+                           nnet::concatenate_n<concat_T, config>(s->concat_out, s->in[0], s->in[1], s->in[2], s->in[3]);
+                           drain_stream(s->concat_out);
+                       });
+}
+
+template <class T, unsigned HEIGHT, unsigned WIDTH, unsigned N_CHAN> void add_merge_sizes() {
+    add_merge<T, add_kernel, HEIGHT, WIDTH, N_CHAN>();
+    add_merge<T, multiply_kernel, HEIGHT, WIDTH, N_CHAN>();
+    add_merge<T, maximum_kernel, HEIGHT, WIDTH, N_CHAN>();
+    add_merge<T, concatenate_kernel, HEIGHT, WIDTH, N_CHAN>();
+
+    add_merge_stream<T, add_kernel, HEIGHT, WIDTH, N_CHAN, N_CHAN>();
+    add_merge_stream<T, multiply_kernel, HEIGHT, WIDTH, N_CHAN, N_CHAN>();
+    add_merge_stream<T, maximum_kernel, HEIGHT, WIDTH, N_CHAN, N_CHAN>();
+    add_merge_stream<T, concatenate_kernel, HEIGHT, WIDTH, N_CHAN, 2 * N_CHAN>();
+
+    add_merge_nary<T, HEIGHT, WIDTH, N_CHAN>();
+    add_merge_nary_stream<T, HEIGHT, WIDTH, N_CHAN>();
+}
+
+template <class T> void add_merge_types() {
+    add_merge_sizes<T, 1, 1, 64>();
+    add_merge_sizes<T, 16, 16, 16>();
+}
+
+} // namespace
+
+void register_merge_benchmarks() {
+    add_merge_types<ap_fixed<8, 3>>();
+    add_merge_types<ap_fixed<16, 6>>();
+    add_merge_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
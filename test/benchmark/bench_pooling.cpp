@@ -0,0 +1,122 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_pooling.h"
+#include "nnet_utils/nnet_pooling_stream.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+// 2x2 pooling with stride 2
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_FILT, nnet::Pool_Op POOL_OP, nnet::conv_implementation IMPL>
+struct pooling2d_bench_config : nnet::pooling2d_config {
+    static const unsigned in_height = IN_H;
+    static const unsigned in_width = IN_W;
+    static const unsigned n_filt = N_FILT;
+    static const unsigned stride_height = 2;
+    static const unsigned stride_width = 2;
+    static const unsigned pool_height = 2;
+    static const unsigned pool_width = 2;
+
+    static const unsigned filt_height = pool_height;
+    static const unsigned filt_width = pool_width;
+    static const unsigned n_chan = n_filt;
+
+    static const unsigned out_height = IN_H / 2;
+    static const unsigned out_width = IN_W / 2;
+    static const unsigned pad_top = 0;
+    static const unsigned pad_bottom = 0;
+    static const unsigned pad_left = 0;
+    static const unsigned pad_right = 0;
+    static const bool count_pad = false;
+    static const nnet::Pool_Op pool_op = POOL_OP;
+    static const nnet::conv_implementation implementation = IMPL;
+    static const unsigned reuse_factor = 1;
+    typedef T accum_t;
+};
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_FILT, nnet::Pool_Op POOL_OP>
+struct global_pooling2d_bench_config : nnet::pooling2d_config {
+    static const unsigned in_height = IN_H;
+    static const unsigned in_width = IN_W;
+    static const unsigned n_filt = N_FILT;
+    static const nnet::Pool_Op pool_op = POOL_OP;
+    static const unsigned reuse_factor = 1;
+    typedef T accum_t;
+};
+
+const char *pool_op_name(nnet::Pool_Op op) { return op == nnet::Max ? "max" : "average"; }
+
+template <class T> struct pooling_state {
+    std::vector<T> data;
+    std::vector<T> res;
+    pooling_state(unsigned n_in, unsigned n_out) : data(n_in), res(n_out) { fill_random(data); }
+};
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_FILT, nnet::Pool_Op POOL_OP> void add_pooling2d() {
+    typedef pooling2d_bench_config<T, IN_H, IN_W, N_FILT, POOL_OP, nnet::conv_implementation::linebuffer> config;
+    std::shared_ptr<pooling_state<T>> s =
+        std::make_shared<pooling_state<T>>(IN_H * IN_W * N_FILT, config::out_height * config::out_width * N_FILT);
+
+    register_benchmark("pooling2d", pool_op_name(POOL_OP), type_name<T>(), size_name(IN_H, IN_W, N_FILT),
+                       IN_H * IN_W * N_FILT, [s]() {
+                           nnet::pooling2d_cl<T, T, config>(s->data.data(), s->res.data());
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_FILT, nnet::Pool_Op POOL_OP, nnet::conv_implementation IMPL>
+void add_pooling2d_stream(const char *impl_name) {
+    typedef pooling2d_bench_config<T, IN_H, IN_W, N_FILT, POOL_OP, IMPL> config;
+    typedef nnet::array<T, N_FILT> data_T;
+
+    struct state : pooling_state<T> {
+        hls::stream<data_T> in;
+        hls::stream<data_T> out;
+        state() : pooling_state<T>(IN_H * IN_W * N_FILT, 0) {}
+    };
+    std::shared_ptr<state> s = std::make_shared<state>();
+
+    register_benchmark("pooling2d", std::string(pool_op_name(POOL_OP)) + "_" + impl_name, type_name<T>(),
+                       size_name(IN_H, IN_W, N_FILT), IN_H * IN_W * N_FILT, [s]() {
+                           write_stream(s->in, s->data);
+                           nnet::pooling2d_cl<data_T, data_T, config>(s->in, s->out);
+                           drain_stream(s->out);
+                       });
+}
+
+template <class T, unsigned IN_H, unsigned IN_W, unsigned N_FILT, nnet::Pool_Op POOL_OP> void add_global_pooling2d() {
+    typedef global_pooling2d_bench_config<T, IN_H, IN_W, N_FILT, POOL_OP> config;
+    std::shared_ptr<pooling_state<T>> s = std::make_shared<pooling_state<T>>(IN_H * IN_W * N_FILT, N_FILT);
+
+    register_benchmark("global_pooling2d", pool_op_name(POOL_OP), type_name<T>(), size_name(IN_H, IN_W, N_FILT),
+                       IN_H * IN_W * N_FILT, [s]() {
+                           nnet::global_pooling2d_cl<T, T, config>(s->data.data(), s->res.data());
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T> void add_pooling_types() {
+    add_pooling2d<T, 16, 16, 8, nnet::Max>();
+    add_pooling2d<T, 32, 32, 16, nnet::Max>();
+    add_pooling2d<T, 16, 16, 8, nnet::Average>();
+    add_pooling2d<T, 32, 32, 16, nnet::Average>();
+
+    add_pooling2d_stream<T, 16, 16, 8, nnet::Max, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_pooling2d_stream<T, 32, 32, 16, nnet::Max, nnet::conv_implementation::linebuffer>("linebuffer");
+    add_pooling2d_stream<T, 16, 16, 8, nnet::Max, nnet::conv_implementation::encoded>("encoded");
+    add_pooling2d_stream<T, 32, 32, 16, nnet::Max, nnet::conv_implementation::encoded>("encoded");
+
+    add_global_pooling2d<T, 16, 16, 8, nnet::Max>();
+    add_global_pooling2d<T, 16, 16, 8, nnet::Average>();
+}
+
+} // namespace
+
+void register_pooling_benchmarks() {
+    add_pooling_types<ap_fixed<8, 3>>();
+    add_pooling_types<ap_fixed<16, 6>>();
+    add_pooling_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
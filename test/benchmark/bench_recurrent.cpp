@@ -0,0 +1,172 @@
+#include "benchmark.h"
+#include "nnet_utils/nnet_recurrent.h"
+#include <memory>
+
+namespace nnet_bench {
+
+namespace {
+
+template <class T, unsigned N_IN, unsigned N_OUT, unsigned STRATEGY, unsigned RF>
+struct recr_mult_bench_config : nnet::dense_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned n_out = N_OUT;
+    static const unsigned strategy = STRATEGY;
+    static const unsigned reuse_factor = RF;
+    static const unsigned n_zeros = 0;
+    static const unsigned n_nonzeros = N_IN * N_OUT;
+    static const unsigned multiplier_limit = DIV_ROUNDUP(n_in * n_out, reuse_factor) - n_zeros / reuse_factor;
+    static const bool store_weights_in_bram = false;
+    typedef T accum_t;
+    typedef T bias_t;
+    typedef T weight_t;
+    typedef ap_uint<1> index_t;
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+template <unsigned N_IN> struct recr_activ_bench_config : nnet::activ_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned table_size = 1024;
+    static const unsigned io_type = nnet::io_parallel;
+    static const unsigned reuse_factor = 1;
+    typedef ap_fixed<18, 8> table_t;
+};
+
+// N_GATES is 4 for LSTM and 3 for GRU
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE, unsigned IO_TYPE, bool STATIC>
+struct recr_bench_config : nnet::lstm_config {
+    typedef T accum_t;
+    typedef T weight_t;
+    typedef T bias_t;
+    typedef recr_mult_bench_config<T, N_IN, N_STATE * N_GATES, nnet::latency, 1> mult_config1;
+    typedef recr_mult_bench_config<T, N_STATE, N_STATE * N_GATES, nnet::latency, 1> mult_config2;
+    typedef recr_activ_bench_config<N_STATE *(N_GATES - 1)> ACT_CONFIG_LSTM;
+    typedef recr_activ_bench_config<N_STATE *(N_GATES - 1)> ACT_CONFIG_GRU;
+    template <class x_T, class y_T, class config_T> using activation_recr = nnet::activation::sigmoid<x_T, y_T, config_T>;
+    typedef recr_activ_bench_config<N_STATE> ACT_CONFIG_T;
+    template <class x_T, class y_T, class config_T> using activation = nnet::activation::tanh<x_T, y_T, config_T>;
+    static const unsigned n_in = N_IN;
+    static const unsigned n_out = N_STATE;
+    static const unsigned n_state = N_STATE;
+    static const unsigned n_sequence = N_SEQ;
+    static const unsigned n_sequence_out = 1;
+    static const unsigned io_type = IO_TYPE;
+    static const unsigned reuse_factor = 1;
+    static const bool store_weights_in_bram = false;
+    static const bool use_static = STATIC;
+};
+
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE, unsigned IO_TYPE, unsigned N_INTERLEAVE>
+struct recr_interleaved_bench_config : recr_bench_config<T, N_GATES, N_SEQ, N_IN, N_STATE, IO_TYPE, true> {
+    static const unsigned n_interleave = N_INTERLEAVE;
+};
+
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE, unsigned N_INTERLEAVE = 1>
+struct recr_state {
+    std::vector<T> data = std::vector<T>(N_INTERLEAVE * N_SEQ * N_IN);
+    std::vector<T> res = std::vector<T>(N_INTERLEAVE * N_STATE);
+    std::vector<T> weights = std::vector<T>(N_STATE * N_GATES * N_IN);
+    std::vector<T> recr_weights = std::vector<T>(N_STATE * N_GATES * N_STATE);
+    std::vector<T> biases = std::vector<T>(N_STATE * N_GATES);
+    std::vector<T> recr_biases = std::vector<T>(N_STATE * N_GATES);
+    hls::stream<nnet::array<T, N_IN>> in;
+    hls::stream<nnet::array<T, N_STATE>> out;
+
+    recr_state() {
+        fill_random(data);
+        fill_random(weights, -0.5, 0.5);
+        fill_random(recr_weights, -0.5, 0.5);
+        fill_random(biases, -0.5, 0.5);
+        fill_random(recr_biases, -0.5, 0.5);
+    }
+};
+
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE, bool STATIC>
+void add_recurrent(const char *variant) {
+    typedef recr_bench_config<T, N_GATES, N_SEQ, N_IN, N_STATE, nnet::io_parallel, STATIC> config;
+    typedef recr_state<T, N_GATES, N_SEQ, N_IN, N_STATE> state;
+    std::shared_ptr<state> s = std::make_shared<state>();
+
+    register_benchmark(N_GATES == 4 ? "lstm" : "gru", variant, type_name<T>(), size_name(N_SEQ, N_IN, N_STATE),
+                       N_SEQ * N_GATES * N_STATE * (N_IN + N_STATE), [s]() {
+                           if (N_GATES == 4) {
+                               nnet::lstm_stack<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                              s->recr_weights.data(), s->biases.data(),
+                                                              s->recr_biases.data());
+                           } else {
+                               nnet::gru_stack<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                             s->recr_weights.data(), s->biases.data(),
+                                                             s->recr_biases.data());
+                           }
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE> void add_recurrent_stream() {
+    typedef recr_bench_config<T, N_GATES, N_SEQ, N_IN, N_STATE, nnet::io_stream, true> config;
+    typedef nnet::array<T, N_IN> data_T;
+    typedef nnet::array<T, N_STATE> res_T;
+    typedef recr_state<T, N_GATES, N_SEQ, N_IN, N_STATE> state;
+    std::shared_ptr<state> s = std::make_shared<state>();
+
+    register_benchmark(N_GATES == 4 ? "lstm" : "gru", "stream", type_name<T>(), size_name(N_SEQ, N_IN, N_STATE),
+                       N_SEQ * N_GATES * N_STATE * (N_IN + N_STATE), [s]() {
+                           write_stream(s->in, s->data);
+                           if (N_GATES == 4) {
+                               nnet::lstm_stack<data_T, res_T, config>(s->in, s->out, s->weights.data(),
+                                                                       s->recr_weights.data(), s->biases.data(),
+                                                                       s->recr_biases.data());
+                           } else {
+                               nnet::gru_stack<data_T, res_T, config>(s->in, s->out, s->weights.data(),
+                                                                      s->recr_weights.data(), s->biases.data(),
+                                                                      s->recr_biases.data());
+                           }
+                           drain_stream(s->out);
+                       });
+}
+
+// The interleaved stacks process N_INTERLEAVE sequences per call
+template <class T, unsigned N_GATES, unsigned N_SEQ, unsigned N_IN, unsigned N_STATE, unsigned N_INTERLEAVE>
+void add_recurrent_interleaved() {
+    typedef recr_interleaved_bench_config<T, N_GATES, N_SEQ, N_IN, N_STATE, nnet::io_parallel, N_INTERLEAVE> config;
+    typedef recr_state<T, N_GATES, N_SEQ, N_IN, N_STATE, N_INTERLEAVE> state;
+    std::shared_ptr<state> s = std::make_shared<state>();
+
+    register_benchmark(N_GATES == 4 ? "lstm" : "gru", "interleaved", type_name<T>(), size_name(N_SEQ, N_IN, N_STATE),
+                       N_INTERLEAVE * N_SEQ * N_GATES * N_STATE * (N_IN + N_STATE), [s]() {
+                           if (N_GATES == 4) {
+                               nnet::lstm_stack_interleaved<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                                          s->recr_weights.data(), s->biases.data(),
+                                                                          s->recr_biases.data());
+                           } else {
+                               nnet::gru_stack_interleaved<T, T, config>(s->data.data(), s->res.data(), s->weights.data(),
+                                                                         s->recr_weights.data(), s->biases.data(),
+                                                                         s->recr_biases.data());
+                           }
+                           do_not_optimize(s->res[0]);
+                       });
+}
+
+template <class T, unsigned N_GATES> void add_recurrent_sizes() {
+    add_recurrent<T, N_GATES, 8, 8, 16, false>("latency");
+    add_recurrent<T, N_GATES, 32, 16, 32, false>("latency");
+    add_recurrent<T, N_GATES, 8, 8, 16, true>("static");
+    add_recurrent<T, N_GATES, 32, 16, 32, true>("static");
+    add_recurrent_stream<T, N_GATES, 8, 8, 16>();
+    add_recurrent_stream<T, N_GATES, 32, 16, 32>();
+    add_recurrent_interleaved<T, N_GATES, 8, 8, 16, 4>();
+}
+
+template <class T> void add_recurrent_types() {
+    add_recurrent_sizes<T, 4>();
+    add_recurrent_sizes<T, 3>();
+}
+
+} // namespace
+
+void register_recurrent_benchmarks() {
+    add_recurrent_types<ap_fixed<8, 3>>();
+    add_recurrent_types<ap_fixed<16, 6>>();
+    add_recurrent_types<ap_fixed<24, 10>>();
+}
+
+} // namespace nnet_bench
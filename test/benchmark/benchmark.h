@@ -0,0 +1,86 @@
+#ifndef NNET_BENCHMARK_H_
+#define NNET_BENCHMARK_H_
+
+#include "ap_fixed.h"
+#include "hls_stream.h"
+#include "nnet_utils/nnet_helpers.h"
+#include "nnet_utils/nnet_types.h"
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace nnet_bench {
+
+// A single kernel instantiation, `run` performs one call (one sample) of the kernel
+struct benchmark {
+    std::string kernel;
+    std::string variant;
+    std::string type;
+    std::string size;
+    unsigned long long ops; // Multiply-accumulates (or processed elements for kernels without weights) per call
+    std::function<void()> run;
+
+    std::string name() const { return kernel + "/" + variant + "/" + type + "/" + size; }
+};
+
+std::vector<benchmark> &registry();
+
+void register_benchmark(const std::string &kernel, const std::string &variant, const std::string &type,
+                        const std::string &size, unsigned long long ops, std::function<void()> run);
+
+// Each file adds its kernels to the registry
+void register_dense_benchmarks();
+void register_conv_benchmarks();
+void register_pooling_benchmarks();
+void register_activation_benchmarks();
+void register_recurrent_benchmarks();
+void register_merge_benchmarks();
+
+template <class T> std::string type_name() {
+    return "ap_fixed<" + std::to_string(T::width) + "," + std::to_string(T::iwidth) + ">";
+}
+
+inline std::string size_name(unsigned a, unsigned b) { return std::to_string(a) + "x" + std::to_string(b); }
+
+inline std::string size_name(unsigned a, unsigned b, unsigned c) { return size_name(a, b) + "x" + std::to_string(c); }
+
+inline std::mt19937 &rng() {
+    static std::mt19937 gen(42);
+    return gen;
+}
+
+template <class T> void fill_random(T *x, unsigned n, double lo = -1.0, double hi = 1.0) {
+    std::uniform_real_distribution<double> dist(lo, hi);
+    for (unsigned i = 0; i < n; i++) {
+        x[i] = dist(rng());
+    }
+}
+
+template <class T> void fill_random(std::vector<T> &x, double lo = -1.0, double hi = 1.0) {
+    fill_random(x.data(), x.size(), lo, hi);
+}
+
+// Prevents the compiler from discarding the results of a kernel
+template <class T> inline void do_not_optimize(const T &value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+template <class T> void write_stream(hls::stream<T> &stream, const std::vector<typename T::value_type> &data) {
+    for (unsigned i = 0; i < data.size() / T::size; i++) {
+        T pack;
+        for (unsigned j = 0; j < T::size; j++) {
+            pack[j] = data[i * T::size + j];
+        }
+        stream.write(pack);
+    }
+}
+
+template <class T> void drain_stream(hls::stream<T> &stream) {
+    while (!stream.empty()) {
+        T pack = stream.read();
+        do_not_optimize(pack);
+    }
+}
+
+} // namespace nnet_bench
+
+#endif
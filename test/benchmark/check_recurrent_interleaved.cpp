@@ -0,0 +1,145 @@
+// C simulation check of the interleaved LSTM/GRU stacks: every sequence must give exactly the same result as
+// lstm_stack/gru_stack run on that sequence alone.
+#include "benchmark.h"
+#include "nnet_utils/nnet_recurrent.h"
+#include <cstdio>
+
+namespace {
+
+typedef ap_fixed<16, 6> data_t;
+
+template <unsigned N_IN, unsigned N_OUT> struct check_mult_config : nnet::dense_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned n_out = N_OUT;
+    static const unsigned strategy = nnet::latency;
+    static const unsigned reuse_factor = 1;
+    static const unsigned n_zeros = 0;
+    static const unsigned n_nonzeros = N_IN * N_OUT;
+    static const unsigned multiplier_limit = N_IN * N_OUT;
+    static const bool store_weights_in_bram = false;
+    typedef data_t accum_t;
+    typedef data_t bias_t;
+    typedef data_t weight_t;
+    typedef ap_uint<1> index_t;
+    template <class x_T, class y_T> using product = nnet::product::mult<x_T, y_T>;
+};
+
+template <unsigned N_IN> struct check_activ_config : nnet::activ_config {
+    static const unsigned n_in = N_IN;
+    static const unsigned table_size = 1024;
+    static const unsigned io_type = nnet::io_parallel;
+    static const unsigned reuse_factor = 1;
+    typedef ap_fixed<18, 8> table_t;
+};
+
+// N_GATES is 4 for LSTM and 3 for GRU
+template <unsigned N_GATES, unsigned N_SEQ_OUT> struct check_config : nnet::lstm_config {
+    static const unsigned n_in = 6;
+    static const unsigned n_out = 8;
+    static const unsigned n_state = 8;
+    static const unsigned n_sequence = 10;
+    static const unsigned n_sequence_out = N_SEQ_OUT;
+    static const unsigned n_interleave = 4;
+    static const unsigned io_type = nnet::io_parallel;
+    static const bool use_static = true;
+    // The stacks require the accumulator to have the same type as the data
+    typedef data_t accum_t;
+    typedef data_t weight_t;
+    typedef data_t bias_t;
+    typedef check_mult_config<n_in, n_state * N_GATES> mult_config1;
+    typedef check_mult_config<n_state, n_state * N_GATES> mult_config2;
+    typedef check_activ_config<n_state *(N_GATES - 1)> ACT_CONFIG_LSTM;
+    typedef check_activ_config<n_state *(N_GATES - 1)> ACT_CONFIG_GRU;
+    template <class x_T, class y_T, class config_T> using activation_recr = nnet::activation::sigmoid<x_T, y_T, config_T>;
+    typedef check_activ_config<n_state> ACT_CONFIG_T;
+    template <class x_T, class y_T, class config_T> using activation = nnet::activation::tanh<x_T, y_T, config_T>;
+};
+
+template <unsigned N_GATES, unsigned N_SEQ_OUT> bool check() {
+    typedef check_config<N_GATES, N_SEQ_OUT> config;
+    const unsigned n_seq_in = config::n_sequence * config::n_in;
+    const unsigned n_seq_out = config::n_sequence_out * config::n_state;
+    const unsigned n_weights = config::n_state * N_GATES;
+
+    std::vector<data_t> data(config::n_interleave * n_seq_in);
+    std::vector<data_t> weights(n_weights * config::n_in), recr_weights(n_weights * config::n_state);
+    std::vector<data_t> biases(n_weights), recr_biases(n_weights);
+    nnet_bench::fill_random(data, -2.0, 2.0);
+    nnet_bench::fill_random(weights, -0.5, 0.5);
+    nnet_bench::fill_random(recr_weights, -0.5, 0.5);
+    nnet_bench::fill_random(biases, -0.5, 0.5);
+    nnet_bench::fill_random(recr_biases, -0.5, 0.5);
+
+    // One sequence at a time
+    std::vector<data_t> res_ref(config::n_interleave * n_seq_out);
+    for (unsigned i_seq = 0; i_seq < config::n_interleave; i_seq++) {
+        if (N_GATES == 4) {
+            nnet::lstm_stack<data_t, data_t, config>(&data[i_seq * n_seq_in], &res_ref[i_seq * n_seq_out], weights.data(),
+                                                     recr_weights.data(), biases.data(), recr_biases.data());
+        } else {
+            nnet::gru_stack<data_t, data_t, config>(&data[i_seq * n_seq_in], &res_ref[i_seq * n_seq_out], weights.data(),
+                                                    recr_weights.data(), biases.data(), recr_biases.data());
+        }
+    }
+
+    // Interleaved, io_parallel
+    std::vector<data_t> res(config::n_interleave * n_seq_out);
+    if (N_GATES == 4) {
+        nnet::lstm_stack_interleaved<data_t, data_t, config>(data.data(), res.data(), weights.data(), recr_weights.data(),
+                                                             biases.data(), recr_biases.data());
+    } else {
+        nnet::gru_stack_interleaved<data_t, data_t, config>(data.data(), res.data(), weights.data(), recr_weights.data(),
+                                                            biases.data(), recr_biases.data());
+    }
+
+    // Interleaved, io_stream
+    typedef nnet::array<data_t, config::n_in> data_T;
+    typedef nnet::array<data_t, config::n_state> res_T;
+    hls::stream<data_T> in;
+    hls::stream<res_T> out;
+    for (unsigned iloop = 0; iloop < config::n_sequence; iloop++) {
+        for (unsigned i_seq = 0; i_seq < config::n_interleave; i_seq++) {
+            data_T pack;
+            for (unsigned j = 0; j < config::n_in; j++) {
+                pack[j] = data[i_seq * n_seq_in + iloop * config::n_in + j];
+            }
+            in.write(pack);
+        }
+    }
+    if (N_GATES == 4) {
+        nnet::lstm_stack_interleaved<data_T, res_T, config>(in, out, weights.data(), recr_weights.data(), biases.data(),
+                                                            recr_biases.data());
+    } else {
+        nnet::gru_stack_interleaved<data_T, res_T, config>(in, out, weights.data(), recr_weights.data(), biases.data(),
+                                                           recr_biases.data());
+    }
+    std::vector<data_t> res_stream(config::n_interleave * n_seq_out);
+    for (unsigned iloop = 0; iloop < config::n_sequence_out; iloop++) {
+        for (unsigned i_seq = 0; i_seq < config::n_interleave; i_seq++) {
+            res_T pack = out.read();
+            for (unsigned j = 0; j < config::n_state; j++) {
+                res_stream[i_seq * n_seq_out + iloop * config::n_state + j] = pack[j];
+            }
+        }
+    }
+
+    unsigned n_mismatch = 0;
+    for (unsigned i = 0; i < res_ref.size(); i++) {
+        if (res[i] != res_ref[i] || res_stream[i] != res_ref[i]) {
+            n_mismatch++;
+        }
+    }
+    std::printf("%s, n_sequence_out = %u: %u mismatches\n", N_GATES == 4 ? "lstm" : "gru", N_SEQ_OUT, n_mismatch);
+    return n_mismatch == 0 && in.empty() && out.empty();
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok &= check<4, 1>();
+    ok &= check<4, 10>();
+    ok &= check<3, 1>();
+    ok &= check<3, 10>();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+"""Compares the results of two runs of nnet_benchmark.
+
+Example:
+    ./nnet_benchmark --output baseline.json
+    # ... change the templates and rebuild ...
+    ./nnet_benchmark --output current.json
+    python compare.py baseline.json current.json --threshold 0.1
+
+Exits with a non-zero status if any benchmark is slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return {bench['name']: bench for bench in data['benchmarks']}
+
+
+def compare(baseline, current, threshold, filter_str=None):
+    rows = []
+    regressions = []
+    for name, bench in current.items():
+        if filter_str is not None and filter_str not in name:
+            continue
+        if name not in baseline:
+            rows.append((name, None, bench['ns_per_call'], None, 'new'))
+            continue
+        base_ns = baseline[name]['ns_per_call']
+        ratio = bench['ns_per_call'] / base_ns
+        if ratio > 1 + threshold:
+            status = 'SLOWER'
+            regressions.append(name)
+        elif ratio < 1 / (1 + threshold):
+            status = 'faster'
+        else:
+            status = ''
+        rows.append((name, base_ns, bench['ns_per_call'], ratio, status))
+
+    missing = [name for name in baseline if name not in current and (filter_str is None or filter_str in name)]
+
+    return rows, regressions, missing
+
+
+def print_table(rows):
+    name_width = max([len('Benchmark')] + [len(row[0]) for row in rows])
+    print(f'{"Benchmark":<{name_width}} {"Baseline [ns]":>14} {"Current [ns]":>14} {"Ratio":>8}')
+    for name, base_ns, curr_ns, ratio, status in rows:
+        base_str = f'{base_ns:14.1f}' if base_ns is not None else f'{"-":>14}'
+        ratio_str = f'{ratio:8.3f}' if ratio is not None else f'{"-":>8}'
+        print(f'{name:<{name_width}} {base_str} {curr_ns:14.1f} {ratio_str} {status}'.rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare the results of nnet_benchmark against a baseline')
+    parser.add_argument('baseline', help='JSON results of the baseline run')
+    parser.add_argument('current', help='JSON results of the current run')
+    parser.add_argument(
+        '-t', '--threshold', type=float, default=0.1, help='Relative slowdown reported as a regression (default: 0.1)'
+    )
+    parser.add_argument('-f', '--filter', default=None, help='Only compare benchmarks whose name contains this string')
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+    rows, regressions, missing = compare(baseline, current, args.threshold, args.filter)
+
+    print_table(rows)
+    for name in missing:
+        print(f'Missing from current results: {name}')
+
+    if len(regressions) > 0:
+        print(f'\n{len(regressions)} benchmark(s) slower than the baseline by more than {args.threshold:.0%}')
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,188 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace nnet_bench {
+
+std::vector<benchmark> &registry() {
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+void register_benchmark(const std::string &kernel, const std::string &variant, const std::string &type,
+                        const std::string &size, unsigned long long ops, std::function<void()> run) {
+    benchmark bench;
+    bench.kernel = kernel;
+    bench.variant = variant;
+    bench.type = type;
+    bench.size = size;
+    bench.ops = ops;
+    bench.run = run;
+    registry().push_back(bench);
+}
+
+} // namespace nnet_bench
+
+namespace {
+
+struct options {
+    std::string filter;
+    std::string output;
+    double min_time = 0.2;
+    unsigned repeats = 3;
+    bool list = false;
+};
+
+struct measurement {
+    const nnet_bench::benchmark *bench;
+    unsigned long long iterations;
+    double ns_per_call;
+};
+
+void print_usage(const char *prog) {
+    std::cout << "Usage: " << prog << " [options]\n"
+              << "  --filter <str>    Only run benchmarks whose name contains <str>\n"
+              << "  --min-time <sec>  Minimum duration of each timed repetition (default 0.2)\n"
+              << "  --repeats <n>     Number of timed repetitions, the fastest is reported (default 3)\n"
+              << "  --quick           Short run for smoke testing (--min-time 0.001 --repeats 1)\n"
+              << "  --output <file>   Write the results to <file> in JSON format\n"
+              << "  --list            List the available benchmarks and exit\n";
+}
+
+double time_calls(const nnet_bench::benchmark &bench, unsigned long long n) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < n; i++) {
+        bench.run();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+measurement measure(const nnet_bench::benchmark &bench, const options &opts) {
+    // Warm up (lookup tables, static buffers) and find the number of calls needed for the minimum duration
+    unsigned long long n = 1;
+    double elapsed = time_calls(bench, n);
+    while (elapsed < opts.min_time) {
+        double scale = elapsed > 0 ? 1.5 * opts.min_time / elapsed : 10;
+        n = std::max(n + 1, (unsigned long long)(n * std::min(scale, 10.0)));
+        elapsed = time_calls(bench, n);
+    }
+
+    double best = elapsed / n;
+    for (unsigned r = 1; r < opts.repeats; r++) {
+        best = std::min(best, time_calls(bench, n) / n);
+    }
+
+    measurement m;
+    m.bench = &bench;
+    m.iterations = n;
+    m.ns_per_call = best * 1e9;
+    return m;
+}
+
+std::string escape(const std::string &str) {
+    std::string out;
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+void write_json(const std::string &filename, const std::vector<measurement> &results, const options &opts) {
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "ERROR: cannot open " << filename << " for writing" << std::endl;
+        exit(1);
+    }
+
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"context\": {\n";
+#ifdef __VERSION__
+    out << "    \"compiler\": \"" << escape(__VERSION__) << "\",\n";
+#endif
+    out << "    \"min_time\": " << opts.min_time << ",\n";
+    out << "    \"repeats\": " << opts.repeats << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const measurement &m = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"name\": \"" << escape(m.bench->name()) << "\", ";
+        out << "\"kernel\": \"" << m.bench->kernel << "\", ";
+        out << "\"variant\": \"" << m.bench->variant << "\", ";
+        out << "\"type\": \"" << escape(m.bench->type) << "\", ";
+        out << "\"size\": \"" << m.bench->size << "\", ";
+        out << "\"iterations\": " << m.iterations << ", ";
+        out << "\"ns_per_call\": " << m.ns_per_call << ", ";
+        out << "\"calls_per_second\": " << 1e9 / m.ns_per_call << ", ";
+        out << "\"ops_per_second\": " << m.bench->ops * 1e9 / m.ns_per_call << "}";
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--filter" && has_value) {
+            opts.filter = argv[++i];
+        } else if (arg == "--min-time" && has_value) {
+            opts.min_time = std::atof(argv[++i]);
+        } else if (arg == "--repeats" && has_value) {
+            opts.repeats = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--quick") {
+            opts.min_time = 0.001;
+            opts.repeats = 1;
+        } else if (arg == "--output" && has_value) {
+            opts.output = argv[++i];
+        } else if (arg == "--list") {
+            opts.list = true;
+        } else {
+            print_usage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    nnet_bench::register_dense_benchmarks();
+    nnet_bench::register_conv_benchmarks();
+    nnet_bench::register_pooling_benchmarks();
+    nnet_bench::register_activation_benchmarks();
+    nnet_bench::register_recurrent_benchmarks();
+    nnet_bench::register_merge_benchmarks();
+
+    std::vector<measurement> results;
+    for (const nnet_bench::benchmark &bench : nnet_bench::registry()) {
+        if (bench.name().find(opts.filter) == std::string::npos) {
+            continue;
+        }
+        if (opts.list) {
+            std::cout << bench.name() << std::endl;
+            continue;
+        }
+        measurement m = measure(bench, opts);
+        std::cout << std::left << std::setw(64) << bench.name() << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << m.ns_per_call << " ns/call" << std::setw(12) << std::setprecision(3)
+                  << bench.ops / m.ns_per_call << " Gop/s" << std::endl;
+        results.push_back(m);
+    }
+
+    if (!opts.output.empty()) {
+        write_json(opts.output, results, opts);
+    }
+
+    return 0;
+}
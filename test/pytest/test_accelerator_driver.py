@@ -0,0 +1,66 @@
+import importlib.util
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+test_root_path = Path(__file__).parent
+driver_path = test_root_path / '../../hls4ml/templates/vivado_accelerator/buffered_driver.py'
+
+
+@pytest.fixture(scope='module')
+def driver():
+    spec = importlib.util.spec_from_file_location('buffered_driver', driver_path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+@pytest.mark.parametrize(
+    'precision, expected',
+    [
+        ('ap_fixed<16,6>', [0, 1024, -1, -1024, -40960 + 65536, 32768 - 65536]),
+        ('ap_fixed<16,6,AP_RND,AP_SAT>', [0, 1024, 0, -1024, -32768, 32767]),
+        ('ap_ufixed<8,4,AP_TRN,AP_SAT>', [0, 16, 0, 0, 0, 255]),
+    ],
+)
+def test_codec(driver, precision, expected):
+    codec = driver.FixedPointCodec.from_precision(precision)
+    x = np.array([0.0, 1.0, -0.0004, -1.0, -40.0, 32.0])
+    encoded = np.empty(len(x), dtype=codec.dtype)
+    codec.encode(x, encoded, np.empty(len(x)))
+    np.testing.assert_array_equal(encoded, expected)
+
+    decoded = np.empty(len(x), dtype=np.float32)
+    codec.decode(encoded, decoded)
+    np.testing.assert_array_equal(decoded, np.array(expected) / codec.scale)
+
+
+@pytest.mark.parametrize('n_samples', [0, 7, 64, 100])
+def test_buffered_predictor(driver, n_samples):
+    in_codec = driver.FixedPointCodec.from_precision('ap_fixed<16,6>')
+    out_codec = driver.FixedPointCodec.from_precision('ap_fixed<32,16>')
+
+    # The mock accelerator sums the raw input pairs, scaled to the output type
+    def accelerator(x):
+        return x.reshape(-1, 2).sum(axis=1).astype(np.int64) * 2**6
+
+    device = driver.MockDevice(accelerator, latency=0.002)
+    predictor = driver.BufferedPredictor(device, (4, 2), (4,), 16, in_codec, out_codec)
+    n_buffers = len(device.buffers)
+
+    x = np.random.default_rng(0).uniform(-8, 8, (n_samples, 4, 2)).astype(np.float32)
+    y, _, rate = predictor.predict(x, profile=True)
+    np.testing.assert_array_equal(y, (np.floor(x * 1024) / 1024).sum(axis=2))
+    assert n_samples == 0 or rate > 0
+
+    # No buffers are allocated by the predictions
+    assert len(device.buffers) == n_buffers
+
+    # The next chunk is transferred before the current one is finished, in the other buffer
+    n_chunks = (n_samples + 15) // 16
+    events = device.events
+    assert [e for e in events if e[0] == 'start'] == [('start', i % 2) for i in range(n_chunks)]
+    for i in range(n_chunks - 1):
+        next_sync = events.index(('sync_to_device', (i + 1) % 2), events.index(('start', i % 2)))
+        assert next_sync < events.index(('wait', i % 2), events.index(('start', i % 2)))
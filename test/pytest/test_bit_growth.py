@@ -0,0 +1,126 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+# Weights and bias fit in fixed<8,2>, the inputs are fixed<8,4> in [-8, 7.9375]
+weights = np.array([[1.0, 0.0], [-1.0, 0.0], [0.5, 0.0], [0.0, 0.25]])
+bias = np.array([0.5, 0.0])
+
+
+@pytest.fixture
+def bit_growth():
+    opt = hls4ml.model.optimizer.get_optimizer('infer_accum_precision')
+    yield opt
+    opt.configure(layers=[], tighten_result=False)
+
+
+def make_model(output_dir, weight_data=weights, bias_data=bias, accum_precision=None):
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [weight_data.shape[0]]},
+        {
+            'class_name': 'Dense',
+            'name': 'dense',
+            'n_in': weight_data.shape[0],
+            'n_out': weight_data.shape[1],
+            'weight_data': weight_data,
+            'bias_data': bias_data,
+        },
+        {'class_name': 'Activation', 'name': 'relu', 'activation': 'relu'},
+    ]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<32,16>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {
+                'layer0_input': {'Precision': {'result': 'fixed<8,4>'}},
+                'dense': {'Precision': {'weight': 'fixed<8,2>', 'bias': 'fixed<8,2>'}},
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_parallel',
+        'Backend': 'Vivado',
+    }
+    if accum_precision is not None:
+        config['HLSConfig']['LayerName']['dense']['Precision']['accum'] = accum_precision
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+def test_accum_precision(bit_growth):
+    bit_growth.configure(layers=['Dense'])
+    model = make_model(str(test_root_path / 'hls4mlprj_bit_growth_accum'))
+    dense = model.graph['dense']
+
+    # The first output is in [-19.4375, 20.40625], the products have 4 + 6 fractional bits
+    accum = dense.get_attr('accum_t').precision
+    assert (accum.width, accum.integer, accum.signed) == (16, 6, True)
+    assert dense.get_attr('accum_bits_saved') == 16
+
+    # Without tighten_result the result types are left alone
+    assert model.graph['dense'].get_output_variable().type.precision.width == 32
+    assert model.graph['relu'].get_output_variable().type.precision.width == 32
+
+
+def test_accum_precision_exact(bit_growth):
+    x = np.array([[-8, -8, -8, -8], [7.9375, -8, 7.9375, 7.9375], [-8, 7.9375, -8, -8]])
+    x = np.concatenate([x, np.round(np.random.default_rng(0).uniform(-8, 8, (100, 4)) * 16) / 16])
+
+    model_ref = make_model(str(test_root_path / 'hls4mlprj_bit_growth_ref'))
+    model_ref.compile()
+
+    bit_growth.configure(layers=['dense'])
+    model = make_model(str(test_root_path / 'hls4mlprj_bit_growth_exact'))
+    model.compile()
+
+    np.testing.assert_array_equal(model.predict(x), model_ref.predict(x))
+
+
+def test_tighten_result(bit_growth):
+    bit_growth.configure(layers=['Dense'], tighten_result=True)
+    model = make_model(str(test_root_path / 'hls4mlprj_bit_growth_result'))
+
+    # The fractional bits of the results are kept
+    for name in ['dense', 'relu']:
+        result = model.graph[name].get_output_variable().type.precision
+        assert (result.width, result.integer) == (22, 6)
+        assert model.graph[name].get_attr('result_bits_saved') == 10
+
+
+def test_pruned_weights(bit_growth):
+    bit_growth.configure(layers=['Dense'])
+    # Only one weight is left per output
+    pruned = np.zeros((16, 2))
+    pruned[3, 0] = 1.0
+    pruned[7, 1] = -0.25
+    model = make_model(str(test_root_path / 'hls4mlprj_bit_growth_pruned'), weight_data=pruned, bias_data=np.zeros(2))
+
+    # The output has the range of the input, while the 16 inputs could add 4 bits to a dense sum
+    accum = model.graph['dense'].get_attr('accum_t').precision
+    assert (accum.width, accum.integer) == (14, 4)
+
+
+def test_truncated_products(bit_growth):
+    # The products have 10 fractional bits, the accumulator only 2. The smallest output is -15.98, but the truncated
+    # products and bias sum to -16.25, which needs one more integer bit.
+    trunc_weights = np.array([[1.453125], [-0.296875]])
+    trunc_bias = np.array([-2.0])
+    x = np.array([[-8, 7.9375], [7.9375, -8], [0, 0]])
+
+    model_ref = make_model(
+        str(test_root_path / 'hls4mlprj_bit_growth_trunc_ref'), trunc_weights, trunc_bias, accum_precision='fixed<24,22>'
+    )
+    model_ref.compile()
+
+    bit_growth.configure(layers=['Dense'])
+    model = make_model(
+        str(test_root_path / 'hls4mlprj_bit_growth_trunc'), trunc_weights, trunc_bias, accum_precision='fixed<24,22>'
+    )
+    accum = model.graph['dense'].get_attr('accum_t').precision
+    assert (accum.width, accum.integer) == (8, 6)
+    model.compile()
+
+    np.testing.assert_array_equal(model.predict(x), model_ref.predict(x))
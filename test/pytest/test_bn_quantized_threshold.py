@@ -0,0 +1,104 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_chan = 6
+
+
+def make_model(output_dir, io_type, backend, activation, out_precision):
+    rng = np.random.default_rng(0)
+    gamma = rng.uniform(0.5, 2, n_chan) * np.array([1, -1, 1, -1, 1, 0])
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [4, n_chan]},
+        {
+            'class_name': 'BatchNormalization',
+            'name': 'bn',
+            'n_in': 4 * n_chan,
+            'n_out': 4 * n_chan,
+            'n_filt': n_chan,
+            'gamma_data': gamma,
+            'beta_data': rng.uniform(-1, 1, n_chan),
+            'mean_data': rng.uniform(-1, 1, n_chan),
+            'variance_data': rng.uniform(0.5, 2, n_chan),
+            'epsilon': 1e-3,
+        },
+        {'class_name': 'Activation', 'name': 'act', 'activation': activation},
+    ]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'ap_fixed<10,4>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {'act': {'Precision': {'result': out_precision}}},
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': backend,
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+def reference(x, activation, width, integer, signed, rounding):
+    # Same folding as the BatchNormalization layer
+    rng = np.random.default_rng(0)
+    gamma = rng.uniform(0.5, 2, n_chan) * np.array([1, -1, 1, -1, 1, 0])
+    beta, mean, var = rng.uniform(-1, 1, n_chan), rng.uniform(-1, 1, n_chan), rng.uniform(0.5, 2, n_chan)
+    scale = gamma / np.sqrt(var + 1e-3)
+    v = x.reshape(-1, 4, n_chan) * scale + (beta - scale * mean)
+    if activation == 'relu':
+        v = np.maximum(v, 0)
+
+    step = 2.0 ** (integer - width)
+    if rounding == 'TRN':
+        code = np.floor(v / step)
+    elif rounding == 'RND':
+        code = np.floor(v / step + 0.5)
+    else:
+        code = np.round(v / step)
+    lo, hi = (-(2 ** (width - 1)), 2 ** (width - 1) - 1) if signed else (0, 2**width - 1)
+    return (np.clip(code, lo, hi) * step).reshape(len(x), -1)
+
+
+@pytest.mark.parametrize('backend', ['Vivado', 'Quartus'])
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize(
+    'activation, width, integer, signed, rounding',
+    [
+        ('relu', 2, 1, False, 'RND_CONV'),
+        ('relu', 4, 2, False, 'RND_CONV'),
+        ('relu', 3, 3, True, 'TRN'),
+        ('linear', 3, 1, True, 'RND'),
+        ('linear', 4, 2, True, 'RND_CONV'),
+    ],
+)
+def test_bn_quantized_threshold(backend, io_type, activation, width, integer, signed, rounding):
+    if backend == 'Vivado':
+        out_precision = f'ap_{"" if signed else "u"}fixed<{width},{integer},AP_{rounding},AP_SAT>'
+    else:
+        out_precision = f'ac_fixed<{width},{integer},{str(signed).lower()},AC_{rounding},AC_SAT>'
+    output_dir = str(
+        test_root_path / f'hls4mlprj_bn_threshold_{backend}_{io_type}_{activation}_{width}_{integer}_{signed}_{rounding}'
+    )
+    model = make_model(output_dir, io_type, backend, activation, out_precision)
+
+    # The BatchNormalization and the activation are replaced by the thresholds
+    assert [layer.class_name for layer in model.get_layers()] == ['Input', 'BatchNormalizationQuantizedThreshold']
+    n_levels = 2 ** (width - 1) if signed and activation == 'relu' else 2**width
+    assert model.graph['bnqt_bn'].get_attr('n_thresholds') == n_levels - 1
+
+    x = np.round(np.random.default_rng(1).uniform(-7.9, 7.9, (100, 4 * n_chan)) * 64) / 64
+    model.compile()
+    y = model.predict(x)
+    np.testing.assert_array_equal(y, reference(x, activation, width, integer, signed, rounding))
+
+
+def test_bn_wide_activation_not_folded():
+    model = make_model(
+        str(test_root_path / 'hls4mlprj_bn_threshold_wide'), 'io_parallel', 'Vivado', 'relu', 'ap_ufixed<8,4,AP_RND,AP_SAT>'
+    )
+    assert 'BatchNormalizationQuantizedThreshold' not in [layer.class_name for layer in model.get_layers()]
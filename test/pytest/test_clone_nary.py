@@ -0,0 +1,75 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+from hls4ml.backends.fpga.passes.clone import Clone
+
+test_root_path = Path(__file__).parent
+
+n_in = 16
+activations = ['relu', 'sigmoid', 'tanh', 'relu', 'sigmoid']
+
+
+def make_model(io_type, output_dir, clone_config=None):
+    layers = [{'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [n_in]}]
+    for i, activation in enumerate(activations):
+        layers.append(
+            {
+                'class_name': 'Activation',
+                'name': f'act{i}',
+                'activation': activation,
+                'n_in': n_in,
+                'inputs': ['layer0_input'],
+            }
+        )
+    layers.append(
+        {'class_name': 'Merge', 'name': 'merge', 'op': 'add', 'inputs': [f'act{i}' for i in range(len(activations))]}
+    )
+    layer_config = {'merge': {'Precision': {'result': 'fixed<32,12>', 'accum': 'fixed<32,12>'}}}
+    if clone_config is not None:
+        layer_config['clone_layer0_input'] = clone_config
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': layer_config,
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+def test_clone_nary():
+    x = np.round(np.random.default_rng(0).uniform(-4, 4, (10, n_in)) * 64) / 64
+
+    parallel_model = make_model('io_parallel', str(test_root_path / 'hls4mlprj_clone_nary_io_parallel'))
+    stream_model = make_model('io_stream', str(test_root_path / 'hls4mlprj_clone_nary_io_stream'))
+
+    clones = [layer for layer in stream_model.get_layers() if isinstance(layer, Clone)]
+    assert len(clones) == 1
+    assert len(clones[0].outputs) == len(activations)
+
+    parallel_model.compile()
+    stream_model.compile()
+    np.testing.assert_array_equal(stream_model.predict(x), parallel_model.predict(x))
+
+
+@pytest.mark.parametrize(
+    'fifo_depth, expected',
+    [
+        (32, {f'act{i}': 32 for i in range(len(activations))}),
+        ({'act1': 64, 'act3': 4}, {'act0': 1, 'act1': 64, 'act2': 1, 'act3': 4, 'act4': 1}),
+    ],
+)
+def test_clone_fifo_depth(fifo_depth, expected):
+    output_dir = str(test_root_path / 'hls4mlprj_clone_nary_fifo_depth')
+    hls_model = make_model('io_stream', output_dir, clone_config={'FifoDepth': fifo_depth})
+
+    for consumer, depth in expected.items():
+        var = hls_model.graph[consumer].get_input_variable()
+        assert var.pragma == ('stream', depth)
@@ -0,0 +1,114 @@
+import time
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+
+def make_model(output_dir, layer_type, in_shape, strategy, buffer_fill, parallelization_factor=1):
+    rng = np.random.default_rng(0)
+    is_2d = layer_type == 'Conv2D'
+    filt = (3, 3) if is_2d else (3,)
+    n_chan, n_filt = in_shape[-1], 4
+
+    layer = {
+        'class_name': layer_type,
+        'name': 'conv',
+        'data_format': 'channels_last',
+        'n_chan': n_chan,
+        'n_filt': n_filt,
+        'weight_data': rng.uniform(-1, 1, (*filt, n_chan, n_filt)),
+        'bias_data': rng.uniform(-1, 1, n_filt),
+    }
+    dims = [('width', in_shape[-2], filt[-1], 'pad_left', 'pad_right')]
+    if is_2d:
+        dims.insert(0, ('height', in_shape[0], filt[0], 'pad_top', 'pad_bottom'))
+    for dim, size, filt_size, pad_before, pad_after in dims:
+        # 'same' padding, so the table has padding entries
+        layer[f'in_{dim}'] = size
+        layer[f'filt_{dim}'] = filt_size
+        layer[f'stride_{dim}'] = 1
+        layer[f'out_{dim}'] = size
+        layer[pad_before] = (filt_size - 1) // 2
+        layer[pad_after] = filt_size - 1 - (filt_size - 1) // 2
+
+    layers = [{'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': list(in_shape)}, layer]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'ap_fixed<16,6>', 'ReuseFactor': 1, 'Strategy': strategy},
+            'LayerName': {'conv': {'BufferFill': buffer_fill, 'ParallelizationFactor': parallelization_factor}},
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_parallel',
+        'Backend': 'Vivado',
+        # Always compile, the compilation time is compared
+        'LibraryCache': False,
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('layer_type, in_shape', [('Conv1D', (10, 3)), ('Conv2D', (6, 5, 3))])
+@pytest.mark.parametrize('strategy', ['Latency', 'Resource'])
+def test_buffer_fill_table(layer_type, in_shape, strategy):
+    x = np.random.default_rng(1).uniform(-4, 4, (20, int(np.prod(in_shape))))
+    outputs = {}
+    for buffer_fill in ['Unrolled', 'Table']:
+        output_dir = str(test_root_path / f'hls4mlprj_buffer_fill_{layer_type}_{strategy}_{buffer_fill}')
+        model = make_model(output_dir, layer_type, in_shape, strategy, buffer_fill, parallelization_factor=2)
+        assert model.graph['conv'].get_attr('buffer_fill') == buffer_fill
+        model.compile()
+        outputs[buffer_fill] = model.predict(x)
+
+        code_gen = Path(output_dir, 'firmware', 'nnet_utils', 'nnet_code_gen.h').read_text()
+        assert ('fill_buffer_from_table<' in code_gen.split('// hls4ml insert code')[1]) == (buffer_fill == 'Table')
+
+    # Bit-identical
+    np.testing.assert_array_equal(outputs['Unrolled'], outputs['Table'])
+
+
+def test_buffer_fill_table_size():
+    in_shape = (32, 32, 3)
+    code_size = {}
+    compile_time = {}
+    for buffer_fill in ['Unrolled', 'Table']:
+        output_dir = str(test_root_path / f'hls4mlprj_buffer_fill_size_{buffer_fill}')
+        model = make_model(output_dir, 'Conv2D', in_shape, 'Latency', buffer_fill)
+        start = time.time()
+        model.compile()
+        compile_time[buffer_fill] = time.time() - start
+        code_size[buffer_fill] = Path(output_dir, 'firmware', 'nnet_utils', 'nnet_code_gen.h').stat().st_size
+
+    print(
+        f'nnet_code_gen.h: {code_size["Unrolled"]} bytes (Unrolled), {code_size["Table"]} bytes (Table); '
+        f'compile: {compile_time["Unrolled"]:.1f}s (Unrolled), {compile_time["Table"]:.1f}s (Table)'
+    )
+    assert code_size['Table'] * 2 < code_size['Unrolled']
+    assert compile_time['Table'] < compile_time['Unrolled']
+
+
+@pytest.mark.parametrize('layer_type, in_shape', [('Conv1D', (10, 3)), ('Conv2D', (6, 5, 3))])
+def test_buffer_fill_table_latency(layer_type, in_shape):
+    output_dir = str(test_root_path / f'hls4mlprj_buffer_fill_latency_{layer_type}')
+    model = make_model(output_dir, layer_type, in_shape, 'Latency', 'Table', parallelization_factor=2)
+    model.write()
+    index = model.graph['conv'].index
+
+    # The table-driven fill is the one used by the latency implementation synthesized from the project
+    parameters = Path(output_dir, 'firmware', 'parameters.h').read_text()
+    config = parameters.split(f'struct config{index} ')[1].split('};')[0]
+    assert f'using fill_buffer = nnet::fill_buffer_{index}<data_T, CONFIG_T>;' in config
+    assert 'static const unsigned strategy = nnet::latency;' in config
+    kernel = Path(output_dir, 'firmware', 'nnet_utils', f'nnet_{layer_type.lower()}_latency.h').read_text()
+    assert 'CONFIG_T::template fill_buffer<data_T, CONFIG_T>::fill_buffer(data, data_buf, i_part);' in kernel
+
+    # The table is only indexed by the constant partitions of the unrolled loop of the kernel
+    code_gen = Path(output_dir, 'firmware', 'nnet_utils', 'nnet_code_gen.h').read_text()
+    kernel, generated = code_gen.split('// hls4ml insert code')
+    assert 'table[p][i_pxl][i_tap]' in kernel.split('PartitionLoop:')[1]
+    assert 'table[partition]' not in code_gen
+    assert f'class fill_buffer_{index}' in generated
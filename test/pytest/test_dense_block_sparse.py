@@ -0,0 +1,105 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+from hls4ml.model.types import FixedPrecisionType
+from hls4ml.optimization.attributes import LayerAttributes, hls4mlAttributes
+from hls4ml.optimization.config import SUPPORTED_STRUCTURES
+from hls4ml.optimization.objectives.vivado_objectives import VivadoDSPEstimator, VivadoMultiObjectiveEstimator
+
+test_root_path = Path(__file__).parent
+
+n_in, n_out = 8, 6
+block_shape = (2, 3)
+
+
+def block_pruned_weights():
+    rng = np.random.default_rng(0)
+    weights = rng.uniform(-1, 1, (n_in, n_out))
+    # Keep the blocks (0, 1), (1, 0) and (3, 1) of the (4, 2) blocks
+    mask = np.zeros((n_in // block_shape[0], n_out // block_shape[1]))
+    mask[0, 1] = mask[1, 0] = mask[3, 1] = 1
+    return weights * np.kron(mask, np.ones(block_shape)), rng.uniform(-1, 1, n_out)
+
+
+def make_model(output_dir, io_type, reuse_factor, block_shape=None):
+    weights, biases = block_pruned_weights()
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [n_in]},
+        {
+            'class_name': 'Dense',
+            'name': 'dense',
+            'n_in': n_in,
+            'n_out': n_out,
+            'weight_data': weights,
+            'bias_data': biases,
+        },
+        {'class_name': 'Activation', 'name': 'relu', 'activation': 'relu'},
+    ]
+    hls_config = {
+        'Model': {'Precision': 'ap_fixed<16,6>', 'ReuseFactor': reuse_factor, 'Strategy': 'Resource'},
+        'LayerName': {},
+    }
+    if block_shape is not None:
+        hls_config['LayerName']['dense'] = {'BlockShape': block_shape}
+    config = {
+        'HLSConfig': hls_config,
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('reuse_factor, n_blocks', [(1, 3), (2, 4), (3, 3), (8, 3)])
+def test_dense_block_sparse(io_type, reuse_factor, n_blocks):
+    x = np.random.default_rng(1).uniform(-4, 4, (50, n_in))
+
+    model_ref = make_model(str(test_root_path / f'hls4mlprj_block_sparse_ref_{io_type}'), io_type, 1)
+    model_ref.compile()
+    y_ref = model_ref.predict(x)
+
+    output_dir = str(test_root_path / f'hls4mlprj_block_sparse_{io_type}_rf{reuse_factor}')
+    model = make_model(output_dir, io_type, reuse_factor, block_shape)
+    model.compile()
+    np.testing.assert_array_equal(model.predict(x), y_ref)
+
+    # Only the non-zero blocks are stored, padded to a multiple of the reuse factor
+    dense = model.graph['dense']
+    assert dense.get_attr('strategy') == 'block_sparse'
+    assert dense.get_attr('n_blocks') == n_blocks
+    assert dense.get_attr('reuse_factor') == min(reuse_factor, 3)
+    assert dense.get_weights('weight').data_length == n_blocks * np.prod(block_shape)
+    parameters = Path(output_dir, 'firmware', 'parameters.h').read_text()
+    assert f'static const unsigned n_blocks = {n_blocks};' in parameters
+    assert 'nnet::dense_block_sparse<' in Path(output_dir, 'firmware', 'myprj.cpp').read_text()
+
+
+def test_dense_block_sparse_shape():
+    with pytest.raises(Exception, match='does not divide'):
+        make_model(str(test_root_path / 'hls4mlprj_block_sparse_shape'), 'io_parallel', 2, (3, 3))
+
+
+def test_block_estimators():
+    precision = FixedPrecisionType(16, 6)
+    attributes = hls4mlAttributes(
+        n_in, n_out, 'io_parallel', 'Resource', precision, precision, reuse_factor=2, block_shape=block_shape
+    )
+    layer = LayerAttributes('dense', None, [], (n_in, n_out), (n_in,), (n_out,), True, None, {})
+    layer.update_args({'hls4ml_attributes': attributes})
+
+    optimizable, optimization_attributes = VivadoDSPEstimator.is_layer_optimizable(layer)
+    assert optimizable
+    assert optimization_attributes.structure_type == SUPPORTED_STRUCTURES.BLOCK
+    assert optimization_attributes.block_shape == block_shape
+    layer.optimization_attributes = optimization_attributes
+    assert VivadoDSPEstimator.layer_savings(layer) == [3]
+
+    optimizable, optimization_attributes = VivadoMultiObjectiveEstimator.is_layer_optimizable(layer)
+    assert optimization_attributes.structure_type == SUPPORTED_STRUCTURES.BLOCK
+    layer.optimization_attributes = optimization_attributes
+    assert VivadoMultiObjectiveEstimator.layer_savings(layer) == pytest.approx([3, 3 * 16 / 36])
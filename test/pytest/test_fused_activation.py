@@ -0,0 +1,191 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+in_height = 8
+in_width = 8
+n_chan = 3
+n_filt = 4
+n_in = 16
+n_out = 8
+
+
+def activation_layer(activation):
+    layer = {'name': 'act', 'n_in': n_out}
+    if activation == 'leaky_relu':
+        layer.update({'class_name': 'LeakyReLU', 'activation': 'LeakyReLU', 'activ_param': 0.3})
+    elif activation == 'hard_sigmoid':
+        layer.update({'class_name': 'HardActivation', 'activation': 'hard_sigmoid'})
+    else:
+        layer.update({'class_name': 'Activation', 'activation': activation})
+    return layer
+
+
+def dense_layers(rng):
+    return [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [n_in]},
+        {
+            'class_name': 'Dense',
+            'name': 'parent',
+            'n_in': n_in,
+            'n_out': n_out,
+            'weight_data': rng.uniform(-1, 1, (n_in, n_out)),
+            'bias_data': rng.uniform(-1, 1, (n_out,)),
+        },
+    ]
+
+
+def conv1d_layers(rng):
+    return [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [in_width, n_chan]},
+        {
+            'class_name': 'Conv1D',
+            'name': 'parent',
+            'data_format': 'channels_last',
+            'in_width': in_width,
+            'n_chan': n_chan,
+            'n_filt': n_filt,
+            'filt_width': 3,
+            'stride_width': 1,
+            'padding': 'valid',
+            'out_width': in_width - 2,
+            'pad_left': 0,
+            'pad_right': 0,
+            'weight_data': rng.uniform(-1, 1, (3, n_chan, n_filt)),
+            'bias_data': rng.uniform(-1, 1, (n_filt,)),
+        },
+    ]
+
+
+def conv2d_layers(rng):
+    return [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [in_height, in_width, n_chan]},
+        {
+            'class_name': 'Conv2D',
+            'name': 'parent',
+            'data_format': 'channels_last',
+            'in_height': in_height,
+            'in_width': in_width,
+            'n_chan': n_chan,
+            'n_filt': n_filt,
+            'filt_height': 3,
+            'filt_width': 3,
+            'stride_height': 1,
+            'stride_width': 1,
+            'padding': 'valid',
+            'out_height': in_height - 2,
+            'out_width': in_width - 2,
+            'pad_top': 0,
+            'pad_bottom': 0,
+            'pad_left': 0,
+            'pad_right': 0,
+            'weight_data': rng.uniform(-1, 1, (3, 3, n_chan, n_filt)),
+            'bias_data': rng.uniform(-1, 1, (n_filt,)),
+        },
+    ]
+
+
+def make_model(layers, activation, io_type, output_dir, conv_implementation='LineBuffer'):
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {
+                # The pre-activation result is narrower than the default, the fused layer must keep rounding to it
+                'parent': {
+                    'Precision': {'result': 'fixed<10,4,AP_RND,AP_SAT>'},
+                    'ConvImplementation': conv_implementation,
+                    'FuseActivation': True,
+                },
+                'act': {'Precision': {'result': 'fixed<8,2,AP_RND,AP_SAT>'}},
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers + [activation_layer(activation)])
+
+
+def check_fused(layers, activation, name, conv_implementation='LineBuffer'):
+    input_shape = layers[0]['input_shape']
+    x = np.random.default_rng(1).uniform(-4, 4, (20, *input_shape))
+
+    output_dir = str(test_root_path / f'hls4mlprj_fused_activation_{name}_{activation}')
+    parallel_model = make_model(layers, activation, 'io_parallel', output_dir + '_io_parallel', conv_implementation)
+    stream_model = make_model(layers, activation, 'io_stream', output_dir + '_io_stream', conv_implementation)
+
+    assert 'act' in parallel_model.graph
+    assert 'act' not in stream_model.graph
+    assert stream_model.graph['parent'].get_attr('fused_activation') is not None
+
+    parallel_model.compile()
+    stream_model.compile()
+
+    y_parallel = parallel_model.predict(x)
+    y_stream = stream_model.predict(x)
+    np.testing.assert_array_equal(y_stream, y_parallel)
+
+
+@pytest.mark.parametrize('activation', ['relu', 'relu6', 'leaky_relu', 'sigmoid', 'tanh', 'hard_sigmoid', 'linear'])
+def test_fused_dense(activation):
+    check_fused(dense_layers(np.random.default_rng(0)), activation, 'dense')
+
+
+@pytest.mark.parametrize('activation', ['relu', 'sigmoid'])
+def test_fused_conv1d(activation):
+    check_fused(conv1d_layers(np.random.default_rng(0)), activation, 'conv1d')
+
+
+@pytest.mark.parametrize('conv_implementation', ['LineBuffer', 'Encoded'])
+@pytest.mark.parametrize('activation', ['relu', 'leaky_relu', 'tanh'])
+def test_fused_conv2d(activation, conv_implementation):
+    check_fused(
+        conv2d_layers(np.random.default_rng(0)), activation, f'conv2d_{conv_implementation.lower()}', conv_implementation
+    )
+
+
+def test_not_fused_with_multiple_outputs():
+    layers = dense_layers(np.random.default_rng(0))
+    layers.append(activation_layer('relu'))
+    layers.append({'class_name': 'Merge', 'name': 'add', 'op': 'add', 'inputs': ['parent', 'act']})
+    output_dir = str(test_root_path / 'hls4mlprj_fused_activation_multiple_outputs')
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1},
+            'LayerName': {'parent': {'FuseActivation': True}},
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_stream',
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    hls_model = hls4ml.model.ModelGraph(config, layers)
+
+    assert 'act' in hls_model.graph
+    assert hls_model.graph['parent'].get_attr('fused_activation') is None
+
+
+def test_not_fused_by_default():
+    layers = dense_layers(np.random.default_rng(0)) + [activation_layer('relu')]
+    output_dir = str(test_root_path / 'hls4mlprj_fused_activation_default')
+    config = {
+        'HLSConfig': {'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1}},
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_stream',
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    hls_model = hls4ml.model.ModelGraph(config, layers)
+
+    assert 'act' in hls_model.graph
+    assert hls_model.graph['parent'].get_attr('fuse_activation') is False
+    assert hls_model.graph['parent'].get_attr('fused_activation') is None
@@ -0,0 +1,125 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_chan = 3
+n_filt = 4
+
+
+def conv_pool_layers(rng, in_size, pool_op, activation):
+    conv_size = in_size - 2
+    pool_size = conv_size // 2
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [in_size, in_size, n_chan]},
+        {
+            'class_name': 'Conv2D',
+            'name': 'conv',
+            'data_format': 'channels_last',
+            'in_height': in_size,
+            'in_width': in_size,
+            'n_chan': n_chan,
+            'n_filt': n_filt,
+            'filt_height': 3,
+            'filt_width': 3,
+            'stride_height': 1,
+            'stride_width': 1,
+            'padding': 'valid',
+            'out_height': conv_size,
+            'out_width': conv_size,
+            'pad_top': 0,
+            'pad_bottom': 0,
+            'pad_left': 0,
+            'pad_right': 0,
+            'weight_data': rng.uniform(-1, 1, (3, 3, n_chan, n_filt)),
+            'bias_data': rng.uniform(-1, 1, (n_filt,)),
+        },
+    ]
+    if activation is not None:
+        layers.append({'class_name': 'Activation', 'name': 'act', 'activation': activation, 'n_in': n_filt})
+    layers.append(
+        {
+            'class_name': f'{pool_op}Pooling2D',
+            'name': 'pool',
+            'data_format': 'channels_last',
+            'in_height': conv_size,
+            'in_width': conv_size,
+            'n_filt': n_filt,
+            'pool_height': 2,
+            'pool_width': 2,
+            'stride_height': 2,
+            'stride_width': 2,
+            'padding': 'valid',
+            'out_height': pool_size,
+            'out_width': pool_size,
+            'pad_top': 0,
+            'pad_bottom': 0,
+            'pad_left': 0,
+            'pad_right': 0,
+        }
+    )
+    return layers
+
+
+def make_model(layers, output_dir, strategy, fuse):
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': strategy},
+            'LayerName': {
+                # The convolution output is narrower than the pooling accumulator, the fused layer must keep rounding to it
+                'conv': {
+                    'Precision': {'result': 'fixed<10,4,AP_RND,AP_SAT>'},
+                    'FuseActivation': fuse,
+                    'FusePool': fuse,
+                },
+                'act': {'Precision': {'result': 'fixed<10,4,AP_RND,AP_SAT>'}},
+                'pool': {'Precision': {'result': 'fixed<8,3,AP_RND,AP_SAT>'}},
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_stream',
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('pool_op', ['Max', 'Average'])
+@pytest.mark.parametrize('activation', [None, 'relu'])
+@pytest.mark.parametrize('in_size', [8, 9])
+@pytest.mark.parametrize('strategy', ['Latency', 'Resource'])
+def test_fused_conv_pool(pool_op, activation, in_size, strategy):
+    layers = conv_pool_layers(np.random.default_rng(0), in_size, pool_op, activation)
+    x = np.random.default_rng(1).uniform(-4, 4, (20, in_size, in_size, n_chan))
+
+    output_dir = str(
+        test_root_path / f'hls4mlprj_fused_conv_pool_{pool_op.lower()}_{activation}_{in_size}_{strategy.lower()}'
+    )
+    # The same layers without fusion, with the streaming pooling layer of hls4ml, provide the reference
+    unfused_model = make_model(layers, output_dir + '_unfused', strategy, fuse=False)
+    fused_model = make_model(layers, output_dir + '_fused', strategy, fuse=True)
+
+    assert 'pool' in unfused_model.graph
+    assert not unfused_model.graph['conv'].get_attr('fused_pool', False)
+    assert 'pool' not in fused_model.graph
+    assert fused_model.graph['conv'].get_attr('fused_pool')
+
+    unfused_model.compile()
+    fused_model.compile()
+
+    np.testing.assert_array_equal(fused_model.predict(x), unfused_model.predict(x))
+
+
+def test_not_fused_with_overlapping_pool():
+    layers = conv_pool_layers(np.random.default_rng(0), 8, 'Max', None)
+    layers[-1].update({'stride_height': 1, 'stride_width': 1, 'out_height': 5, 'out_width': 5})
+    output_dir = str(test_root_path / 'hls4mlprj_fused_conv_pool_overlapping')
+    hls_model = make_model(layers, output_dir, 'Latency', fuse=True)
+
+    assert 'pool' in hls_model.graph
+    assert not hls_model.graph['conv'].get_attr('fused_pool', False)
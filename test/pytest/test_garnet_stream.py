@@ -0,0 +1,143 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+vmax = 16
+feat = 3
+
+
+def make_garnet(collapse):
+    rng = np.random.default_rng(0)
+    n_aggregators, n_propagate, n_filters = 4, 4, 8
+    return {
+        'class_name': 'GarNet',
+        'name': 'gar_1',
+        'inputs': ['input_1', 'input_2'],
+        'input_format': 'xn',
+        'n_vertices': vmax,
+        'n_in_features': feat,
+        'collapse': collapse,
+        'mean_by_nvert': False,
+        'n_aggregators': n_aggregators,
+        'n_out_features': n_filters,
+        'n_propagate': n_propagate,
+        'FLR_kernel_data': rng.uniform(-1, 1, (feat, n_propagate)),
+        'FLR_bias_data': rng.uniform(-1, 1, n_propagate),
+        'S_kernel_data': rng.uniform(-1, 1, (feat, n_aggregators)),
+        'S_bias_data': rng.uniform(-1, 1, n_aggregators),
+        'Fout_kernel_data': rng.uniform(-1, 1, (n_aggregators * n_propagate, n_filters)),
+        'Fout_bias_data': rng.uniform(-1, 1, n_filters),
+    }
+
+
+def make_garnet_stack(collapse):
+    rng = np.random.default_rng(0)
+    n_aggregators, n_propagate, n_filters = [4, 2], [4, 3], [8, 6]
+    n_in_features = [feat, n_filters[0]]
+    garnet = {
+        'class_name': 'GarNetStack',
+        'name': 'gar_1',
+        'inputs': ['input_1', 'input_2'],
+        'input_format': 'xn',
+        'n_vertices': vmax,
+        'n_sublayers': 2,
+        'n_in_features': n_in_features,
+        'collapse': collapse,
+        'mean_by_nvert': False,
+        'n_aggregators': n_aggregators,
+        'n_out_features': n_filters,
+        'n_propagate': n_propagate,
+    }
+    for il in range(2):
+        garnet[f'FLR{il}_kernel_data'] = rng.uniform(-1, 1, (n_in_features[il], n_propagate[il]))
+        garnet[f'FLR{il}_bias_data'] = rng.uniform(-1, 1, n_propagate[il])
+        garnet[f'S{il}_kernel_data'] = rng.uniform(-1, 1, (n_in_features[il], n_aggregators[il]))
+        garnet[f'S{il}_bias_data'] = rng.uniform(-1, 1, n_aggregators[il])
+        garnet[f'Fout{il}_kernel_data'] = rng.uniform(-1, 1, (n_aggregators[il] * n_propagate[il], n_filters[il]))
+        garnet[f'Fout{il}_bias_data'] = rng.uniform(-1, 1, n_filters[il])
+
+    return garnet
+
+
+def make_model(output_dir, io_type, collapse, reuse_factor, activation=False, stack=False):
+    garnet = make_garnet_stack(collapse) if stack else make_garnet(collapse)
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'input_1', 'input_shape': [vmax, feat]},
+        {'class_name': 'InputLayer', 'name': 'input_2', 'input_shape': [1]},
+    ]
+    if activation:
+        # GarNet behind another streaming layer
+        layers.append({'class_name': 'Activation', 'name': 'relu', 'activation': 'relu', 'inputs': ['input_1']})
+        garnet['inputs'] = ['relu', 'input_2']
+    layers.append(garnet)
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'ap_fixed<32,6>', 'ReuseFactor': reuse_factor, 'Strategy': 'Latency'},
+            'LayerName': {
+                'input_2': {'Precision': {'result': 'ap_uint<16>'}},
+                'gar_1': {'Precision': {'default': 'ap_fixed<32,6,AP_RND,AP_SAT>', 'result': 'ap_fixed<32,6>'}},
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+    }
+    return hls4ml.model.ModelGraph(config, layers, inputs=['input_1', 'input_2'])
+
+
+def make_inputs():
+    rng = np.random.default_rng(1)
+    x = rng.uniform(-1, 1, (20, vmax, feat))
+    nvtx = rng.integers(1, vmax + 1, (20, 1)).astype(np.float64)
+    nvtx[0] = vmax
+    for i in range(len(x)):
+        x[i, int(nvtx[i, 0]) :] = 0
+
+    return x, nvtx
+
+
+@pytest.mark.parametrize('stack', [False, True])
+@pytest.mark.parametrize('collapse', [None, 'mean'])
+@pytest.mark.parametrize('reuse_factor', [1, 4])
+def test_garnet_stream(collapse, reuse_factor, stack):
+    x, nvtx = make_inputs()
+
+    name = f'{"stack_" if stack else ""}{collapse}_rf{reuse_factor}'
+    model_ref = make_model(
+        str(test_root_path / f'hls4mlprj_garnet_parallel_{name}'), 'io_parallel', collapse, reuse_factor, stack=stack
+    )
+    model_ref.compile()
+    y_ref = model_ref.predict([x, nvtx])
+
+    model = make_model(
+        str(test_root_path / f'hls4mlprj_garnet_stream_{name}'), 'io_stream', collapse, reuse_factor, stack=stack
+    )
+    model.compile()
+    y = model.predict([x, nvtx])
+
+    if collapse is None:
+        # The vertices beyond nvtx are not written by the io_parallel implementation, and set to zero when streamed
+        y_ref, y = y_ref.reshape(len(x), vmax, -1), y.reshape(len(x), vmax, -1)
+        for i in range(len(x)):
+            n = int(nvtx[i, 0])
+            np.testing.assert_array_equal(y[i, :n], y_ref[i, :n])
+            np.testing.assert_array_equal(y[i, n:], 0)
+    else:
+        np.testing.assert_array_equal(y, y_ref)
+
+
+def test_garnet_stream_after_layer():
+    x, nvtx = make_inputs()
+
+    model_ref = make_model(str(test_root_path / 'hls4mlprj_garnet_parallel_relu'), 'io_parallel', 'mean', 2, True)
+    model_ref.compile()
+
+    model = make_model(str(test_root_path / 'hls4mlprj_garnet_stream_relu'), 'io_stream', 'mean', 2, True)
+    model.compile()
+    np.testing.assert_array_equal(model.predict([x, nvtx]), model_ref.predict([x, nvtx]))
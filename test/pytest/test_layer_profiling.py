@@ -0,0 +1,90 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_in = 8
+n_hidden = 16
+n_out = 4
+
+
+def make_model(backend, io_type, output_dir, layer_config=None):
+    rng = np.random.default_rng(42)
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [n_in]},
+        {
+            'class_name': 'Dense',
+            'name': 'fc1',
+            'n_in': n_in,
+            'n_out': n_hidden,
+            'weight_data': rng.uniform(-1, 1, (n_in, n_hidden)),
+            'bias_data': rng.uniform(-1, 1, (n_hidden,)),
+        },
+        {'class_name': 'Activation', 'name': 'relu1', 'activation': 'relu', 'n_in': n_hidden},
+        {
+            'class_name': 'Dense',
+            'name': 'fc2',
+            'n_in': n_hidden,
+            'n_out': n_out,
+            'weight_data': rng.uniform(-1, 1, (n_hidden, n_out)),
+            'bias_data': rng.uniform(-1, 1, (n_out,)),
+        },
+    ]
+    config = {
+        'HLSConfig': {'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1}, 'LayerName': layer_config or {}},
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': backend,
+        'ClockPeriod': 5,
+        'LayerProfiling': True,
+    }
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('backend', ['Vivado', 'Quartus'])
+def test_layer_profiling(backend, io_type):
+    output_dir = str(test_root_path / f'hls4mlprj_layer_profiling_{backend}_{io_type}')
+    hls_model = make_model(backend, io_type, output_dir)
+    hls_model.compile()
+
+    x = np.random.default_rng(0).uniform(-1, 1, (50, n_in))
+    hls_model.predict(x)
+    profile = hls_model.get_layer_profile()
+
+    assert list(profile.keys()) == ['fc1', 'relu1', 'fc2']
+    for stats in profile.values():
+        assert stats['samples'] == 50
+        assert stats['time'] > 0
+    # 16-bit inputs, outputs and weights
+    assert profile['fc1']['bytes'] == 50 * 2 * (n_in + n_hidden + n_in * n_hidden + n_hidden)
+
+    # Counters are reset on every call to predict
+    hls_model.predict(x[:10])
+    assert all(stats['samples'] == 10 for stats in hls_model.get_layer_profile().values())
+
+
+def test_layer_profiling_fused_activation():
+    output_dir = str(test_root_path / 'hls4mlprj_layer_profiling_fused_activation')
+    hls_model = make_model('Vivado', 'io_stream', output_dir, layer_config={'fc1': {'FuseActivation': True}})
+    hls_model.compile()
+
+    hls_model.predict(np.random.default_rng(0).uniform(-1, 1, (50, n_in)))
+    # relu1 is computed in the output stage of fc1
+    assert list(hls_model.get_layer_profile().keys()) == ['fc1', 'fc2']
+
+
+def test_layer_profiling_disabled():
+    output_dir = str(test_root_path / 'hls4mlprj_layer_profiling_disabled')
+    hls_model = make_model('Vivado', 'io_parallel', output_dir)
+    hls_model.config.layer_profiling = False
+    hls_model.compile()
+    hls_model.predict(np.zeros((1, n_in)))
+
+    with pytest.raises(Exception):
+        hls_model.get_layer_profile()
@@ -0,0 +1,128 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+epsilon = 1e-3
+
+
+def make_model(in_shape, backend, io_type, output_dir, reuse_factor=1):
+    rng = np.random.default_rng(0)
+    n_in = in_shape[-1]
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': list(in_shape)},
+        {
+            'class_name': 'LayerNormalization',
+            'name': 'layernorm',
+            'epsilon': epsilon,
+            'gamma_data': rng.uniform(0.5, 1.5, n_in),
+            'beta_data': rng.uniform(-0.5, 0.5, n_in),
+        },
+    ]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': reuse_factor, 'Strategy': 'Latency'},
+            'LayerName': {'layernorm': {'Precision': {'result': 'fixed<16,6,RND,SAT>'}}},
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': backend,
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers), layers[1]
+
+
+def layernorm_reference(x, layer):
+    mean = x.mean(axis=-1, keepdims=True)
+    var = x.var(axis=-1, keepdims=True)
+    return (x - mean) / np.sqrt(var + layer['epsilon']) * layer['gamma_data'] + layer['beta_data']
+
+
+@pytest.mark.parametrize('backend', ['Vivado', 'Vitis', 'Quartus'])
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('in_shape', [(16,), (5, 12)])
+def test_layernorm(in_shape, io_type, backend):
+    shape_name = 'x'.join(str(s) for s in in_shape)
+    output_dir = str(test_root_path / f'hls4mlprj_layernorm_{shape_name}_{backend}_{io_type}')
+    hls_model, layer = make_model(in_shape, backend, io_type, output_dir)
+    hls_model.compile()
+
+    # Inputs representable in fixed<16,6>, the second batch has a small variance
+    rng = np.random.default_rng(1)
+    x = np.round(rng.uniform(-8, 8, (20, *in_shape)) * 1024) / 1024
+    x[10:] = np.round((1 + x[10:] / 64) * 1024) / 1024
+    y = hls_model.predict(x).reshape(x.shape)
+    y_ref = layernorm_reference(x, layer)
+
+    # The table of the inverse square root is accurate to ~0.1%, the output has 10 fractional bits
+    np.testing.assert_allclose(y, y_ref, rtol=0, atol=np.abs(y_ref).max() * 2e-3 + 2**-9)
+
+
+def test_layernorm_reuse_factor():
+    in_shape = (4, 16)
+    x = np.round(np.random.default_rng(1).uniform(-8, 8, (20, *in_shape)) * 1024) / 1024
+
+    output_dir = str(test_root_path / 'hls4mlprj_layernorm_rf')
+    model_rf1, _ = make_model(in_shape, 'Vivado', 'io_stream', output_dir + '_1')
+    model_rf4, _ = make_model(in_shape, 'Vivado', 'io_stream', output_dir + '_4', reuse_factor=4)
+    assert model_rf4.graph['layernorm'].get_attr('reuse_factor') == 4
+    model_rf1.compile()
+    model_rf4.compile()
+
+    np.testing.assert_array_equal(model_rf4.predict(x), model_rf1.predict(x))
+
+
+def test_layernorm_accum_precision():
+    output_dir = str(test_root_path / 'hls4mlprj_layernorm_accum')
+    hls_model, _ = make_model((5, 12), 'Vivado', 'io_parallel', output_dir)
+    # fixed<16,6> input, 4 more bits for the sums of 12 elements, doubled for the squares
+    precision = hls_model.graph['layernorm'].get_attr('accum_t').precision
+    assert (precision.width, precision.integer) == (40, 20)
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+def test_layernorm_quartus_table_size(io_type):
+    # Two layers with different table sizes, each reads its own table
+    in_shape = (4, 16)
+    rng = np.random.default_rng(0)
+    layers = [{'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': list(in_shape)}]
+    for name in ['layernorm1', 'layernorm2']:
+        layers.append(
+            {
+                'class_name': 'LayerNormalization',
+                'name': name,
+                'epsilon': epsilon,
+                'gamma_data': rng.uniform(0.5, 1.5, in_shape[-1]),
+                'beta_data': rng.uniform(-0.5, 0.5, in_shape[-1]),
+            }
+        )
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {
+                'layernorm1': {'Precision': {'result': 'fixed<16,6,RND,SAT>'}, 'TableSize': 64},
+                'layernorm2': {'Precision': {'result': 'fixed<16,6,RND,SAT>'}, 'TableSize': 2048},
+            },
+        },
+        'OutputDir': str(test_root_path / f'hls4mlprj_layernorm_table_size_{io_type}'),
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Quartus',
+        'ClockPeriod': 5,
+    }
+    hls_model = hls4ml.model.ModelGraph(config, layers)
+    assert hls_model.graph['layernorm1'].get_attr('table_size') == 64
+    assert hls_model.graph['layernorm2'].get_attr('table_size') == 2048
+    hls_model.compile()
+
+    x = np.round(rng.uniform(-8, 8, (20, *in_shape)) * 1024) / 1024
+    y = hls_model.predict(x).reshape(x.shape)
+    y_ref = layernorm_reference(layernorm_reference(x, layers[1]), layers[2])
+
+    # The 64 entry table is accurate to ~1%
+    np.testing.assert_allclose(y, y_ref, rtol=0, atol=np.abs(y_ref).max() * 2e-2 + 2**-8)
@@ -0,0 +1,71 @@
+import os
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+from hls4ml.utils.library_cache import LibraryCache
+
+test_root_path = Path(__file__).parent
+
+
+def make_model(output_dir, weight=2):
+    w = np.array([weight])
+    b = np.array([1])
+    layers = [
+        {'class_name': 'Input', 'name': 'layer0_input', 'input_shape': [1]},
+        {'class_name': 'Dense', 'name': 'layer0', 'n_in': 1, 'n_out': 1, 'weight_data': w, 'bias_data': b},
+    ]
+    config = {'HLSConfig': {'Model': {'Precision': 'ap_fixed<32,16>', 'ReuseFactor': 1}}}
+    config['OutputDir'] = output_dir
+    config['ProjectName'] = 'myprj'
+    config['IOType'] = 'io_parallel'
+    config['Backend'] = 'Vivado'
+    config['LibraryCache'] = True
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.fixture
+def cache_dir(tmp_path, monkeypatch):
+    cache_dir = str(tmp_path / 'cache')
+    monkeypatch.setenv('HLS4ML_LIBRARY_CACHE_DIR', cache_dir)
+    return cache_dir
+
+
+def test_library_cache(cache_dir, monkeypatch):
+    x = np.array([[1.0], [2.0]], dtype=np.float32)
+
+    model1 = make_model(str(test_root_path / 'hls4mlprj_library_cache_1'))
+    model1.compile()
+    assert len(LibraryCache().entries()) == 1
+
+    # An identical model written elsewhere must not invoke the compiler
+    model2 = make_model(str(test_root_path / 'hls4mlprj_library_cache_2'))
+    with monkeypatch.context() as m:
+        m.setattr(os, 'system', lambda cmd: pytest.fail(f'Unexpected compilation: {cmd}'))
+        model2.compile()
+    np.testing.assert_array_equal(model2.predict(x), model1.predict(x))
+
+    # Different weights produce a different library
+    model3 = make_model(str(test_root_path / 'hls4mlprj_library_cache_3'), weight=3)
+    model3.compile()
+    assert len(LibraryCache().entries()) == 2
+    np.testing.assert_array_equal(model3.predict(x).ravel(), [4.0, 7.0])
+
+
+def test_library_cache_eviction(tmp_path):
+    cache = LibraryCache(cache_dir=str(tmp_path / 'cache'), max_entries=2)
+    lib = tmp_path / 'lib.bin'
+    lib.write_bytes(b'0' * 1024)
+    for i, key in enumerate(['a', 'b', 'c']):
+        cache.store(key, str(lib))
+        os.utime(cache._entry_path(key), (i, i))
+    cache.evict()
+    assert sorted(os.path.basename(e[0]) for e in cache.entries()) == ['b.so', 'c.so']
+
+    # Fetching marks the entry as recently used
+    assert cache.fetch('b', str(tmp_path / 'fetched.so'))
+    cache.store('d', str(lib))
+    assert sorted(os.path.basename(e[0]) for e in cache.entries()) == ['b.so', 'd.so']
+    assert not cache.fetch('a', str(tmp_path / 'missing.so'))
@@ -0,0 +1,156 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_inputs = 3
+
+
+def make_model(input_shapes, merge_layer, io_type, output_dir, merge_config=None):
+    layers = [
+        {'class_name': 'InputLayer', 'name': f'input{i}', 'input_shape': list(shape)} for i, shape in enumerate(input_shapes)
+    ]
+    merge_layer.update({'name': 'merge', 'inputs': [f'input{i}' for i in range(len(input_shapes))]})
+    layers.append(merge_layer)
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {
+                'merge': {'Precision': {'result': 'fixed<32,12>', 'accum': 'fixed<32,12>'}, **(merge_config or {})}
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers, inputs=merge_layer['inputs'])
+
+
+def random_inputs(input_shapes):
+    rng = np.random.default_rng(0)
+    # Values representable in fixed<16,6>
+    return [np.round(rng.uniform(-4, 4, (10, *shape)) * 64) / 64 for shape in input_shapes]
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize(
+    'op, np_op',
+    [
+        ('add', lambda x: np.sum(x, axis=0)),
+        ('multiply', lambda x: np.prod(x, axis=0)),
+        ('average', lambda x: np.mean(x, axis=0)),
+        ('maximum', lambda x: np.max(x, axis=0)),
+        ('minimum', lambda x: np.min(x, axis=0)),
+    ],
+)
+def test_merge_nary(op, np_op, io_type):
+    input_shapes = [(4, 4, 3)] * n_inputs
+    output_dir = str(test_root_path / f'hls4mlprj_merge_nary_{op}_{io_type}')
+    hls_model = make_model(input_shapes, {'class_name': 'Merge', 'op': op}, io_type, output_dir)
+    assert len(hls_model.graph['merge'].inputs) == n_inputs
+    hls_model.compile()
+
+    x = random_inputs(input_shapes)
+    y = hls_model.predict(x)
+    y_ref = np_op(np.stack(x)).reshape(len(x[0]), -1)
+    np.testing.assert_allclose(y, y_ref, rtol=0, atol=2**-20)
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize(
+    'input_shapes, axis',
+    [
+        ([(4,), (6,), (2,)], -1),
+        ([(4, 3), (2, 3), (5, 3)], 1),
+        ([(3, 4), (3, 2), (3, 5)], -1),
+        ([(2, 3, 4), (3, 3, 4), (1, 3, 4)], 1),
+        ([(3, 2, 4), (3, 3, 4), (3, 1, 4)], 2),
+        ([(3, 3, 4), (3, 3, 1), (3, 3, 2)], -1),
+    ],
+)
+def test_concatenate_nary(input_shapes, axis, io_type):
+    rank = len(input_shapes[0])
+    name = '_'.join(str(shape[axis - 1 if axis > 0 else axis]) for shape in input_shapes)
+    output_dir = str(test_root_path / f'hls4mlprj_concatenate_nary_{rank}d_{axis}_{name}_{io_type}')
+    merge_layer = {'class_name': 'Concatenate', 'op': f'concatenate{rank}d', 'axis': axis}
+    hls_model = make_model(input_shapes, merge_layer, io_type, output_dir)
+    hls_model.compile()
+
+    x = random_inputs(input_shapes)
+    y = hls_model.predict(x)
+    y_ref = np.concatenate(x, axis=axis).reshape(len(x[0]), -1)
+    np.testing.assert_array_equal(y, y_ref)
+
+
+def test_merge_nary_unsupported_op():
+    input_shapes = [(8,)] * n_inputs
+    output_dir = str(test_root_path / 'hls4mlprj_merge_nary_subtract')
+    with pytest.raises(Exception, match='subtract'):
+        make_model(input_shapes, {'class_name': 'Merge', 'op': 'subtract'}, 'io_parallel', output_dir)
+
+
+@pytest.mark.parametrize('op, np_op', [('add', np.sum), ('maximum', np.max)])
+def test_merge_nary_output_pack(op, np_op):
+    input_shapes = [(4, 4, 3)] * n_inputs
+    output_dir = str(test_root_path / f'hls4mlprj_merge_nary_output_pack_{op}')
+    merge_layer = {'class_name': 'Merge', 'op': op}
+    hls_model = make_model(input_shapes, merge_layer, 'io_stream', output_dir, merge_config={'OutputPack': 4})
+    hls_model.compile()
+
+    # Four pixels in every output pack
+    output_var = hls_model.graph['merge'].get_output_variable()
+    assert 'nnet::array<' in output_var.type.definition_cpp() and '3*4>' in output_var.type.definition_cpp()
+
+    x = random_inputs(input_shapes)
+    y = hls_model.predict(x)
+    y_ref = np_op(np.stack(x), axis=0).reshape(len(x[0]), -1)
+    np.testing.assert_allclose(y, y_ref, rtol=0, atol=2**-20)
+
+
+def test_merge_nary_output_pack_unsupported():
+    input_shapes = [(4, 4, 3)] * n_inputs
+    output_dir = str(test_root_path / 'hls4mlprj_merge_nary_output_pack_parallel')
+    merge_layer = {'class_name': 'Merge', 'op': 'add'}
+    with pytest.raises(Exception, match='io_stream'):
+        make_model(input_shapes, merge_layer, 'io_parallel', output_dir, merge_config={'OutputPack': 4})
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('onnx_op, np_op', [('Sum', np.sum), ('Mean', np.mean), ('Max', np.max), ('Min', np.min)])
+def test_merge_nary_onnx(onnx_op, np_op, io_type):
+    onnx = pytest.importorskip('onnx')
+    from onnx import TensorProto, helper
+
+    n_in = 8
+    # The inputs of the merge are three branches of the same input
+    branches = [('Relu', 'relu'), ('Sigmoid', 'sigmoid'), ('Tanh', 'tanh')]
+    nodes = [helper.make_node(op, ['x'], [f'{name}_out'], name=name) for op, name in branches]
+    nodes.append(helper.make_node(onnx_op, [f'{name}_out' for _, name in branches], ['y'], name='merge'))
+    graph = helper.make_graph(
+        nodes,
+        'merge_nary',
+        [helper.make_tensor_value_info('x', TensorProto.FLOAT, [1, n_in])],
+        [helper.make_tensor_value_info('y', TensorProto.FLOAT, [1, n_in])],
+    )
+    model = helper.make_model(graph)
+    onnx.checker.check_model(model)
+
+    config = {'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1}}
+    output_dir = str(test_root_path / f'hls4mlprj_merge_nary_onnx_{onnx_op}_{io_type}')
+    hls_model = hls4ml.converters.convert_from_onnx_model(
+        model, output_dir=output_dir, backend='Vivado', io_type=io_type, hls_config=config
+    )
+    assert len(hls_model.graph['merge'].inputs) == 3
+    hls_model.compile()
+
+    x = np.random.default_rng(0).uniform(-2, 2, (10, n_in))
+    y = hls_model.predict(x)
+    branch_outputs = np.stack([np.maximum(x, 0), 1 / (1 + np.exp(-x)), np.tanh(x)])
+    # Lookup tables of the activations
+    np.testing.assert_allclose(y, np_op(branch_outputs, axis=0), atol=0.05)
@@ -0,0 +1,116 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+seq_len = 8
+feature_dim = 8
+num_heads = 2
+head_dim = 4
+
+
+def make_model(backend, io_type, output_dir, cross_attention=False, strategy='Latency', reuse_factor=1):
+    rng = np.random.default_rng(0)
+    mha = {
+        'class_name': 'MultiHeadAttention',
+        'name': 'mha',
+        'inputs': ['layer0_input', 'layer1_input'] if cross_attention else ['layer0_input'],
+        'num_heads': num_heads,
+        'head_dim_key': head_dim,
+        'head_dim_value': head_dim,
+    }
+    for proj, n_in, n_out in [
+        ('query', feature_dim, head_dim),
+        ('key', feature_dim, head_dim),
+        ('value', feature_dim, head_dim),
+    ]:
+        mha[f'{proj}_weight_data'] = rng.uniform(-0.5, 0.5, (num_heads, n_in, n_out))
+        mha[f'{proj}_bias_data'] = rng.uniform(-0.2, 0.2, (num_heads, n_out))
+    mha['attention_output_weight_data'] = rng.uniform(-0.5, 0.5, (num_heads, head_dim, feature_dim))
+    mha['attention_output_bias_data'] = rng.uniform(-0.2, 0.2, feature_dim)
+
+    layers = [{'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [seq_len, feature_dim]}]
+    if cross_attention:
+        layers.append({'class_name': 'InputLayer', 'name': 'layer1_input', 'input_shape': [seq_len, feature_dim]})
+    layers.append(mha)
+
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': reuse_factor, 'Strategy': strategy},
+            'LayerName': {
+                'mha': {
+                    'Precision': {
+                        'accum': 'fixed<24,8>',
+                        'score': 'fixed<12,5,RND,SAT>',
+                        'attn_weight': 'ufixed<16,0,RND,SAT>',
+                    },
+                    'exp_table_t': 'ufixed<18,4,RND,SAT>',
+                    'inv_table_t': 'ufixed<18,2,RND,SAT>',
+                }
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': backend,
+    }
+    inputs = ['layer0_input', 'layer1_input'] if cross_attention else None
+    return hls4ml.model.ModelGraph(config, layers, inputs=inputs), mha
+
+
+def mha_reference(x_q, x_kv, layer):
+    heads = []
+    for h in range(num_heads):
+        q = x_q @ layer['query_weight_data'][h] + layer['query_bias_data'][h]
+        k = x_kv @ layer['key_weight_data'][h] + layer['key_bias_data'][h]
+        v = x_kv @ layer['value_weight_data'][h] + layer['value_bias_data'][h]
+        score = q @ np.swapaxes(k, -1, -2) / np.sqrt(head_dim)
+        weight = np.exp(score - score.max(axis=-1, keepdims=True))
+        weight /= weight.sum(axis=-1, keepdims=True)
+        heads.append(weight @ v)
+    head_output = np.concatenate(heads, axis=-1)
+    return head_output @ layer['attention_output_weight_data'].reshape(-1, feature_dim) + layer['attention_output_bias_data']
+
+
+@pytest.mark.parametrize('backend', ['Vivado', 'Vitis'])
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('cross_attention', [False, True])
+def test_multiheadattention(cross_attention, io_type, backend):
+    mode = 'cross' if cross_attention else 'self'
+    output_dir = str(test_root_path / f'hls4mlprj_mha_{mode}_{backend}_{io_type}')
+    hls_model, layer = make_model(backend, io_type, output_dir, cross_attention=cross_attention)
+    hls_model.compile()
+
+    rng = np.random.default_rng(1)
+    x_q = np.round(rng.uniform(-1, 1, (10, seq_len, feature_dim)) * 1024) / 1024
+    if cross_attention:
+        x_kv = np.round(rng.uniform(-1, 1, (10, seq_len, feature_dim)) * 1024) / 1024
+        y = hls_model.predict([x_q, x_kv])
+    else:
+        x_kv = x_q
+        y = hls_model.predict(x_q)
+    y = y.reshape(x_q.shape)
+    y_ref = mha_reference(x_q, x_kv, layer)
+
+    # The lookup-table softmax is accurate to a few percent
+    np.testing.assert_allclose(y, y_ref, rtol=0, atol=0.02)
+
+
+def test_multiheadattention_reuse_factor():
+    output_dir = str(test_root_path / 'hls4mlprj_mha_rf')
+    model_rf1, _ = make_model('Vivado', 'io_parallel', output_dir + '_1', strategy='Resource')
+    model_rf4, _ = make_model('Vivado', 'io_parallel', output_dir + '_4', strategy='Resource', reuse_factor=4)
+
+    mha = model_rf4.graph['mha']
+    for proj in ['query', 'key', 'value', 'attention_output']:
+        assert mha.get_attr(proj + '_reuse_factor') == 4
+    assert mha.get_attr('_weights_transposed')
+
+    model_rf1.compile()
+    model_rf4.compile()
+    x = np.round(np.random.default_rng(1).uniform(-1, 1, (10, seq_len, feature_dim)) * 1024) / 1024
+    np.testing.assert_array_equal(model_rf4.predict(x), model_rf1.predict(x))
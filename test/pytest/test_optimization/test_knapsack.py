@@ -6,7 +6,7 @@ from hls4ml.optimization.knapsack import solve_knapsack
 
 # In the simple case below, both implementations give the optimal answer
 # In general, the greedy algorithm will not give the optimal solution
-@pytest.mark.parametrize('implementation', ['dynamic', 'greedy', 'branch_bound', 'CBC_MIP'])
+@pytest.mark.parametrize('implementation', ['dynamic', 'greedy', 'branch_bound', 'CBC_MIP', 'native'])
 def test_knapsack_1d(implementation):
     values = np.array([4, 5, 6, 8, 3])
     weights = np.array([[2, 5, 3, 2, 5]])
@@ -19,7 +19,7 @@ def test_knapsack_1d(implementation):
     assert 3 in selected
 
 
-@pytest.mark.parametrize('implementation', ['greedy', 'branch_bound', 'CBC_MIP'])
+@pytest.mark.parametrize('implementation', ['greedy', 'branch_bound', 'CBC_MIP', 'native'])
 def test_multidimensional_knapsack(implementation):
     values = np.array([10, 2, 6, 12, 3])
     weights = np.array([[3, 1, 4, 5, 5], [3, 2, 4, 1, 2]])
@@ -31,6 +31,58 @@ def test_multidimensional_knapsack(implementation):
     assert 3 in selected
 
 
+def test_knapsack_native_dp():
+    rng = np.random.default_rng(0)
+    values = rng.uniform(0, 1, 60)
+    weights = rng.integers(1, 50, (1, 60))
+    capacity = np.array([400])
+
+    optimal, selected = solve_knapsack(values, weights, capacity, implementation='native', n_threads=2)
+    optimal_dp, _ = solve_knapsack(values, weights, capacity, implementation='dynamic')
+    assert np.isclose(optimal, optimal_dp)
+    assert np.isclose(np.sum(values[selected]), optimal)
+    assert np.sum(weights[:, selected]) <= capacity[0]
+
+
+def test_knapsack_native_table_size():
+    rng = np.random.default_rng(0)
+    values = rng.uniform(0, 1, 60)
+    weights = rng.integers(1, 50, (1, 60))
+    capacity = np.array([400])
+
+    # The bitset of the selected items fits, but not the two rows of values, so the heuristic is used
+    optimal, selected = solve_knapsack(
+        values, weights, capacity, implementation='native', max_table_size=60 * 401 / 8 + 8 * 401, gap_tolerance=0.05
+    )
+    optimal_dp, _ = solve_knapsack(values, weights, capacity, implementation='dynamic')
+    assert optimal <= optimal_dp
+    assert np.isclose(np.sum(values[selected]), optimal)
+    assert np.sum(weights[:, selected]) <= capacity[0]
+
+
+def test_knapsack_negative_capacity():
+    values = np.array([1.0, 2.0])
+    weights = np.array([[1, 2]])
+
+    with pytest.raises(Exception, match='non-negative capacities'):
+        solve_knapsack(values, weights, np.array([-1]), implementation='native')
+
+
+def test_knapsack_native_multidimensional():
+    rng = np.random.default_rng(0)
+    values = rng.uniform(0, 1, 500)
+    weights = rng.integers(1, 100, (3, 500))
+    capacity = np.array([5000, 8000, 10000])
+
+    optimal, selected = solve_knapsack(values, weights, capacity, implementation='native', gap_tolerance=0.05)
+    assert np.isclose(np.sum(values[selected]), optimal)
+    assert np.all(np.sum(weights[:, selected], axis=1) <= capacity)
+
+    # The solution is at least as good as the greedy one
+    optimal_greedy, _ = solve_knapsack(values, weights, capacity, implementation='greedy')
+    assert optimal >= optimal_greedy
+
+
 def test_knapsack_equal_weights():
     values = np.array([10, 2, 6, 8, 3])
     weights = np.array([[2, 2, 2, 2, 2], [3, 3, 3, 3, 3]])
@@ -0,0 +1,92 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+weights = np.array([[1.0, 0.5], [1.0, -0.5]])
+bias = np.array([0.0, 0.25])
+
+
+def make_model(output_dir, result_precision, counters=True, io_type='io_parallel'):
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [2]},
+        {'class_name': 'Dense', 'name': 'dense', 'n_in': 2, 'n_out': 2, 'weight_data': weights, 'bias_data': bias},
+        {'class_name': 'Activation', 'name': 'sigmoid', 'activation': 'sigmoid'},
+    ]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'},
+            'LayerName': {
+                'dense': {'Precision': {'accum': 'fixed<20,8>', 'result': result_precision}},
+                'sigmoid': {'Precision': {'result': 'ufixed<8,0,RND,SAT>'}},
+            },
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Vivado',
+        'OverflowCounters': counters,
+    }
+    if io_type == 'io_stream':
+        # Also covers the counters of the activation fused into the dense layer
+        config['HLSConfig']['LayerName']['dense']['FuseActivation'] = True
+    model = hls4ml.model.ModelGraph(config, layers)
+    model.compile()
+    return model
+
+
+# The first output of the dense layer is in [-20, 20], the second in [-4.75, 5.25]
+x = np.random.default_rng(0).uniform(-10, 10, (100, 2))
+x[0] = [10, 10]
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+def test_overflow_counters_wrap(io_type):
+    model = make_model(str(test_root_path / f'hls4mlprj_overflow_wrap_{io_type}'), 'fixed<12,4>', io_type=io_type)
+    y = model.predict(x)
+    counters = model.get_overflow_counters()
+
+    # In io_stream, the sigmoid is fused into the dense layer (FuseActivation), whose result is the preactivation type
+    result = counters['dense']['result_t' if io_type == 'io_parallel' else 'preact_t']
+    assert result['assignments'] == 2 * len(x)
+    assert result['overflows'] > 0
+    assert result['saturations'] == 0
+    assert result['max'] == 20
+
+    # The wrapped results are within [-8, 8), so the table indices of the sigmoid never saturate
+    table_index = counters['sigmoid' if io_type == 'io_parallel' else 'dense']['table_index']
+    assert table_index['assignments'] == 2 * len(x)
+    assert table_index['saturations'] == 0
+
+    # The instrumentation doesn't change the predictions
+    model_ref = make_model(
+        str(test_root_path / f'hls4mlprj_overflow_ref_{io_type}'), 'fixed<12,4>', counters=False, io_type=io_type
+    )
+    np.testing.assert_array_equal(y, model_ref.predict(x))
+    with pytest.raises(Exception):
+        model_ref.get_overflow_counters()
+
+
+def test_overflow_counters_saturation():
+    model = make_model(str(test_root_path / 'hls4mlprj_overflow_sat'), 'fixed<12,8,TRN,SAT>')
+    model.predict(x)
+    counters = model.get_overflow_counters()
+
+    # The wider result doesn't overflow, but the inputs of the sigmoid table do
+    result = counters['dense']['result_t']
+    assert result['overflows'] == 0
+    assert result['saturations'] == 0
+    assert result['roundings'] > 0
+    table_index = counters['sigmoid']['table_index']
+    assert table_index['saturations'] > 0
+    assert table_index['max'] > 1023
+
+    # The counters are reset by every call to predict
+    model.predict(np.zeros((5, 2)))
+    counters = model.get_overflow_counters()
+    assert counters['dense']['result_t']['assignments'] == 10
+    assert counters['sigmoid']['table_index']['saturations'] == 0
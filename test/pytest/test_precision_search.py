@@ -0,0 +1,73 @@
+from pathlib import Path
+
+import numpy as np
+
+import hls4ml
+from hls4ml.model.precision_search import relative_error, search_precision
+
+test_root_path = Path(__file__).parent
+
+rng = np.random.default_rng(0)
+w1 = rng.uniform(-1, 1, (4, 8))
+b1 = rng.uniform(-0.5, 0.5, 8)
+w2 = rng.uniform(-1, 1, (8, 2))
+b2 = rng.uniform(-0.5, 0.5, 2)
+
+
+def build_model(config):
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [4]},
+        {'class_name': 'Dense', 'name': 'dense1', 'n_in': 4, 'n_out': 8, 'weight_data': w1, 'bias_data': b1},
+        {'class_name': 'Activation', 'name': 'relu1', 'activation': 'relu'},
+        {'class_name': 'Dense', 'name': 'dense2', 'n_in': 8, 'n_out': 2, 'weight_data': w2, 'bias_data': b2},
+    ]
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+def make_model(output_dir):
+    config = {
+        'HLSConfig': {'Model': {'Precision': 'fixed<16,8>', 'ReuseFactor': 1, 'Strategy': 'Latency'}},
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': 'io_parallel',
+        'Backend': 'Vivado',
+    }
+    return build_model(config)
+
+
+def test_search_precision():
+    output_dir = str(test_root_path / 'hls4mlprj_precision_search')
+    model = make_model(output_dir)
+    model.compile()
+    x = np.random.default_rng(1).uniform(-2, 2, (100, 4))
+    y_ref = model.predict(x)
+
+    tolerance = 0.01
+    hls_config = search_precision(
+        model, x, tolerance, types=('result', 'weight'), build_model=build_model, n_jobs=8, verbose=False
+    )
+
+    # Every layer has its own, narrower precision
+    for layer in ['layer0_input', 'dense1', 'relu1', 'dense2']:
+        precision = hls_config['LayerName'][layer]['Precision']['result']
+        assert hls4ml.backends.VivadoBackend.convert_precision_string(precision).width < 16
+    for layer in ['dense1', 'dense2']:
+        assert 'weight' in hls_config['LayerName'][layer]['Precision']
+
+    # The integer bits come from the calibration data, e.g. the inputs in [-2, 2) and the ReLU output are unsigned
+    input_precision = hls4ml.backends.VivadoBackend.convert_precision_string(
+        hls_config['LayerName']['layer0_input']['Precision']['result']
+    )
+    assert (input_precision.integer, input_precision.signed) == (2, True)
+    relu_precision = hls4ml.backends.VivadoBackend.convert_precision_string(
+        hls_config['LayerName']['relu1']['Precision']['result']
+    )
+    assert not relu_precision.signed
+
+    # The searched model is within the tolerance
+    config = model.config.config.copy()
+    config['HLSConfig'] = hls_config
+    config['OutputDir'] = output_dir + '_searched'
+    searched = build_model(config)
+    searched.compile()
+    assert relative_error(y_ref, searched.predict(x)) <= tolerance
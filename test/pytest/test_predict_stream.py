@@ -0,0 +1,79 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_in = 8
+n_out = 4
+
+
+@pytest.fixture(scope='module')
+def hls_model():
+    rng = np.random.default_rng(42)
+    w = rng.uniform(-1, 1, (n_in, n_out)).round(3)
+    b = rng.uniform(-1, 1, (n_out,)).round(3)
+    layers = [
+        {'class_name': 'Input', 'name': 'layer0_input', 'input_shape': [n_in]},
+        {'class_name': 'Dense', 'name': 'layer0', 'n_in': n_in, 'n_out': n_out, 'weight_data': w, 'bias_data': b},
+    ]
+    config = {'HLSConfig': {'Model': {'Precision': 'ap_fixed<32,16>', 'ReuseFactor': 1}}}
+    config['OutputDir'] = str(test_root_path / 'hls4mlprj_predict_stream')
+    config['ProjectName'] = 'myprj'
+    config['IOType'] = 'io_parallel'
+    config['Backend'] = 'Vivado'
+    model = hls4ml.model.ModelGraph(config, layers)
+    model.compile()
+    return model
+
+
+@pytest.fixture(scope='module')
+def data():
+    return np.random.default_rng(0).uniform(-1, 1, (1000, n_in)).astype(np.float32)
+
+
+@pytest.mark.parametrize('chunk_size', [1, 64, 1000, 4096])
+def test_stream_array(hls_model, data, chunk_size):
+    y_ref = hls_model.predict(data)
+    y = hls_model.predict_stream(data, chunk_size=chunk_size)
+    np.testing.assert_array_equal(y, y_ref)
+
+
+def test_stream_memmap_to_npy(hls_model, data, tmp_path):
+    x_path = str(tmp_path / 'x.npy')
+    y_path = str(tmp_path / 'y.npy')
+    np.save(x_path, data)
+    x_mmap = np.load(x_path, mmap_mode='r')
+
+    progress = []
+    y = hls_model.predict_stream(
+        x_mmap, output=y_path, chunk_size=300, progress_callback=lambda done, total: progress.append((done, total))
+    )
+    assert isinstance(y, np.memmap)
+    assert progress == [(300, 1000), (600, 1000), (900, 1000), (1000, 1000)]
+    np.testing.assert_array_equal(np.load(y_path), hls_model.predict(data))
+
+
+def test_stream_generator(hls_model, data):
+    def generator():
+        for start in range(0, data.shape[0], 128):
+            yield data[start : start + 128]
+
+    y_ref = hls_model.predict(data)
+    np.testing.assert_array_equal(hls_model.predict_stream(generator()), y_ref)
+
+    out = np.zeros((data.shape[0], n_out), dtype=np.float32)
+    y = hls_model.predict_stream(generator(), output=out)
+    assert y is out
+    np.testing.assert_array_equal(out, y_ref)
+
+
+def test_stream_callable(hls_model, data):
+    y = hls_model.predict_stream(lambda start, stop: data[start:stop], n_samples=data.shape[0], chunk_size=100)
+    np.testing.assert_array_equal(y, hls_model.predict(data))
+
+    with pytest.raises(Exception):
+        hls_model.predict_stream(lambda start, stop: data[start:stop])
@@ -0,0 +1,59 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+n_in = 8
+n_out = 4
+
+
+def make_model(backend, io_type, output_dir):
+    rng = np.random.default_rng(42)
+    w = rng.uniform(-1, 1, (n_in, n_out)).round(3)
+    b = rng.uniform(-1, 1, (n_out,)).round(3)
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [n_in]},
+        {'class_name': 'Dense', 'name': 'layer0', 'n_in': n_in, 'n_out': n_out, 'weight_data': w, 'bias_data': b},
+    ]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1},
+            'LayerName': {
+                'layer0_input': {'Precision': {'result': 'fixed<12,4>'}},
+                'layer0': {'Precision': {'result': 'ufixed<10,4,RND,SAT>'}},
+            },
+        }
+    }
+    config['OutputDir'] = output_dir
+    config['ProjectName'] = 'myprj'
+    config['IOType'] = io_type
+    config['Backend'] = backend
+    config['ClockPeriod'] = 5
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('backend', ['Vivado', 'Vitis', 'Quartus'])
+def test_raw_io(backend, io_type):
+    output_dir = str(test_root_path / f'hls4mlprj_raw_io_{backend}_{io_type}')
+    hls_model = make_model(backend, io_type, output_dir)
+    hls_model.compile()
+
+    # Raw input codes of fixed<12,4>, i.e., 8 fractional bits
+    x_raw = np.random.default_rng(0).integers(-(2**11), 2**11, size=(100, n_in))
+    x_float = x_raw / 2**8
+
+    y_float = hls_model.predict(x_float.astype(np.float32))
+    for dtype in [np.int16, np.int32, np.int64]:
+        y_raw = hls_model.predict(x_raw.astype(dtype))
+        # ufixed<10,4> output is returned as the raw unsigned bits, 6 fractional bits
+        assert y_raw.dtype == np.uint16
+        np.testing.assert_array_equal(y_raw, y_float * 2**6)
+
+    # int8 inputs are interpreted as sign-extended bit patterns
+    x_raw = np.random.default_rng(1).integers(-128, 128, size=(100, n_in), dtype=np.int8)
+    np.testing.assert_array_equal(hls_model.predict(x_raw), hls_model.predict((x_raw / 2**8).astype(np.float32)) * 2**6)
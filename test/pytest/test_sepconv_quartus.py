@@ -0,0 +1,108 @@
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+in_height, in_width, n_chan, n_filt = 6, 7, 3, 4
+
+
+def make_model(output_dir, layer_type, io_type, reuse_factor, padding):
+    rng = np.random.default_rng(0)
+    is_2d = layer_type.endswith('2D')
+    filt = (3, 2) if is_2d else (3,)
+    pad = padding == 'same'
+    in_shape = [in_height, in_width, n_chan] if is_2d else [in_width, n_chan]
+
+    layer = {
+        'class_name': layer_type,
+        'name': 'conv',
+        'data_format': 'channels_last',
+        'n_chan': n_chan,
+        'n_filt': n_filt if layer_type.startswith('Separable') else n_chan,
+        'depthwise_data': rng.uniform(-1, 1, (*filt, n_chan, 1)),
+        'bias_data': rng.uniform(-1, 1, n_filt if layer_type.startswith('Separable') else n_chan),
+    }
+    if layer_type.startswith('Separable'):
+        layer['pointwise_data'] = rng.uniform(-1, 1, (*[1] * len(filt), n_chan, n_filt))
+    dims = [('width', in_width, filt[-1], 'pad_left', 'pad_right')]
+    if is_2d:
+        dims.insert(0, ('height', in_height, filt[0], 'pad_top', 'pad_bottom'))
+    for dim, size, filt_size, pad_before, pad_after in dims:
+        total_pad = filt_size - 1 if pad else 0
+        layer[f'in_{dim}'] = size
+        layer[f'filt_{dim}'] = filt_size
+        layer[f'stride_{dim}'] = 1
+        layer[f'out_{dim}'] = size - filt_size + 1 + total_pad
+        layer[pad_before] = total_pad // 2
+        layer[pad_after] = total_pad - total_pad // 2
+
+    layers = [{'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': in_shape}, layer]
+    config = {
+        'HLSConfig': {
+            'Model': {'Precision': 'ac_fixed<20,8,true>', 'ReuseFactor': reuse_factor, 'Strategy': 'Resource'},
+        },
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': 'Quartus',
+        'ClockPeriod': 5,
+    }
+    return hls4ml.model.ModelGraph(config, layers), layer
+
+
+def reference(x, layer):
+    is_2d = 'filt_height' in layer
+    if not is_2d:
+        x = x[:, None]
+        pads = ((0, 0), (0, 0), (layer['pad_left'], layer['pad_right']), (0, 0))
+        depthwise = layer['depthwise_data'][None]
+    else:
+        pads = ((0, 0), (layer['pad_top'], layer['pad_bottom']), (layer['pad_left'], layer['pad_right']), (0, 0))
+        depthwise = layer['depthwise_data']
+    x = np.pad(x, pads)
+    filt_h, filt_w = depthwise.shape[:2]
+    out_h, out_w = x.shape[1] - filt_h + 1, x.shape[2] - filt_w + 1
+
+    y = np.zeros((len(x), out_h, out_w, n_chan))
+    for i in range(filt_h):
+        for j in range(filt_w):
+            y += x[:, i : i + out_h, j : j + out_w, :] * depthwise[i, j, :, 0]
+    if 'pointwise_data' in layer:
+        y = y @ layer['pointwise_data'].reshape(n_chan, n_filt)
+    y += layer['bias_data']
+
+    return y.reshape(len(x), -1)
+
+
+@pytest.mark.parametrize('layer_type', ['DepthwiseConv1D', 'DepthwiseConv2D', 'SeparableConv1D', 'SeparableConv2D'])
+@pytest.mark.parametrize('io_type', ['io_parallel', 'io_stream'])
+@pytest.mark.parametrize('reuse_factor, padding', [(1, 'valid'), (3, 'same')])
+def test_sepconv_quartus(layer_type, io_type, reuse_factor, padding):
+    output_dir = str(test_root_path / f'hls4mlprj_sepconv_quartus_{layer_type}_{io_type}_rf{reuse_factor}_{padding}')
+    model, layer = make_model(output_dir, layer_type, io_type, reuse_factor, padding)
+
+    x_shape = (in_height, in_width, n_chan) if layer_type.endswith('2D') else (in_width, n_chan)
+    x = np.round(np.random.default_rng(1).uniform(-4, 4, (20, *x_shape)) * 16) / 16
+    model.compile()
+    y = model.predict(x.reshape(len(x), -1))
+    np.testing.assert_allclose(y.reshape(len(x), -1), reference(x, layer), atol=0.02)
+
+    conv = model.graph['conv']
+    if layer_type.startswith('Separable'):
+        assert conv.get_attr('depthwise_reuse_factor') == reuse_factor
+    else:
+        assert conv.get_attr('reuse_factor') == reuse_factor
+    assert (
+        f'nnet::{layer_type[:-2].lower().replace("conv", "_conv")}_{layer_type[-2:].lower()}_cl<'
+        in Path(output_dir, 'firmware', 'myprj.cpp').read_text()
+    )
+
+
+def test_depthwise_reuse_factor_quartus():
+    model, _ = make_model(str(test_root_path / 'hls4mlprj_sepconv_quartus_rf'), 'DepthwiseConv2D', 'io_parallel', 4, 'valid')
+    # The reuse factor divides the kernel size (3x2)
+    assert model.graph['conv'].get_attr('reuse_factor') == 3
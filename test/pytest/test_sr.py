@@ -35,6 +35,9 @@ def test_hlssr(data):
     hls_model.write()
     hls_model.compile()
 
+    # The elimination of common subexpressions is opt-in
+    assert hls_model.graph['expr1'].get_attr('cse_temps') is None
+
     X, y = data
     y_hls = hls_model.predict(X)
     y_hls = y_hls.reshape(y.shape)
@@ -69,3 +72,139 @@ def test_pysr_luts(data):
     eq = str(model.sympy())
 
     assert 'cos_lut' in eq
+
+
+@pytest.mark.parametrize('cse', [True, False])
+def test_hlssr_cse(data, cse):
+    expr = ['x0**2 + 2.5382*cos_lut(x3) - 0.5', 'x0**2*x1 + cos_lut(x3)', 'x2*cos_lut(x3) - x0**2']
+
+    lut_functions = {'cos_lut': {'math_func': 'cos', 'range_start': -4, 'range_end': 4, 'table_size': 2048}}
+
+    output_dir = str(test_root_path / f'hls4mlprj_sr_cse_{cse}')
+
+    hls_model = hls4ml.converters.convert_from_symbolic_expression(
+        expr,
+        n_symbols=5,
+        precision='ap_fixed<18,6>',
+        output_dir=output_dir,
+        lut_functions=lut_functions,
+        cse=cse,
+        hls_include_path='',
+        hls_libs_path='',
+    )
+    hls_model.write()
+    hls_model.compile()
+
+    layer = hls_model.graph['expr1']
+    top_function = Path(output_dir, 'firmware', 'myproject.cpp').read_text()
+    if cse:
+        # x0**2 and the LUT call are computed once, x0**2 is in [0, 1024] for an input of ap_fixed<18,6>
+        assert [temp[1] for temp in layer.get_attr('cse_temps')] == ['x0**2', 'cos_lut(x3)']
+        assert layer.types['expr1_cse_0_t'].precision.definition_cpp() == 'ap_ufixed<23,11>'
+        assert layer.types['expr1_cse_1_t'].precision.definition_cpp() == 'ap_fixed<14,2>'
+        assert layer.get_attr('ops_before')['FUNC_COS_LUT'] == 3
+        assert layer.get_attr('ops_after')['FUNC_COS_LUT'] == 1
+        assert sum(layer.get_attr('ops_after').values()) < sum(layer.get_attr('ops_before').values())
+        assert top_function.count('cos_lut(') == 1
+    else:
+        assert layer.get_attr('cse_temps') is None
+        assert top_function.count('cos_lut(') == 3
+
+    X, _ = data
+    y = np.stack(
+        [
+            X[:, 0] ** 2 + 2.5382 * np.cos(X[:, 3]) - 0.5,
+            X[:, 0] ** 2 * X[:, 1] + np.cos(X[:, 3]),
+            X[:, 2] * np.cos(X[:, 3]) - X[:, 0] ** 2,
+        ],
+        axis=1,
+    )
+    np.testing.assert_allclose(y, hls_model.predict(X), rtol=1e-2, atol=1e-2)
+
+
+def test_list_schedule():
+    from hls4ml.backends.symbolic.passes.schedule import list_schedule
+
+    # Four independent products summed by a tree of adders
+    ops = [('mul', []), ('mul', []), ('mul', []), ('mul', []), ('add', [0, 1]), ('add', [2, 3]), ('add', [4, 5])]
+    latencies = {'mul': 3, 'add': 1}
+
+    start, units, latency = list_schedule(ops, 1, latencies)
+    assert units == {'mul': 4, 'add': 3}
+    assert start == [0, 0, 0, 0, 3, 3, 4]
+    assert latency == 5
+
+    # One multiplier and one adder, a new input every 4 cycles
+    start, units, latency = list_schedule(ops, 4, latencies)
+    assert units == {'mul': 1, 'add': 1}
+    assert start == [0, 1, 2, 3, 4, 6, 7]
+    assert latency == 8
+
+
+def test_expression_operations():
+    import sympy
+
+    from hls4ml.backends.symbolic.passes.schedule import expression_operations
+
+    x0, x1, x2 = sympy.symbols('x0 x1 x2')
+
+    def kinds(expr):
+        ops, _, _ = expression_operations([expr])
+        return sorted(kind for kind, _ in ops)
+
+    # The negative terms are subtractions, as in the generated code
+    assert kinds(x0 * x1 - x2 + 1) == ['add', 'mul', 'sub']
+    assert kinds(x0 - x1 - x2) == ['sub', 'sub']
+    # A leading negative term or product is a negation
+    assert kinds(-x0 - x1) == ['sub', 'sub']
+    assert kinds(-x0 * x1) == ['mul', 'sub']
+
+
+@pytest.mark.parametrize('reuse_factor', [1, 4])
+def test_hlssr_reuse(data, reuse_factor):
+    expr = ['x0**2 + 2.5382*cos_lut(x3) - 0.5', 'x0**2*x1 + cos_lut(x3)', 'x2*cos_lut(x3) - x0**2']
+
+    lut_functions = {'cos_lut': {'math_func': 'cos', 'range_start': -4, 'range_end': 4, 'table_size': 2048}}
+
+    output_dir = str(test_root_path / f'hls4mlprj_sr_reuse_{reuse_factor}')
+
+    hls_model = hls4ml.converters.convert_from_symbolic_expression(
+        expr,
+        n_symbols=5,
+        precision='ap_fixed<18,6>',
+        output_dir=output_dir,
+        lut_functions=lut_functions,
+        reuse_factor=reuse_factor,
+        cse=True,
+        hls_include_path='',
+        hls_libs_path='',
+    )
+    hls_model.write()
+    hls_model.compile()
+
+    # 4 multiplications, 2 additions, 2 subtractions and 1 LUT call after the common subexpressions are extracted
+    layer = hls_model.graph['expr1']
+    top_function = Path(output_dir, 'firmware', 'myproject.cpp').read_text()
+    limits = ['multiplier_limit', 'adder_limit', 'subtractor_limit', 'lut_limit']
+    if reuse_factor == 1:
+        assert [layer.get_attr(a) for a in limits] == [4, 2, 2, 1]
+        assert 'ALLOCATION' not in top_function
+        assert '#pragma HLS PIPELINE \n' in top_function
+    else:
+        assert [layer.get_attr(a) for a in limits] == [1, 1, 1, 1]
+        assert '#pragma HLS ALLOCATION operation instances=mul limit=1' in top_function
+        assert '#pragma HLS ALLOCATION operation instances=sub limit=1' in top_function
+        assert f'#pragma HLS PIPELINE II={reuse_factor} \n' in top_function
+    # The critical path is the LUT, the multiplication by 2.5382 and two additions
+    assert layer.get_attr('latency_estimate') >= 2 + 3 + 1 + 1
+
+    X, _ = data
+    y = np.stack(
+        [
+            X[:, 0] ** 2 + 2.5382 * np.cos(X[:, 3]) - 0.5,
+            X[:, 0] ** 2 * X[:, 1] + np.cos(X[:, 3]),
+            X[:, 2] * np.cos(X[:, 3]) - X[:, 0] ** 2,
+        ],
+        axis=1,
+    )
+    np.testing.assert_allclose(y, hls_model.predict(X), rtol=1e-2, atol=1e-2)
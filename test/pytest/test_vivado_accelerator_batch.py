@@ -0,0 +1,84 @@
+import os
+import subprocess
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hls4ml
+
+test_root_path = Path(__file__).parent
+
+
+def make_model(output_dir, io_type, backend, accel_config=None, input_data=None, output_predictions=None):
+    rng = np.random.default_rng(0)
+    layers = [
+        {'class_name': 'InputLayer', 'name': 'layer0_input', 'input_shape': [10]},
+        {
+            'class_name': 'Dense',
+            'name': 'dense',
+            'n_in': 10,
+            'n_out': 5,
+            'weight_data': rng.uniform(-1, 1, (10, 5)),
+            'bias_data': rng.uniform(-1, 1, 5),
+        },
+        {'class_name': 'Activation', 'name': 'relu', 'activation': 'relu'},
+    ]
+    config = {
+        'HLSConfig': {'Model': {'Precision': 'fixed<16,6>', 'ReuseFactor': 1, 'Strategy': 'Latency'}},
+        'OutputDir': output_dir,
+        'ProjectName': 'myprj',
+        'IOType': io_type,
+        'Backend': backend,
+    }
+    if accel_config is not None:
+        config['AcceleratorConfig'] = accel_config
+    if input_data is not None:
+        config['InputData'] = input_data
+        config['OutputPredictions'] = output_predictions
+    return hls4ml.model.ModelGraph(config, layers)
+
+
+@pytest.mark.parametrize('io_type, word_width', [('io_parallel', 64), ('io_stream', 32), ('io_parallel', 512)])
+def test_batched_wrapper(io_type, word_width):
+    x = np.round(np.random.default_rng(1).uniform(-4, 4, (20, 10)) * 64) / 64
+
+    model_ref = make_model(str(test_root_path / f'hls4mlprj_accel_batch_ref_{io_type}'), io_type, 'Vivado')
+    model_ref.compile()
+    y_ref = model_ref.predict(x)
+
+    output_dir = str(test_root_path / f'hls4mlprj_accel_batch_{io_type}_{word_width}')
+    os.makedirs(output_dir, exist_ok=True)
+    np.save(output_dir + '_x.npy', x)
+    np.save(output_dir + '_y.npy', y_ref)
+    accel_config = {
+        'Interface': 'axi_stream',
+        'Precision': {'Input': 'ap_fixed<16,6>', 'Output': 'ap_fixed<16,6>'},
+        'Batched': True,
+        'WordWidth': word_width,
+    }
+    model = make_model(output_dir, io_type, 'VivadoAccelerator', accel_config, output_dir + '_x.npy', output_dir + '_y.npy')
+    model.write()
+
+    header = Path(output_dir, 'firmware', 'myprj_axi.h').read_text()
+    assert f'static const unsigned IN_PACK = {word_width // 16};' in header
+    assert f'static const unsigned OUT_WORDS = {-(-5 // (word_width // 16))};' in header
+
+    # Run the generated testbench, which processes all samples with one call of the wrapper
+    subprocess.run(
+        'g++ -O1 -std=c++11 -Ifirmware/ap_types -DWEIGHTS_DIR=\'"firmware/weights"\' '
+        'myprj_test.cpp firmware/myprj.cpp firmware/myprj_axi.cpp -o tb && ./tb',
+        shell=True,
+        check=True,
+        cwd=output_dir,
+    )
+    # The results are printed with 6 significant digits
+    y = np.loadtxt(Path(output_dir, 'tb_data', 'csim_results.log'))
+    np.testing.assert_allclose(y, y_ref, rtol=1e-5)
+
+
+def test_batched_float_precision():
+    accel_config = {'Interface': 'axi_stream', 'Precision': {'Input': 'float', 'Output': 'float'}, 'Batched': True}
+    model = make_model(str(test_root_path / 'hls4mlprj_accel_batch_float'), 'io_parallel', 'VivadoAccelerator', accel_config)
+    with pytest.raises(Exception, match='fixed-point or integer'):
+        model.write()